@@ -0,0 +1,116 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "bestoffsetprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::Cassini;
+
+void BestOffsetPrefetcher::handleDemandAccess(const CacheListenerNotification& notify, bool prefetched) {
+    // Only misses and first hits to prefetched lines train and trigger
+    if ( notify.getResultType() != MISS && !prefetched )
+        return;
+
+    const Addr addr = notify.getPhysicalAddress();
+    const Addr line = addr / blockSize;
+
+    // Test one offset per access
+    const Addr base = line - offsets[testIndex];
+    if ( recentRequests[rrIndex(base)] == base + 1 && ++scores[testIndex] >= scoreMax ) {
+        endLearningPhase();
+    } else if ( ++testIndex == offsets.size() ) {
+        testIndex = 0;
+        if ( ++learningRound >= roundMax ) endLearningPhase();
+    }
+
+    recentRequests[rrIndex(line)] = line + 1;
+
+    if ( !prefetchOn ) return;
+
+    const uint32_t allowed = getThrottledDegree();
+    for ( uint32_t i = 1; i <= allowed; ++i ) {
+        if ( !issuePrefetch(addr, addr + i * bestOffset * blockSize) ) break;
+    }
+}
+
+void BestOffsetPrefetcher::endLearningPhase() {
+    uint32_t best = 0;
+    for ( uint32_t i = 1; i < scores.size(); ++i ) {
+        if ( scores[i] > scores[best] ) best = i;
+    }
+
+    prefetchOn = scores[best] > badScore;
+    bestOffset = offsets[best];
+    statBestOffset->addData(prefetchOn ? bestOffset : 0);
+
+    output->verbose(CALL_INFO, 2, 0, "Learning phase done, best offset %" PRId64 " scored %" PRIu32 ", prefetching %s\n",
+                    bestOffset, scores[best], prefetchOn ? "on" : "off");
+
+    scores.assign(offsets.size(), 0);
+    testIndex = 0;
+    learningRound = 0;
+}
+
+
+BestOffsetPrefetcher::BestOffsetPrefetcher(ComponentId_t id, Params& params) : BasePrefetcher(id, params, "BestOffsetPrefetcher") {
+    initThrottle(params, 1);
+
+    uint32_t maxOffset = params.find<uint32_t>("max_offset", 256);
+    for ( uint32_t n = 1; n <= maxOffset; ++n ) {
+        uint32_t rest = n;
+        while ( rest % 2 == 0 ) rest /= 2;
+        while ( rest % 3 == 0 ) rest /= 3;
+        while ( rest % 5 == 0 ) rest /= 5;
+        if ( rest == 1 ) offsets.push_back(n);
+    }
+    if ( offsets.empty() ) {
+        output->fatal(CALL_INFO, -1, "%s: max_offset must be at least 1\n", getName().c_str());
+    }
+    scores.assign(offsets.size(), 0);
+
+    uint32_t rrEntries = params.find<uint32_t>("rr_entries", 256);
+    uint32_t rrSize = 1;
+    while ( rrSize < rrEntries ) rrSize <<= 1;
+    rrMask = rrSize - 1;
+    recentRequests.assign(rrSize, 0);
+
+    scoreMax = params.find<uint32_t>("score_max", 31);
+    roundMax = params.find<uint32_t>("round_max", 100);
+    badScore = params.find<uint32_t>("bad_score", 1);
+
+    testIndex = 0;
+    learningRound = 0;
+
+    // Start out as a next line prefetcher until the first phase ends
+    bestOffset = 1;
+    prefetchOn = true;
+
+    statBestOffset = registerStatistic<uint64_t>("best_offset");
+
+    output->verbose(CALL_INFO, 1, 0, "BestOffsetPrefetcher created, cache line: %" PRIu64 ", %zu candidate offsets\n",
+        blockSize, offsets.size());
+}
+
+BestOffsetPrefetcher::~BestOffsetPrefetcher() {
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// P. Michaud. 2016. Best-offset hardware prefetching. In Proceedings of the 2016 IEEE International
+/// Symposium on High Performance Computer Architecture (HPCA '16). 469-480.
+/// DOI=http://dx.doi.org/10.1109/HPCA.2016.7446087
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////
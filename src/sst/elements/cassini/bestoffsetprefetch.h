@@ -0,0 +1,115 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_BEST_OFFSET_PREFETCH
+#define _H_SST_BEST_OFFSET_PREFETCH
+
+#include <vector>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/output.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+#include "prefetchbase.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace std;
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Best-Offset prefetcher [Michaud 2016].  Every demand miss and every
+ * first hit to a prefetched line tests one candidate offset d: if line
+ * X - d is in the recent requests table, prefetching with offset d
+ * would have covered X and d scores a point.  After a learning phase
+ * the best scoring offset is used to prefetch X + D (and X + 2D, ...
+ * up to degree), or prefetching is turned off if no offset scored
+ * well.
+ *
+ * The cache does not tell listeners when a line is filled, so lines
+ * go into the recent requests table when they are accessed rather
+ * than when their fill completes.  Offsets are therefore not
+ * penalized for being too short to be timely.
+ */
+class BestOffsetPrefetcher : public BasePrefetcher {
+public:
+    BestOffsetPrefetcher(ComponentId_t id, Params& params);
+    ~BestOffsetPrefetcher();
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        BestOffsetPrefetcher,
+            "cassini",
+            "BestOffsetPrefetcher",
+            SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Best-Offset Prefetcher [Michaud 2016]",
+            SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        CASSINI_PREFETCHER_ELI_PARAMS,
+        CASSINI_PREFETCHER_THROTTLE_ELI_PARAMS,
+        { "degree", "Number of lines (X + D, X + 2D, ...) prefetched for one access", "1" },
+        { "max_offset", "Largest offset in lines to consider, candidates are the numbers up to this with no prime factors other than 2, 3 and 5", "256" },
+        { "rr_entries", "Number of entries in the recent requests table", "256" },
+        { "score_max", "A learning phase ends as soon as an offset reaches this score", "31" },
+        { "round_max", "A learning phase ends after testing every offset this many times", "100" },
+        { "bad_score", "Prefetching is turned off if the best offset scores this or less", "1" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        CASSINI_PREFETCHER_ELI_STATS,
+        CASSINI_PREFETCHER_THROTTLE_ELI_STATS,
+        { "best_offset", "Offset in lines chosen at the end of each learning phase, 0 if prefetching was turned off", "lines", 1 }
+    )
+
+protected:
+    void handleDemandAccess(const CacheListenerNotification& notify, bool prefetched) override;
+
+private:
+    void endLearningPhase();
+
+    inline uint32_t rrIndex(Addr line) const {
+        return (uint32_t)((line * 0x9E3779B97F4A7C15ULL) >> 32) & rrMask;
+    }
+
+    std::vector<int64_t> offsets;
+    std::vector<uint32_t> scores;
+
+    // Recent requests, direct mapped, holding line numbers (+1 so that
+    // 0 marks an empty entry)
+    std::vector<Addr> recentRequests;
+    uint32_t rrMask;
+
+    uint32_t testIndex;
+    uint32_t learningRound;
+    uint32_t scoreMax;
+    uint32_t roundMax;
+    uint32_t badScore;
+
+    int64_t bestOffset;
+    bool prefetchOn;
+
+    Statistic<uint64_t>* statBestOffset;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
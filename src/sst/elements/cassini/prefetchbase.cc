@@ -0,0 +1,339 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "prefetchbase.h"
+
+#include "stdlib.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+
+void PrefetchLineSet::init(uint32_t entries) {
+    capacity = entries;
+    head = 0;
+    used = 0;
+    count = 0;
+
+    uint32_t tableSize = 2;
+    while ( tableSize < 2 * entries ) tableSize <<= 1;
+    mask = tableSize - 1;
+
+    ring.assign(2 * entries, 0);
+    table.assign(tableSize, Slot());
+    for ( auto& slot : table ) slot.valid = false;
+}
+
+int64_t PrefetchLineSet::find(Addr line) const {
+    if ( capacity == 0 ) return -1;
+    for ( uint32_t i = hash(line); table[i].valid; i = (i + 1) & mask ) {
+        if ( table[i].line == line ) return i;
+    }
+    return -1;
+}
+
+// A ring position is live if the table still points at it; erased
+// lines (and lines erased then inserted again) leave dead positions
+int64_t PrefetchLineSet::liveSlot(uint32_t pos) const {
+    int64_t slot = find(ring[pos]);
+    if ( slot != -1 && table[slot].ring == pos ) return slot;
+    return -1;
+}
+
+void PrefetchLineSet::insert(Addr line) {
+    if ( capacity == 0 || contains(line) ) return;
+
+    if ( count == capacity ) {
+        // Drop the oldest line still in the set
+        while ( true ) {
+            uint32_t pos = head;
+            head = (head + 1) % ring.size();
+            used--;
+            int64_t old = liveSlot(pos);
+            if ( old != -1 ) {
+                remove(old);
+                count--;
+                break;
+            }
+        }
+    }
+    if ( used == ring.size() ) compact();
+
+    uint32_t pos = (head + used) % ring.size();
+    used++;
+    count++;
+    ring[pos] = line;
+
+    uint32_t i = hash(line);
+    while ( table[i].valid ) i = (i + 1) & mask;
+    table[i].line = line;
+    table[i].ring = pos;
+    table[i].valid = true;
+}
+
+bool PrefetchLineSet::erase(Addr line) {
+    int64_t slot = find(line);
+    if ( slot == -1 ) return false;
+    // The ring position is left behind and skipped or compacted later
+    remove(slot);
+    count--;
+    return true;
+}
+
+// Squeeze the dead positions out of the ring.  Only called when the
+// ring (twice the capacity) is full, so at least half of it is freed.
+void PrefetchLineSet::compact() {
+    std::vector<std::pair<int64_t, Addr>> live;
+    live.reserve(count);
+    for ( uint32_t n = 0; n < used; n++ ) {
+        uint32_t pos = (head + n) % ring.size();
+        int64_t slot = liveSlot(pos);
+        if ( slot != -1 ) live.push_back(std::make_pair(slot, ring[pos]));
+    }
+    for ( uint32_t n = 0; n < live.size(); n++ ) {
+        table[live[n].first].ring = n;
+        ring[n] = live[n].second;
+    }
+    head = 0;
+    used = live.size();
+}
+
+// Backward shift deletion, so lookups never need tombstones
+void PrefetchLineSet::remove(uint32_t slot) {
+    uint32_t i = slot;
+    uint32_t j = slot;
+    while ( true ) {
+        j = (j + 1) & mask;
+        if ( !table[j].valid ) break;
+        uint32_t k = hash(table[j].line);
+        // Entry j can't move if its home slot lies cyclically in (i, j]
+        if ( (i <= j) ? (i < k && k <= j) : (i < k || k <= j) ) continue;
+        table[i] = table[j];
+        i = j;
+    }
+    table[i].valid = false;
+}
+
+
+BasePrefetcher::BasePrefetcher(ComponentId_t id, Params& params, const std::string& name) :
+    CacheListener(id, params),
+    prefetcherName(name)
+{
+    requireLibrary("memHierarchy");
+
+    verbosity = params.find<int>("verbose", 0);
+
+    char* new_prefix = (char*) malloc(sizeof(char) * 128);
+    snprintf(new_prefix, sizeof(char)*128, "%s[%s | @f:@p:@l] ", name.c_str(), getName().c_str());
+    output = new Output(new_prefix, verbosity, 0, Output::STDOUT);
+    free(new_prefix);
+
+    blockSize = params.find<uint64_t>("cache_line_size", 64);
+    pageSize = params.find<uint64_t>("page_size", 4096);
+
+    uint32_t overrunPB = params.find<uint32_t>("overrun_page_boundaries", 0);
+    overrunPageBoundary = (overrunPB == 0) ? false : true;
+
+    prefetchHistory.init(params.find<uint32_t>("history", 16));
+
+    uint32_t tracked = params.find<uint32_t>("tracked_prefetches", 1024);
+    trackPrefetches = tracked > 0;
+    pendingPrefetches.init(tracked);
+    trackedPrefetches.init(tracked);
+
+    mshrMaxSize = -1;
+    degree = 1;
+    throttleLow = 1.0;
+    throttleHigh = 1.0;
+
+    missEventsProcessed = 0;
+    hitEventsProcessed = 0;
+    prefetchesIssued = 0;
+    prefetchesFilled = 0;
+    prefetchesUseful = 0;
+    prefetchesLate = 0;
+    prefetchesUseless = 0;
+    demandMisses = 0;
+
+    statPrefetchOpportunities = registerStatistic<uint64_t>("prefetch_opportunities");
+    statPrefetchEventsIssued = registerStatistic<uint64_t>("prefetches_issued");
+    statPrefetchIssueCanceledByPageBoundary = registerStatistic<uint64_t>("prefetches_canceled_by_page_boundary");
+    statPrefetchIssueCanceledByHistory = registerStatistic<uint64_t>("prefetches_canceled_by_history");
+    statPrefetchUseful = registerStatistic<uint64_t>("prefetches_useful");
+    statPrefetchLate = registerStatistic<uint64_t>("prefetches_late");
+    statPrefetchUseless = registerStatistic<uint64_t>("prefetches_useless");
+    statDemandMisses = registerStatistic<uint64_t>("demand_misses");
+    statPrefetchThrottled = nullptr;
+}
+
+void BasePrefetcher::initThrottle(Params& params, uint32_t defaultDegree) {
+    degree = params.find<uint32_t>("degree", defaultDegree);
+    throttleLow = params.find<double>("mshr_throttle_low", 0.25);
+    throttleHigh = params.find<double>("mshr_throttle_high", 0.75);
+
+    if ( throttleHigh <= throttleLow ) {
+        output->fatal(CALL_INFO, -1, "%s: mshr_throttle_high (%f) must be greater than mshr_throttle_low (%f)\n",
+                      getName().c_str(), throttleHigh, throttleLow);
+    }
+
+    statPrefetchThrottled = registerStatistic<uint64_t>("prefetches_throttled");
+}
+
+BasePrefetcher::~BasePrefetcher() {
+    delete output;
+}
+
+void BasePrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+
+    if ( notifyType == EVICT ) {
+        const Addr line = lineBase(notify.getPhysicalAddress());
+        if ( trackPrefetches && trackedPrefetches.erase(line) ) {
+            prefetchesUseless++;
+            statPrefetchUseless->addData(1);
+        }
+        handleEvict(line);
+        return;
+    }
+
+    // The cache reports each prefetch it accepts, as a miss if the line
+    // will be filled and as a hit if it was already cached.  Prefetches
+    // it drops are never reported and age out of the pending set.
+    if ( notifyType == PREFETCH ) {
+        const Addr line = lineBase(notify.getPhysicalAddress());
+        if ( trackPrefetches && pendingPrefetches.erase(line) && notify.getResultType() == MISS ) {
+            trackedPrefetches.insert(line);
+            prefetchesFilled++;
+        }
+        return;
+    }
+
+    if (notifyType != READ && notifyType != WRITE)
+        return;
+
+    const bool miss = notify.getResultType() == MISS;
+    miss ? missEventsProcessed++ : hitEventsProcessed++;
+
+    bool prefetched = false;
+    if ( trackPrefetches ) {
+        if ( trackedPrefetches.erase(lineBase(notify.getPhysicalAddress())) ) {
+            prefetched = true;
+            prefetchesUseful++;
+            statPrefetchUseful->addData(1);
+            if ( miss ) {
+                prefetchesLate++;
+                statPrefetchLate->addData(1);
+            }
+        } else if ( miss ) {
+            demandMisses++;
+            statDemandMisses->addData(1);
+        }
+    }
+
+    handleDemandAccess(notify, prefetched);
+}
+
+bool BasePrefetcher::issuePrefetch(Addr triggerAddr, Addr prefetchAddr) {
+    const Addr targetPrefetchAddress = lineBase(prefetchAddr);
+
+    // If the address we found and the prefetch address are on the same
+    // page we can safely prefetch without causing a page fault,
+    // otherwise we choose to not prefetch the address
+    if ( !overrunPageBoundary ) {
+        const Addr targetAddressPhysPage = triggerAddr / pageSize;
+        const Addr targetPrefetchAddressPage = targetPrefetchAddress / pageSize;
+
+        if ( targetAddressPhysPage != targetPrefetchAddressPage ) {
+            output->verbose(CALL_INFO, 2, 0, "Cancel prefetch issue, request exceeds physical page limit\n");
+            output->verbose(CALL_INFO, 4, 0, "Target address: %" PRIx64 ", page=%" PRIx64 ", Prefetch address: %" PRIx64 ", page=%" PRIx64 "\n",
+                            triggerAddr, targetAddressPhysPage, targetPrefetchAddress, targetPrefetchAddressPage);
+            statPrefetchIssueCanceledByPageBoundary->addData(1);
+            return false;
+        }
+    }
+
+    output->verbose(CALL_INFO, 2, 0, "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 "\n",
+                    triggerAddr, targetPrefetchAddress);
+    statPrefetchOpportunities->addData(1);
+
+    if ( prefetchHistory.contains(targetPrefetchAddress) ) {
+        statPrefetchIssueCanceledByHistory->addData(1);
+        output->verbose(CALL_INFO, 2, 0, "Prefetch canceled - same cache line is found in the recent prefetch history.\n");
+        return false;
+    }
+
+    prefetchHistory.insert(targetPrefetchAddress);
+    if ( trackPrefetches ) pendingPrefetches.insert(targetPrefetchAddress);
+
+    prefetchesIssued++;
+    statPrefetchEventsIssued->addData(1);
+
+    // Cycle over each registered call back and notify them that we want to issue a prefetch request
+    for ( auto callback : registeredCallbacks ) {
+        // Create a new read request, we cannot issue a write because the data will get
+        // overwritten and corrupt memory (even if we really do want to do a write)
+        MemEvent* newEv = new MemEvent(getName(), targetPrefetchAddress, targetPrefetchAddress, Command::GetS);
+        newEv->setSize(blockSize);
+        newEv->setPrefetchFlag(true);
+
+        (*callback)(newEv);
+    }
+    return true;
+}
+
+uint32_t BasePrefetcher::getThrottledDegree() {
+    if ( !mshrOccupancy || mshrMaxSize <= 0 ) return degree;
+
+    const double fill = (double) mshrOccupancy() / mshrMaxSize;
+    uint32_t allowed = degree;
+    if ( fill >= throttleHigh ) {
+        allowed = 0;
+    } else if ( fill > throttleLow ) {
+        allowed = (uint32_t)(degree * (throttleHigh - fill) / (throttleHigh - throttleLow));
+        if ( allowed == 0 ) allowed = 1;
+    }
+
+    if ( allowed < degree ) {
+        output->verbose(CALL_INFO, 3, 0, "MSHR %.2f full, degree throttled from %" PRIu32 " to %" PRIu32 "\n",
+                        fill, degree, allowed);
+        if ( statPrefetchThrottled ) statPrefetchThrottled->addData(degree - allowed);
+    }
+    return allowed;
+}
+
+void BasePrefetcher::registerResponseCallback(Event::HandlerBase* handler) {
+    registeredCallbacks.push_back(handler);
+}
+
+void BasePrefetcher::registerMSHROccupancy(std::function<int()> occupancy, int maxSize) {
+    mshrOccupancy = occupancy;
+    mshrMaxSize = maxSize;
+}
+
+// Accuracy is the fraction of filled prefetches that a demand request
+// used, coverage the fraction of would-be misses that a prefetch removed
+void BasePrefetcher::printStats(Output& UNUSED(out)) {
+    if ( !trackPrefetches || prefetchesFilled == 0 ) return;
+
+    const uint64_t covered = prefetchesUseful + demandMisses;
+    output->verbose(CALL_INFO, 1, 0, "%s: issued %" PRIu64 ", filled %" PRIu64 ", useful %" PRIu64 " (%" PRIu64 " late), useless %" PRIu64 ", accuracy %.2f%%, coverage %.2f%%\n",
+                    prefetcherName.c_str(), prefetchesIssued, prefetchesFilled, prefetchesUseful, prefetchesLate, prefetchesUseless,
+                    100.0 * prefetchesUseful / prefetchesFilled,
+                    covered == 0 ? 0.0 : 100.0 * prefetchesUseful / covered);
+}
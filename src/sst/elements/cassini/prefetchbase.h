@@ -0,0 +1,306 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CASSINI_PREFETCH_BASE
+#define _H_SST_CASSINI_PREFETCH_BASE
+
+#include <stdint.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/subcomponent.h>
+#include <sst/core/output.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Parameters and statistics shared by every prefetcher built on
+ * BasePrefetcher.  Derived classes list these first in their own
+ * SST_ELI_DOCUMENT_PARAMS/STATISTICS.
+ */
+#define CASSINI_PREFETCHER_ELI_PARAMS \
+    { "verbose", "Controls the verbosity of the Cassini component", "0" },\
+    { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" },\
+    { "history", "Number of recently issued prefetches to remember, a prefetch to a line in the history is dropped", "16" },\
+    { "page_size", "Page size for this controller", "4096" },\
+    { "overrun_page_boundaries", "Allow prefetcher to run over page boundaries, 0 is no, 1 is yes", "0" },\
+    { "tracked_prefetches", "Number of issued prefetches to follow for the accuracy and coverage statistics, 0 disables tracking", "1024" }
+
+#define CASSINI_PREFETCHER_ELI_STATS \
+    { "prefetches_issued", "Number of prefetch requests issued", "prefetches", 1 },\
+    { "prefetches_canceled_by_page_boundary",\
+        "Prefetches which would not be executed because they span over a page boundary.", "prefetches", 1 },\
+    { "prefetches_canceled_by_history",\
+        "Prefetches which did not get issued because of a prefetch history in the table", "prefetches", 1 },\
+    { "prefetch_opportunities", "Count of opportunities to prefetch", "prefetches", 1 },\
+    { "prefetches_useful", "Prefetched lines that were later accessed by a demand request", "prefetches", 2 },\
+    { "prefetches_late", "Useful prefetches whose demand request still missed because the prefetch had not returned", "prefetches", 2 },\
+    { "prefetches_useless", "Prefetched lines that were evicted before any demand request accessed them", "prefetches", 2 },\
+    { "demand_misses", "Demand misses to lines that were not prefetched", "misses", 2 }
+
+/*
+ * Prefetchers that issue several lines per trigger scale their degree
+ * down as the cache's MSHR fills.  Each documents its own "degree".
+ */
+#define CASSINI_PREFETCHER_THROTTLE_ELI_PARAMS \
+    { "mshr_throttle_low", "MSHR fill fraction below which the full degree is used", "0.25" },\
+    { "mshr_throttle_high", "MSHR fill fraction at and above which no prefetches are issued", "0.75" }
+
+#define CASSINI_PREFETCHER_THROTTLE_ELI_STATS \
+    { "prefetches_throttled", "Prefetches not issued because the cache's MSHR was busy", "prefetches", 1 }
+
+
+/*
+ * Fixed capacity set of line addresses which forgets its oldest entry
+ * when full.  Lookup, insert and erase are all (amortized) constant
+ * time: lines are kept in a FIFO ring and found through an open
+ * addressed (linear probing) table.  Erased lines leave holes in the
+ * ring, which is twice the capacity so they can be compacted in bulk.
+ */
+class PrefetchLineSet {
+public:
+    PrefetchLineSet() : capacity(0), head(0), used(0), count(0), mask(0) {}
+
+    void init(uint32_t entries);
+
+    bool contains(Addr line) const { return find(line) != -1; }
+
+    // Adds line, dropping the oldest line if the set is full
+    void insert(Addr line);
+
+    // Returns true if line was in the set
+    bool erase(Addr line);
+
+private:
+    struct Slot {
+        Addr line;
+        uint32_t ring;   // Position of the line in the FIFO ring
+        bool valid;
+    };
+
+    uint32_t capacity;
+    uint32_t head;
+    uint32_t used;      // Ring positions in use, including erased lines
+    uint32_t count;     // Lines in the set
+    uint32_t mask;
+    std::vector<Addr> ring;
+    std::vector<Slot> table;
+
+    inline uint32_t hash(Addr line) const {
+        return (uint32_t)((line * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+    }
+
+    int64_t find(Addr line) const;
+    int64_t liveSlot(uint32_t pos) const;
+    void remove(uint32_t slot);
+    void compact();
+};
+
+
+/*
+ * Small set associative table with LRU replacement within a set.  Used
+ * by the prefetchers to hold per stream state.  The number of ways is
+ * fixed, so a lookup costs the same no matter how large the table is.
+ */
+template<typename T>
+class PrefetchTable {
+public:
+    PrefetchTable() : ways(1), setMask(0), useCount(0) {}
+
+    void init(uint32_t entries, uint32_t assoc) {
+        ways = assoc == 0 ? 1 : assoc;
+        uint32_t sets = 1;
+        while ( sets * ways < entries ) sets <<= 1;
+        setMask = sets - 1;
+        slots.assign(sets * ways, Slot());
+    }
+
+    // Returns the entry for key or nullptr if it is not in the table
+    T* find(uint64_t key) {
+        Slot* set = getSet(key);
+        for ( uint32_t i = 0; i < ways; ++i ) {
+            if ( set[i].valid && set[i].key == key ) {
+                set[i].lastUse = ++useCount;
+                return &set[i].data;
+            }
+        }
+        return nullptr;
+    }
+
+    // Replaces the least recently used entry in the set for key with
+    // a default constructed entry and returns it.  replaced is set if
+    // a valid entry was replaced, and the replaced entry is copied to
+    // old if it is given.
+    T* allocate(uint64_t key, bool* replaced = nullptr, T* old = nullptr) {
+        Slot* set = getSet(key);
+        Slot* victim = &set[0];
+        for ( uint32_t i = 0; i < ways; ++i ) {
+            if ( !set[i].valid ) {
+                victim = &set[i];
+                break;
+            }
+            if ( set[i].lastUse < victim->lastUse ) victim = &set[i];
+        }
+        if ( replaced ) *replaced = victim->valid;
+        if ( victim->valid && old ) *old = victim->data;
+        victim->valid = true;
+        victim->key = key;
+        victim->lastUse = ++useCount;
+        victim->data = T();
+        return &victim->data;
+    }
+
+    // Returns true if key was in the table
+    bool erase(uint64_t key) {
+        Slot* set = getSet(key);
+        for ( uint32_t i = 0; i < ways; ++i ) {
+            if ( set[i].valid && set[i].key == key ) {
+                set[i].valid = false;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Slot {
+        Slot() : key(0), lastUse(0), valid(false) {}
+        uint64_t key;
+        uint64_t lastUse;
+        bool valid;
+        T data;
+    };
+
+    uint32_t ways;
+    uint32_t setMask;
+    uint64_t useCount;
+    std::vector<Slot> slots;
+
+    inline Slot* getSet(uint64_t key) {
+        uint32_t set = (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & setMask;
+        return &slots[set * ways];
+    }
+};
+
+
+/*
+ * Common base for the cassini prefetchers.  Handles the response
+ * callbacks, the page boundary and history checks when issuing a
+ * prefetch, and follows each prefetch the cache fills so the accuracy
+ * and coverage of the prefetcher can be reported.  Prefetches the cache
+ * drops, or that find the line already cached, are not followed.
+ *
+ * Derived classes implement handleDemandAccess(), which is called for
+ * every read and write the cache sees, and call issuePrefetch() for
+ * each line they want.  Prefetchers that issue several lines at once
+ * can use getThrottledDegree() to back off while the cache's MSHR is
+ * busy.
+ */
+class BasePrefetcher : public SST::MemHierarchy::CacheListener {
+public:
+    BasePrefetcher(ComponentId_t id, Params& params, const std::string& name);
+    virtual ~BasePrefetcher();
+
+    void notifyAccess(const CacheListenerNotification& notify) override;
+    void registerResponseCallback(Event::HandlerBase *handler) override;
+    void printStats(Output &out) override;
+    void registerMSHROccupancy(std::function<int()> occupancy, int maxSize) override;
+
+protected:
+    // prefetched is true if the access is the first demand access to
+    // a line this prefetcher brought in (always false when
+    // tracked_prefetches is 0)
+    virtual void handleDemandAccess(const CacheListenerNotification& notify, bool prefetched) = 0;
+
+    // Called when the cache evicts a line
+    virtual void handleEvict(Addr UNUSED(addr)) {}
+
+    // Prefetch the line holding prefetchAddr.  triggerAddr is the
+    // demand address that led to the prefetch and is used for the page
+    // boundary check.  Returns true if the prefetch was sent.
+    bool issuePrefetch(Addr triggerAddr, Addr prefetchAddr);
+
+    // Reads the throttle parameters, only needed by prefetchers that
+    // call getThrottledDegree()
+    void initThrottle(Params& params, uint32_t defaultDegree);
+
+    // Number of prefetches that may be issued for the current access,
+    // from the full degree while the MSHR is mostly empty down to zero
+    // once it is mshr_throttle_high full.  Records the difference in
+    // prefetches_throttled.
+    uint32_t getThrottledDegree();
+
+    inline Addr lineBase(Addr addr) const { return addr - (addr % blockSize); }
+
+    Output* output;
+    std::string prefetcherName;
+    uint32_t verbosity;
+
+    uint64_t blockSize;
+    uint64_t pageSize;
+    bool overrunPageBoundary;
+
+    uint64_t missEventsProcessed;
+    uint64_t hitEventsProcessed;
+
+private:
+    std::vector<Event::HandlerBase*> registeredCallbacks;
+
+    // Recently issued prefetches, used to drop duplicates
+    PrefetchLineSet prefetchHistory;
+    // Issued prefetches the cache has not yet accepted or dropped
+    PrefetchLineSet pendingPrefetches;
+    // Accepted prefetches that have not yet been used or evicted
+    PrefetchLineSet trackedPrefetches;
+    bool trackPrefetches;
+
+    std::function<int()> mshrOccupancy;
+    int mshrMaxSize;
+    uint32_t degree;
+    double throttleLow;
+    double throttleHigh;
+
+    uint64_t prefetchesIssued;
+    uint64_t prefetchesFilled;
+    uint64_t prefetchesUseful;
+    uint64_t prefetchesLate;
+    uint64_t prefetchesUseless;
+    uint64_t demandMisses;
+
+    Statistic<uint64_t>* statPrefetchOpportunities;
+    Statistic<uint64_t>* statPrefetchEventsIssued;
+    Statistic<uint64_t>* statPrefetchIssueCanceledByPageBoundary;
+    Statistic<uint64_t>* statPrefetchIssueCanceledByHistory;
+    Statistic<uint64_t>* statPrefetchUseful;
+    Statistic<uint64_t>* statPrefetchLate;
+    Statistic<uint64_t>* statPrefetchUseless;
+    Statistic<uint64_t>* statDemandMisses;
+    Statistic<uint64_t>* statPrefetchThrottled;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
@@ -0,0 +1,143 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "spatialprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::Cassini;
+
+void SpatialPrefetcher::handleDemandAccess(const CacheListenerNotification& notify, bool UNUSED(prefetched)) {
+    const Addr addr = notify.getPhysicalAddress();
+    const Addr ip = notify.getInstructionPointer();
+    const Addr region = addr / regionSize;
+    const uint32_t offset = (addr % regionSize) / blockSize;
+
+    ActiveRegion* entry = activeRegions.find(region);
+    if ( entry != nullptr ) {
+        entry->footprint |= (uint64_t)1 << offset;
+        return;
+    }
+
+    // Trigger access, predict the footprint from an earlier generation
+    statRegionTriggers->addData(1);
+
+    uint64_t* pattern = addressPatterns.find(addressEvent(ip, region));
+    if ( pattern != nullptr ) {
+        statPatternHitsAddress->addData(1);
+    } else {
+        pattern = offsetPatterns.find(offsetEvent(ip, offset));
+        if ( pattern != nullptr ) statPatternHitsOffset->addData(1);
+    }
+    if ( pattern != nullptr ) {
+        prefetchFootprint(addr, region, offset, *pattern);
+    }
+
+    // Start recording, ending the generation of the region it replaces
+    bool replaced = false;
+    ActiveRegion victim;
+    entry = activeRegions.allocate(region, &replaced, &victim);
+    entry->region = region;
+    entry->ip = ip;
+    entry->footprint = (uint64_t)1 << offset;
+    entry->triggerOffset = offset;
+
+    if ( replaced ) endGeneration(victim);
+}
+
+void SpatialPrefetcher::handleEvict(Addr addr) {
+    const Addr region = addr / regionSize;
+    ActiveRegion* entry = activeRegions.find(region);
+    if ( entry == nullptr ) return;
+
+    ActiveRegion ended = *entry;
+    activeRegions.erase(region);
+    endGeneration(ended);
+}
+
+void SpatialPrefetcher::endGeneration(const ActiveRegion& entry) {
+    // A footprint of just the trigger has nothing to prefetch
+    if ( entry.footprint == ((uint64_t)1 << entry.triggerOffset) ) return;
+
+    output->verbose(CALL_INFO, 3, 0, "Region %" PRIx64 " generation ended, footprint %" PRIx64 "\n",
+                    entry.region * regionSize, entry.footprint);
+
+    uint64_t* pattern = addressPatterns.find(addressEvent(entry.ip, entry.region));
+    if ( pattern == nullptr ) pattern = addressPatterns.allocate(addressEvent(entry.ip, entry.region));
+    *pattern = entry.footprint;
+
+    pattern = offsetPatterns.find(offsetEvent(entry.ip, entry.triggerOffset));
+    if ( pattern == nullptr ) pattern = offsetPatterns.allocate(offsetEvent(entry.ip, entry.triggerOffset));
+    *pattern = entry.footprint;
+}
+
+void SpatialPrefetcher::prefetchFootprint(Addr triggerAddr, Addr region, uint32_t triggerOffset, uint64_t footprint) {
+    const uint32_t allowed = getThrottledDegree();
+    const Addr regionBase = region * regionSize;
+    uint32_t issued = 0;
+
+    // Closest lines first, alternating forward and backward
+    for ( uint32_t distance = 1; distance < regionLines && issued < allowed; ++distance ) {
+        uint32_t ahead = triggerOffset + distance;
+        if ( ahead < regionLines && (footprint & ((uint64_t)1 << ahead)) ) {
+            if ( issuePrefetch(triggerAddr, regionBase + ahead * blockSize) ) issued++;
+        }
+        if ( distance <= triggerOffset && issued < allowed ) {
+            uint32_t behind = triggerOffset - distance;
+            if ( footprint & ((uint64_t)1 << behind) ) {
+                if ( issuePrefetch(triggerAddr, regionBase + behind * blockSize) ) issued++;
+            }
+        }
+    }
+}
+
+
+SpatialPrefetcher::SpatialPrefetcher(ComponentId_t id, Params& params) : BasePrefetcher(id, params, "SpatialPrefetcher") {
+    initThrottle(params, 32);
+
+    regionSize = params.find<uint64_t>("region_size", 2048);
+    if ( regionSize < blockSize || regionSize % blockSize != 0 || regionSize / blockSize > 64 ) {
+        output->fatal(CALL_INFO, -1, "%s: region_size (%" PRIu64 ") must be a multiple of cache_line_size (%" PRIu64 ") and at most 64 lines\n",
+                      getName().c_str(), regionSize, blockSize);
+    }
+    regionLines = regionSize / blockSize;
+
+    uint32_t ways = params.find<uint32_t>("table_ways", 4);
+    activeRegions.init(params.find<uint32_t>("active_regions", 64), ways);
+    uint32_t patterns = params.find<uint32_t>("pattern_entries", 1024);
+    addressPatterns.init(patterns, ways);
+    offsetPatterns.init(patterns, ways);
+
+    statRegionTriggers = registerStatistic<uint64_t>("region_triggers");
+    statPatternHitsAddress = registerStatistic<uint64_t>("pattern_hits_address");
+    statPatternHitsOffset = registerStatistic<uint64_t>("pattern_hits_offset");
+
+    output->verbose(CALL_INFO, 1, 0, "SpatialPrefetcher created, cache line: %" PRIu64 ", region size: %" PRIu64 "\n",
+        blockSize, regionSize);
+}
+
+SpatialPrefetcher::~SpatialPrefetcher() {
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// S. Somogyi, T. F. Wenisch, A. Ailamaki, B. Falsafi and A. Moshovos. 2006. Spatial memory streaming.
+/// In Proceedings of the 33rd annual international symposium on Computer architecture (ISCA '06). 252-263.
+///
+/// M. Bakhshalipour, M. Shakerinava, P. Lotfi-Kamran and H. Sarbazi-Azad. 2019. Bingo spatial data
+/// prefetcher. In Proceedings of the 2019 IEEE International Symposium on High Performance Computer
+/// Architecture (HPCA '19). 399-411.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,121 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_SPATIAL_PREFETCH
+#define _H_SST_SPATIAL_PREFETCH
+
+#include <vector>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/output.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+#include "prefetchbase.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace std;
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Spatial footprint prefetcher in the style of SMS [Somogyi 2006] and
+ * Bingo [Bakhshalipour 2019].  Memory is divided into regions.  The
+ * first access to a region (the trigger) starts a generation, and
+ * every line touched until one of the region's lines is evicted is
+ * recorded in a bit vector footprint.  When the generation ends the
+ * footprint is stored under two events: the trigger's instruction
+ * pointer plus region address, and its instruction pointer plus offset
+ * in the region.  A later trigger looks up the longer, more precise
+ * event first and falls back to the shorter one, then prefetches the
+ * lines of the footprint nearest the trigger first.
+ *
+ * All three tables are set associative with a fixed size.
+ */
+class SpatialPrefetcher : public BasePrefetcher {
+public:
+    SpatialPrefetcher(ComponentId_t id, Params& params);
+    ~SpatialPrefetcher();
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        SpatialPrefetcher,
+            "cassini",
+            "SpatialPrefetcher",
+            SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Spatial footprint prefetcher [SMS/Bingo]",
+            SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        CASSINI_PREFETCHER_ELI_PARAMS,
+        CASSINI_PREFETCHER_THROTTLE_ELI_PARAMS,
+        { "degree", "Largest number of lines prefetched for one trigger", "32" },
+        { "region_size", "Size of a spatial region in bytes, at most 64 cache lines", "2048" },
+        { "active_regions", "Number of regions whose footprint can be recorded at once", "64" },
+        { "pattern_entries", "Number of footprints kept for each kind of event", "1024" },
+        { "table_ways", "Associativity of the region and footprint tables", "4" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        CASSINI_PREFETCHER_ELI_STATS,
+        CASSINI_PREFETCHER_THROTTLE_ELI_STATS,
+        { "region_triggers", "Accesses which started a new region generation", "accesses", 1 },
+        { "pattern_hits_address", "Triggers whose footprint was found by instruction pointer and region address", "accesses", 1 },
+        { "pattern_hits_offset", "Triggers whose footprint was found by instruction pointer and region offset only", "accesses", 1 }
+    )
+
+protected:
+    void handleDemandAccess(const CacheListenerNotification& notify, bool prefetched) override;
+    void handleEvict(Addr addr) override;
+
+private:
+    struct ActiveRegion {
+        ActiveRegion() : region(0), ip(0), footprint(0), triggerOffset(0) {}
+        Addr region;
+        Addr ip;
+        uint64_t footprint;
+        uint32_t triggerOffset;
+    };
+
+    void endGeneration(const ActiveRegion& entry);
+    void prefetchFootprint(Addr triggerAddr, Addr region, uint32_t triggerOffset, uint64_t footprint);
+
+    inline uint64_t addressEvent(Addr ip, Addr region) const {
+        return (ip * 0x9E3779B97F4A7C15ULL) ^ region;
+    }
+    inline uint64_t offsetEvent(Addr ip, uint32_t offset) const {
+        return (ip * 0x9E3779B97F4A7C15ULL) ^ offset;
+    }
+
+    PrefetchTable<ActiveRegion> activeRegions;
+    PrefetchTable<uint64_t> addressPatterns;
+    PrefetchTable<uint64_t> offsetPatterns;
+
+    uint64_t regionSize;
+    uint32_t regionLines;
+
+    Statistic<uint64_t>* statRegionTriggers;
+    Statistic<uint64_t>* statPatternHitsAddress;
+    Statistic<uint64_t>* statPatternHitsOffset;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
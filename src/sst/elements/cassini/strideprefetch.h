@@ -29,6 +29,8 @@
 
 #include <sst/core/output.h>
 
+#include "prefetchbase.h"
+
 using namespace SST;
 using namespace SST::MemHierarchy;
 using namespace std;
@@ -36,68 +38,54 @@ using namespace std;
 namespace SST {
 namespace Cassini {
 
-class StridePrefetcher : public SST::MemHierarchy::CacheListener {
+/*
+ * Reference prediction table (Chen and Baer) style stride prefetcher.
+ * Accesses are grouped into streams by instruction pointer when the
+ * cache provides one, otherwise by page.  Each stream remembers its
+ * last address and stride, and once the same stride has been seen
+ * detect_range times in a row the prefetcher fetches reach strides
+ * ahead.  All of the work for an access is a single table lookup.
+ */
+class StridePrefetcher : public BasePrefetcher {
 public:
     StridePrefetcher(ComponentId_t id, Params& params);
     ~StridePrefetcher();
 
-    void notifyAccess(const CacheListenerNotification& notify);
-    void registerResponseCallback(Event::HandlerBase *handler);
-    void printStats(Output &out);
-
     SST_ELI_REGISTER_SUBCOMPONENT(
         StridePrefetcher,
             "cassini",
             "StridePrefetcher",
-            SST_ELI_ELEMENT_VERSION(1,0,0),
+            SST_ELI_ELEMENT_VERSION(1,1,0),
             "Stride Detection Prefetcher",
             SST::MemHierarchy::CacheListener
     )
 
     SST_ELI_DOCUMENT_PARAMS(
-        { "verbose", "Controls the verbosity of the Cassini component", "0" },
-            { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" },
-        { "history", "Number of entries to keep for historical comparison", "16" },
-        { "reach", "Reach (how far forward the prefetcher should fetch lines)", "2" },
-        { "detect_range", "Range to detect addresses over in request counts", "4" },
-        { "address_count", "Number of addresses to keep in prefetch table", "64" },
-        { "page_size", "Page size for this controller", "4096" },
-        { "overrun_page_boundaries", "Allow prefetcher to run over page boundaries, 0 is no, 1 is yes", "0" }
+        CASSINI_PREFETCHER_ELI_PARAMS,
+        { "reach", "Reach (how far forward the prefetcher should fetch lines, in strides)", "2" },
+        { "detect_range", "Number of times in a row a stream must repeat its stride before it is prefetched", "4" },
+        { "address_count", "Number of streams to keep in the stride table", "64" },
+        { "table_ways", "Associativity of the stride table", "4" }
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
-            { "prefetches_issued", "Number of prefetch requests issued", "prefetches", 1 },
-        { "prefetches_canceled_by_page_boundary",
-                "Prefetches which would not be executed because they span over a page boundary.", "prefetches", 1 },
-        { "prefetches_canceled_by_history",
-                "Prefetches which did not get issued because of a prefetch history in the table", "prefetches", 1 },
-        { "prefetch_opportunities", "Count of opportunities to prefetch", "prefetches", 1 }
+        CASSINI_PREFETCHER_ELI_STATS
     )
 
+protected:
+    void handleDemandAccess(const CacheListenerNotification& notify, bool prefetched) override;
+
 private:
-    Output* output;
-    std::vector<Event::HandlerBase*> registeredCallbacks;
-    std::deque<uint64_t>* prefetchHistory;
-    uint32_t prefetchHistoryCount;
-    uint64_t blockSize;
-    bool overrunPageBoundary;
-    uint64_t pageSize;
-    Addr* recentAddrList;
-    uint32_t recentAddrListCount;
-    uint32_t nextRecentAddressIndex;
-    void DetectStride();
+    struct StrideEntry {
+        StrideEntry() : lastAddress(0), stride(0), confidence(0) {}
+        Addr lastAddress;
+        int64_t stride;
+        uint32_t confidence;
+    };
+
+    PrefetchTable<StrideEntry> strideTable;
     uint32_t strideDetectionRange;
     uint32_t strideReach;
-    Addr getAddressByIndex(uint32_t index);
-    uint32_t recheckCountdown;
-    uint64_t missEventsProcessed;
-    uint64_t hitEventsProcessed;
-    uint32_t verbosity;
-
-    Statistic<uint64_t>* statPrefetchOpportunities;
-    Statistic<uint64_t>* statPrefetchEventsIssued;
-    Statistic<uint64_t>* statPrefetchIssueCanceledByPageBoundary;
-    Statistic<uint64_t>* statPrefetchIssueCanceledByHistory;
 };
 
 } //namespace Cassini
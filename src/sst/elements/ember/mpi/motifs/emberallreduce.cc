@@ -33,8 +33,10 @@ EmberAllreduceGenerator::EmberAllreduceGenerator(SST::ComponentId_t id,
 	m_iterations = (uint32_t) params.find("arg.iterations", 1);
 	m_compute    = (uint32_t) params.find("arg.compute", 0);
 	m_count      = (uint32_t) params.find("arg.count", 1);
+    m_verify     = params.find<bool>("arg.verify",true);
 	if ( params.find<bool>("arg.doUserFunc", false )  )   {
 		m_op = op_create( test, 0 );
+		m_verify = false;
 	} else {
 		m_op = Hermes::MP::SUM;
 	}
@@ -49,12 +51,25 @@ bool EmberAllreduceGenerator::generate( std::queue<EmberEvent*>& evQ) {
             output( "%s: ranks %d, loop %d, %d double(s), latency %.3f us\n",
                     getMotifName().c_str(), size(), m_iterations, m_count, latency * 1000000.0  );
         }
+
+		// element j of rank r's send buffer is r + j, so the sum over all ranks is exact
+		if ( m_verify ) {
+			for ( int j = 0; j < m_count; j++ ) {
+				double expected = (double) size() * (size() - 1) / 2 + (double) size() * j;
+				if ( expected != ((double*)m_recvBuf)[j] ) {
+					printf("Error: Rank %d index %d failed  got=%f expected=%f\n",rank(),j, ((double*)m_recvBuf)[j], expected );
+				}
+			}
+		}
         return true;
     }
     if ( 0 == m_loopIndex ) {
 		memSetBacked();
 		m_sendBuf = memAlloc(sizeofDataType(DOUBLE)*m_count);
 		m_recvBuf = memAlloc(sizeofDataType(DOUBLE)*m_count);
+		for ( int j = 0; j < m_count; j++ ) {
+			((double*)m_sendBuf)[j] = rank() + j;
+		}
         enQ_getTime( evQ, &m_startTime );
     }
 
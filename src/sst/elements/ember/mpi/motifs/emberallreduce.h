@@ -39,6 +39,7 @@ public:
         {   "arg.compute",      "Sets the time spent computing",        "1"},
         {   "arg.count",        "Sets the number of elements to reduce",        "1"},
         {   "arg.doUserFunc",   "Test reduce operation",        "false"},
+        {   "arg.verify",       "Verify the reduced data (ignored with doUserFunc)",    "true" },
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -79,6 +80,7 @@ private:
     void*    m_recvBuf;
     uint32_t m_loopIndex;
 	_ReductionOperation* m_op;
+    bool     m_verify;
 };
 
 }
@@ -103,6 +103,12 @@ hermesParams = {
     #"hermesParams.functionSM.smallCollectiveVN" : 1,
     #"hermesParams.functionSM.smallCollectiveSize" : 8,
 
+    #"hermesParams.functionSM.Allreduce.algorithm" : "tree",
+    #"hermesParams.functionSM.Allreduce.algorithm_table.0" : "0-4096:recursive_doubling",
+    #"hermesParams.functionSM.Allreduce.algorithm_table.1" : "65536-:ring",
+    #"hermesParams.functionSM.Allgather.algorithm" : "bruck",
+    #"hermesParams.functionSM.Alltoallv.algorithm" : "pairwise",
+
     #"hermesParams.ctrlMsg.rendezvousVN" : 1,
     #"hermesParams.ctrlMsg.ackVN" : 1,
 
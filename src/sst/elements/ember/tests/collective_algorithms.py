@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Compares the collective algorithms in firefly's function state machines.
+#
+# Runs one collective motif on a dragonfly and rank 0 prints the average
+# latency. The defaults (tree for Allreduce, bruck for Allgather, pairwise
+# for Alltoall) are the algorithms firefly has always used, so sweeping
+# --algorithm against them validates the others, e.g.
+#
+#   for alg in tree ring recursive_doubling; do
+#     for count in 1 128 16384 131072; do
+#       sst collective_algorithms.py --model-options="--collective Allreduce --algorithm $alg --count $count"
+#     done
+#   done
+#
+# --table adds algorithm_table entries, "<bytes>[:<ranks>]:<algorithm>",
+# that are tried in order before --algorithm.
+#
+# The Allreduce and Allgather motifs verify their results by default and
+# print an "Error:" line per bad element; testsuite_default_ember_collectives.py
+# runs the ring and recursive_doubling algorithms this way.
+
+import sst
+import argparse
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+from sst.ember import *
+
+algorithms = {
+    "Allreduce" : ("Allreduce", ["tree", "ring", "recursive_doubling"]),
+    "Allgather" : ("Allgather", ["bruck", "ring", "recursive_doubling"]),
+    "Alltoall" : ("Alltoallv", ["pairwise", "bruck"]),
+}
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--collective", default="Allreduce", choices=sorted(algorithms.keys()), help="motif to run")
+parser.add_argument("--algorithm", default=None, help="algorithm to use, defaults to the one firefly has always used")
+parser.add_argument("--table", action="append", default=[], help="algorithm_table entry, may be repeated")
+parser.add_argument("--count", type=int, default=1, help="doubles per rank for Allreduce, ints per rank for Allgather, bytes per pair for Alltoall")
+parser.add_argument("--iterations", type=int, default=10, help="collectives to time")
+parser.add_argument("--groups", type=int, default=4, help="dragonfly groups, 16 ranks each")
+args = parser.parse_args()
+
+func, names = algorithms[args.collective]
+if args.algorithm is not None and args.algorithm not in names:
+    parser.error("--algorithm for %s must be one of %s" % (args.collective, ", ".join(names)))
+
+if __name__ == "__main__":
+
+    PlatformDefinition.setCurrentPlatform("firefly-defaults")
+
+    ### Setup the topology
+    topo = topoDragonFly()
+    topo.hosts_per_router = 2
+    topo.routers_per_group = 8
+    topo.intergroup_links = 2
+    topo.num_groups = args.groups
+    topo.algorithm = ["minimal","adaptive-local"]
+
+    # Set up the routers
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 2
+    router.xbar_arb = "merlin.xbar_arb_lru"
+
+    topo.router = router
+    topo.link_latency = "20ns"
+
+    ### set up the endpoint
+    networkif = ReorderLinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "1kB"
+    networkif.output_buf_size = "1kB"
+
+    ep = EmberMPIJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+
+    functionsm = getattr(ep.os.functionsm, func)
+    if args.algorithm is not None:
+        functionsm.algorithm = args.algorithm
+    for i, entry in enumerate(args.table):
+        setattr(functionsm.algorithm_table, str(i), entry)
+
+    size = "bytes" if args.collective == "Alltoall" else "count"
+    ep.addMotif("Init")
+    ep.addMotif("%s iterations=%d %s=%d" % (args.collective, args.iterations, size, args.count))
+    ep.addMotif("Fini")
+    ep.nic.nic2host_lat= "100ns"
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
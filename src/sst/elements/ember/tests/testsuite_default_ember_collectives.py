@@ -0,0 +1,125 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+import re
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        try:
+            # Put your single instance Init Code Here
+            pass
+        except:
+            pass
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+# Runs the collective algorithms that firefly added besides its defaults
+# (see collective_algorithms.py) with the motifs' data verification on.
+# 3 dragonfly groups give 48 ranks, so the non power of two paths are
+# used. Allgather recursive_doubling falls back to bruck on 48 ranks, so it
+# runs on 4 groups (64 ranks). count 1 leaves most ring chunks empty, 600
+# gives every rank data. The Alltoall motif sends the same number of bytes
+# to every rank, which is the case bruck handles, but it doesn't verify its
+# data, so that test only checks that every iteration completes.
+
+class testcase_EmberCollectives(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_Ember_Allreduce_ring(self):
+        self.Ember_collective_template("Allreduce", "ring")
+
+    def test_Ember_Allreduce_recursive_doubling(self):
+        self.Ember_collective_template("Allreduce", "recursive_doubling")
+
+    def test_Ember_Allgather_ring(self):
+        self.Ember_collective_template("Allgather", "ring")
+
+    def test_Ember_Allgather_recursive_doubling(self):
+        self.Ember_collective_template("Allgather", "recursive_doubling", groups = 4)
+
+    def test_Ember_Alltoall_bruck(self):
+        self.Ember_collective_template("Alltoall", "bruck")
+
+    def test_Ember_Allreduce_ring_vs_tree(self):
+        # For a large buffer the ring sends 2*(size-1)/size of it per rank,
+        # while the binary tree passes the whole buffer up and down every level
+        count = 16384
+        ring = self.Ember_collective_template("Allreduce", "ring", groups = 4, counts = [count], testtimeout = 600)
+        tree = self.Ember_collective_template("Allreduce", "tree", groups = 4, counts = [count], testtimeout = 600)
+        self.assertTrue(ring[count] <= tree[count], "Allreduce ring with count {0} took {1} us, longer than tree's {2} us".format(
+            count, ring[count], tree[count]))
+
+#####
+
+    # Returns the latency rank 0 reports for each count, in us
+    def Ember_collective_template(self, collective, algorithm, groups = 3, counts = [1, 600], testtimeout = 120):
+
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        sdlfile = "{0}/collective_algorithms.py".format(test_path)
+        ranks = groups * 16
+        latency = {}
+
+        for count in counts:
+            testDataFileName = "test_Ember_{0}_{1}_{2}".format(collective, algorithm, count)
+
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+            otherargs = '--model-options=\"--collective {0} --algorithm {1} --count {2} --iterations 2 --groups {3}\"'.format(
+                collective, algorithm, count, groups)
+
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles,
+                         timeout_sec=testtimeout)
+
+            if os_test_file(errfile, "-s"):
+                log_testing_note("Ember collective test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+            with open(outfile, 'r') as f:
+                output = f.read()
+
+            # Every rank checks its own result and prints an Error line on a mismatch
+            errors = re.findall("^.*Error: Rank.*$", output, re.MULTILINE)
+            self.assertEqual(len(errors), 0, "{0} {1} with count {2} returned wrong data:\n{3}".format(
+                collective, algorithm, count, "\n".join(errors[:10])))
+
+            # Rank 0 reports the average latency once all iterations finish
+            done = "{0}: ranks {1}, loop 2,".format(collective, ranks)
+            m = re.search(re.escape(done) + ".*latency ([0-9.]+) us", output)
+            self.assertTrue(m is not None, "{0} {1} with count {2} did not complete, expected '{3}' in {4}".format(
+                collective, algorithm, count, done, outfile))
+            latency[count] = float(m.group(1))
+
+        return latency
@@ -28,8 +28,14 @@ const char* AllgatherFuncSM::m_enumName[] = {
     FOREACH_ENUM(GENERATE_STRING)
 };
 
+const char* AllgatherFuncSM::m_algorithmName[] = {
+    "bruck", "ring", "recursive_doubling"
+};
+
 AllgatherFuncSM::AllgatherFuncSM( SST::Params& params ) :
     FunctionSMInterface( params ),
+    m_algorithms( params, m_dbg, m_algorithmName, 3 ),
+    m_schedule( m_dbg ),
     m_event( NULL ),
     m_seq( 0 )
 {
@@ -47,6 +53,34 @@ void AllgatherFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
     m_rank = m_info->getGroup(m_event->group)->getMyRank();
     m_size = m_info->getGroup(m_event->group)->getSize();
 
+    // every rank knows every chunk size, so all of them pick the same algorithm
+    size_t bytes = 0;
+    for ( int i = 0; i < m_size; i++ ) {
+        bytes += chunkSize( i );
+    }
+    m_algorithm = m_algorithms.select( bytes, m_size );
+    if ( RecursiveDoubling == m_algorithm && ( m_size & ( m_size - 1 ) ) ) {
+        m_algorithm = Bruck;
+    }
+    m_dbg.debug(CALL_INFO,1,0,"%s, %zu bytes\n", m_algorithmName[m_algorithm], bytes );
+
+    if ( Bruck != m_algorithm ) {
+        m_schedule.init( m_info->getGroup(m_event->group), CtrlMsg::AllgatherTag, m_seq,
+                            m_smallCollectiveVN, m_smallCollectiveSize );
+
+        if ( m_event->sendbuf.getBacking() && m_event->recvbuf.getBacking() ) {
+            memcpy( chunkPtr(m_rank), m_event->sendbuf.getBacking(), chunkSize(m_rank) );
+        }
+
+        if ( Ring == m_algorithm ) {
+            buildRing();
+        } else {
+            buildRecursiveDoubling();
+        }
+        handleEnterEvent( retval );
+        return;
+    }
+
     int numStages = ceil( log2(m_size) );
     m_dbg.debug(CALL_INFO,1,0,"numStages=%d rank=%d size=%d\n",
                                         numStages, m_rank, m_size );
@@ -141,6 +175,17 @@ bool AllgatherFuncSM::setup( Retval& retval )
 void AllgatherFuncSM::handleEnterEvent( Retval& retval )
 {
     std::vector<IoVec> ioVec;
+
+    if ( Bruck != m_algorithm ) {
+        if ( m_schedule.enter( proto() ) ) {
+            m_dbg.debug(CALL_INFO,1,0,"leave\n");
+            retval.setExit( 0 );
+            delete m_event;
+            m_event = NULL;
+        }
+        return;
+    }
+
     m_dbg.debug(CALL_INFO,1,0,"%s\n", stateName(m_state).c_str());
 
     switch( m_state ) {
@@ -241,3 +286,48 @@ void AllgatherFuncSM::initIoVec( std::vector<IoVec>& ioVec,
         nextChunk = ( currentChunk + 1 ) % m_size;
     }
 }
+
+/*
+ * Each rank passes the chunk it received in the previous step on to the
+ * next rank, size-1 steps of one chunk each.
+ */
+void AllgatherFuncSM::buildRing()
+{
+    int right = ( m_rank + 1 ) % m_size;
+    int left = ( m_rank - 1 + m_size ) % m_size;
+
+    for ( int s = 0; s < m_size - 1; s++ ) {
+        CollectiveSchedule::Step& step = m_schedule.addStep();
+        step.sendTo = right;
+        addChunks( step.sendVec, mod( m_rank - s, m_size ), 1 );
+        step.recvFrom = left;
+        addChunks( step.recvVec, mod( m_rank - s - 1, m_size ), 1 );
+    }
+}
+
+/*
+ * In step k each rank swaps everything it has with the rank 2^k away, the
+ * chunks held double every step. Only used when size is a power of two.
+ */
+void AllgatherFuncSM::buildRecursiveDoubling()
+{
+    for ( int mask = 1; mask < m_size; mask <<= 1 ) {
+        int peer = m_rank ^ mask;
+
+        CollectiveSchedule::Step& step = m_schedule.addStep();
+        step.sendTo = peer;
+        addChunks( step.sendVec, m_rank & ~( mask - 1 ), mask );
+        step.recvFrom = peer;
+        addChunks( step.recvVec, peer & ~( mask - 1 ), mask );
+    }
+}
+
+void AllgatherFuncSM::addChunks( std::vector<IoVec>& ioVec,
+                    int startChunk, int numChunks )
+{
+    void* base = m_event->recvbuf.getBacking();
+    for ( int i = 0; i < numChunks; i++ ) {
+        int chunk = ( startChunk + i ) % m_size;
+        CollectiveSchedule::addSegment( ioVec, base, chunkOffset( chunk ), chunkSize( chunk ) );
+    }
+}
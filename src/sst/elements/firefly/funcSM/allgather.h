@@ -18,6 +18,7 @@
 
 #include "funcSM/api.h"
 #include "funcSM/event.h"
+#include "funcSM/collectiveSchedule.h"
 #include "ctrlMsg.h"
 #include "info.h"
 
@@ -50,6 +51,15 @@ class AllgatherFuncSM :  public FunctionSMInterface
         SST::Firefly::AllgatherFuncSM
     )
 
+    SST_ELI_DOCUMENT_PARAMS(
+        {"algorithm","Allgather algorithm when no algorithm_table entry matches: bruck, ring or recursive_doubling. recursive_doubling needs a power of two ranks and uses bruck otherwise","bruck"},
+        {"smallCollectiveVN","Sets the VN to use for small collectives","0"},
+        {"smallCollectiveSize","Sets the size of small collectives","0"},
+    )
+    /* PARAMS
+        algorithm_table.*   "<bytes>[:<ranks>]:<algorithm>", bytes is the total gathered by each rank
+    */
+
   private:
     enum StateEnum {
         FOREACH_ENUM(GENERATE_ENUM)
@@ -81,8 +91,14 @@ class AllgatherFuncSM :  public FunctionSMInterface
 
   private:
 
+    enum Algorithm { Bruck, Ring, RecursiveDoubling };
+    static const char* m_algorithmName[];
+
     bool setup( Retval& );
     void initIoVec(std::vector<IoVec>& ioVec, int startChunk, int numChunks, bool backed );
+    void buildRing();
+    void buildRecursiveDoubling();
+    void addChunks( std::vector<IoVec>& ioVec, int startChunk, int numChunks );
 
     std::string stateName( StateEnum i ) { return m_enumName[i]; }
 
@@ -97,13 +113,17 @@ class AllgatherFuncSM :  public FunctionSMInterface
         return  src < 0 ? m_size + src : src;
     }
 
-    unsigned char* chunkPtr( int rank ) {
-        unsigned char* ptr = (unsigned char*) m_event->recvbuf.getBacking();
+    size_t chunkOffset( int rank ) {
         if ( m_event->recvcntPtr ) {
-            ptr += ((int*)m_event->displsPtr)[rank];
+            return ((int*)m_event->displsPtr)[rank];
         } else {
-            ptr += rank * chunkSize( rank );
+            return rank * chunkSize( rank );
         }
+    }
+
+    unsigned char* chunkPtr( int rank ) {
+        unsigned char* ptr = (unsigned char*) m_event->recvbuf.getBacking();
+        ptr += chunkOffset( rank );
         m_dbg.debug(CALL_INFO,2,0,"rank %d, ptr %p\n", rank, ptr);
 
         return ptr;
@@ -124,6 +144,9 @@ class AllgatherFuncSM :  public FunctionSMInterface
 
     CtrlMsg::API* proto() { return static_cast<CtrlMsg::API*>(m_proto); }
 
+    CollectiveAlgorithmTable m_algorithms;
+    CollectiveSchedule  m_schedule;
+    int                 m_algorithm;
     std::vector<CtrlMsg::CommReq>  m_recvReqV;
     CtrlMsg::CommReq    m_recvReq;
     GatherStartEvent*   m_event;
@@ -0,0 +1,235 @@
+// Copyright 2013-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include <string.h>
+#include <algorithm>
+
+#include "funcSM/allreduce.h"
+#include "info.h"
+
+using namespace SST::Firefly;
+
+const char* AllreduceFuncSM::m_algorithmName[] = {
+    "tree", "ring", "recursive_doubling"
+};
+
+AllreduceFuncSM::AllreduceFuncSM( SST::Params& params ) :
+    CollectiveTreeFuncSM( params ),
+    m_algorithms( params, m_dbg, m_algorithmName, 3 ),
+    m_schedule( m_dbg ),
+    m_event( NULL ),
+    m_seq( 0 )
+{
+    m_smallCollectiveVN = params.find<int>( "smallCollectiveVN", 0);
+    m_smallCollectiveSize = params.find<int>( "smallCollectiveSize", 0);
+}
+
+void AllreduceFuncSM::handleStartEvent( SST::Event* e, Retval& retval )
+{
+    CollectiveStartEvent* event = static_cast< CollectiveStartEvent* >(e);
+
+    // reduce and bcast only have the tree
+    if ( event->type != CollectiveStartEvent::Allreduce ) {
+        CollectiveTreeFuncSM::handleStartEvent( e, retval );
+        return;
+    }
+
+    Group* group = m_info->getGroup( event->group );
+    unsigned dtypeSize = m_info->sizeofDataType( event->dtype );
+    size_t bytes = event->count * dtypeSize;
+
+    int algorithm = m_algorithms.select( bytes, group->getSize() );
+
+    m_dbg.debug(CALL_INFO,1,0,"%s, %zu bytes, %d ranks\n",
+                    m_algorithms.name( algorithm ), bytes, group->getSize() );
+
+    if ( Tree == algorithm ) {
+        CollectiveTreeFuncSM::handleStartEvent( e, retval );
+        return;
+    }
+
+    assert( NULL == m_event );
+    m_event = event;
+    ++m_seq;
+
+    m_schedule.init( group, CtrlMsg::CollectiveTag, m_seq,
+                        m_smallCollectiveVN, m_smallCollectiveSize );
+    m_schedule.setReduction( m_event->dtype, dtypeSize, m_event->op );
+
+    // the schedules reduce into result in place
+    void* mydata = m_event->mydata.getBacking();
+    void* result = m_event->result.getBacking();
+    if ( mydata && result && mydata != result ) {
+        memcpy( result, mydata, bytes );
+    }
+
+    if ( Ring == algorithm ) {
+        buildRing( m_event );
+    } else {
+        buildRecursiveDoubling( m_event );
+    }
+
+    handleEnterEvent( retval );
+}
+
+void AllreduceFuncSM::handleEnterEvent( Retval& retval )
+{
+    if ( NULL == m_event ) {
+        CollectiveTreeFuncSM::handleEnterEvent( retval );
+        return;
+    }
+
+    if ( m_schedule.enter( proto() ) ) {
+        m_dbg.debug(CALL_INFO,1,0,"Exit\n" );
+        retval.setExit( 0 );
+        delete m_event;
+        m_event = NULL;
+    }
+}
+
+/*
+ * Reduce-scatter then allgather around a ring. The buffer is split into
+ * one chunk per rank; after size-1 steps each rank holds one fully reduced
+ * chunk and another size-1 steps pass the reduced chunks around. Each rank
+ * sends 2*(size-1)/size of the buffer.
+ */
+void AllreduceFuncSM::buildRing( CollectiveStartEvent* event )
+{
+    Group* group = m_info->getGroup( event->group );
+    int size = group->getSize();
+    int rank = group->getMyRank();
+    size_t dtypeSize = m_info->sizeofDataType( event->dtype );
+
+    bool backed = event->mydata.getBacking() && event->result.getBacking();
+    void* buf = backed ? event->result.getBacking() : NULL;
+
+    // chunk c holds elements [offset[c], offset[c+1])
+    std::vector<size_t> offset( size + 1 );
+    for ( int c = 0; c <= size; c++ ) {
+        offset[c] = ( c * ( event->count / size ) +
+                        std::min<size_t>( c, event->count % size ) ) * dtypeSize;
+    }
+
+    unsigned char* scratch = m_schedule.scratch( offset[1] - offset[0], backed );
+    int right = ( rank + 1 ) % size;
+    int left = ( rank - 1 + size ) % size;
+
+    for ( int s = 0; s < size - 1; s++ ) {
+        int sendChunk = ( rank - s + size ) % size;
+        int recvChunk = ( rank - s - 1 + size ) % size;
+        size_t recvLen = offset[recvChunk + 1] - offset[recvChunk];
+
+        CollectiveSchedule::Step& step = m_schedule.addStep();
+        step.sendTo = right;
+        CollectiveSchedule::addSegment( step.sendVec, buf, offset[sendChunk],
+                        offset[sendChunk + 1] - offset[sendChunk] );
+        step.recvFrom = left;
+        CollectiveSchedule::addSegment( step.recvVec, scratch, 0, recvLen );
+        step.postOp = CollectiveSchedule::Reduce;
+        CollectiveSchedule::addSegment( step.postVec, buf, offset[recvChunk], recvLen );
+    }
+
+    for ( int s = 0; s < size - 1; s++ ) {
+        int sendChunk = ( rank + 1 - s + size ) % size;
+        int recvChunk = ( rank - s + size ) % size;
+
+        CollectiveSchedule::Step& step = m_schedule.addStep();
+        step.sendTo = right;
+        CollectiveSchedule::addSegment( step.sendVec, buf, offset[sendChunk],
+                        offset[sendChunk + 1] - offset[sendChunk] );
+        step.recvFrom = left;
+        CollectiveSchedule::addSegment( step.recvVec, buf, offset[recvChunk],
+                        offset[recvChunk + 1] - offset[recvChunk] );
+    }
+}
+
+/*
+ * Ranks exchange and reduce the whole buffer with a partner that is
+ * 1, 2, 4, ... away. When size is not a power of two the first 2*rem
+ * ranks pair up beforehand, the even rank of each pair hands its data to
+ * the odd one and sits out, and gets the result back at the end.
+ */
+void AllreduceFuncSM::buildRecursiveDoubling( CollectiveStartEvent* event )
+{
+    Group* group = m_info->getGroup( event->group );
+    int size = group->getSize();
+    int rank = group->getMyRank();
+    size_t len = event->count * m_info->sizeofDataType( event->dtype );
+
+    bool backed = event->mydata.getBacking() && event->result.getBacking();
+    void* buf = backed ? event->result.getBacking() : NULL;
+    unsigned char* scratch = m_schedule.scratch( len, backed );
+
+    int pof2 = 1;
+    unsigned log2Pof2 = 0;
+    while ( pof2 * 2 <= size ) {
+        pof2 *= 2;
+        ++log2Pof2;
+    }
+    int rem = size - pof2;
+
+    // stage 0 pairs up the extra ranks, stages 1 to log2(pof2) exchange
+    // and the last stage returns the result to the ranks that sat out
+    int newRank;
+    unsigned stage = 1;
+    if ( rank < 2 * rem ) {
+        CollectiveSchedule::Step& step = m_schedule.addStep();
+        step.stage = 0;
+        if ( 0 == rank % 2 ) {
+            step.sendTo = rank + 1;
+            CollectiveSchedule::addSegment( step.sendVec, buf, 0, len );
+            newRank = -1;
+        } else {
+            step.recvFrom = rank - 1;
+            CollectiveSchedule::addSegment( step.recvVec, scratch, 0, len );
+            step.postOp = CollectiveSchedule::Reduce;
+            CollectiveSchedule::addSegment( step.postVec, buf, 0, len );
+            newRank = rank / 2;
+        }
+    } else {
+        newRank = rank - rem;
+    }
+
+    if ( -1 != newRank ) {
+        for ( int mask = 1; mask < pof2; mask <<= 1 ) {
+            int newPeer = newRank ^ mask;
+            int peer = newPeer < rem ? newPeer * 2 + 1 : newPeer + rem;
+
+            CollectiveSchedule::Step& step = m_schedule.addStep();
+            step.stage = stage++;
+            step.sendTo = peer;
+            CollectiveSchedule::addSegment( step.sendVec, buf, 0, len );
+            step.recvFrom = peer;
+            CollectiveSchedule::addSegment( step.recvVec, scratch, 0, len );
+            step.postOp = CollectiveSchedule::Reduce;
+            CollectiveSchedule::addSegment( step.postVec, buf, 0, len );
+        }
+    }
+
+    if ( rank < 2 * rem ) {
+        CollectiveSchedule::Step& step = m_schedule.addStep();
+        step.stage = log2Pof2 + 1;
+        if ( 0 == rank % 2 ) {
+            step.recvFrom = rank + 1;
+            CollectiveSchedule::addSegment( step.recvVec, buf, 0, len );
+        } else {
+            step.sendTo = rank - 1;
+            CollectiveSchedule::addSegment( step.sendVec, buf, 0, len );
+        }
+    }
+}
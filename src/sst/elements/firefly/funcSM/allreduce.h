@@ -17,6 +17,7 @@
 #define COMPONENTS_FIREFLY_FUNCSM_ALLREDUCE_H
 
 #include "funcSM/collectiveTree.h"
+#include "funcSM/collectiveSchedule.h"
 
 namespace SST {
 namespace Firefly {
@@ -33,18 +34,38 @@ class AllreduceFuncSM :  public CollectiveTreeFuncSM
         SST::Firefly::CollectiveTreeFuncSM
     )
 
-  public:
-    AllreduceFuncSM( SST::Params& params ) : CollectiveTreeFuncSM( params ) { }
+    SST_ELI_DOCUMENT_PARAMS(
+        {"algorithm","Allreduce algorithm when no algorithm_table entry matches: tree, ring or recursive_doubling. Reduce and bcast always use the tree","tree"},
+        {"smallCollectiveVN","Sets the VN to use for small collectives","0"},
+        {"smallCollectiveSize","Sets the size of small collectives","0"},
+    )
+    /* PARAMS
+        algorithm_table.*   "<bytes>[:<ranks>]:<algorithm>", bytes is count * sizeof(dtype)
+    */
 
-    virtual void handleStartEvent( SST::Event* e, Retval& retval ) {
-        CollectiveTreeFuncSM::handleStartEvent( e, retval );
-    }
+  public:
+    AllreduceFuncSM( SST::Params& params );
 
-    virtual void handleEnterEvent( Retval& retval) {
-        CollectiveTreeFuncSM::handleEnterEvent( retval );
-    }
+    virtual void handleStartEvent( SST::Event* e, Retval& retval );
+    virtual void handleEnterEvent( Retval& retval );
 
     virtual std::string protocolName() { return "CtrlMsgProtocol"; }
+
+  private:
+    enum Algorithm { Tree, Ring, RecursiveDoubling };
+    static const char* m_algorithmName[];
+
+    void buildRing( CollectiveStartEvent* );
+    void buildRecursiveDoubling( CollectiveStartEvent* );
+
+    CtrlMsg::API* proto() { return static_cast<CtrlMsg::API*>(m_proto); }
+
+    CollectiveAlgorithmTable    m_algorithms;
+    CollectiveSchedule          m_schedule;
+    CollectiveStartEvent*       m_event;
+    int                         m_seq;
+    int                         m_smallCollectiveVN;
+    int                         m_smallCollectiveSize;
 };
 
 }
@@ -32,6 +32,10 @@ const char* AlltoallvFuncSM::m_enumName[] = {
     FOREACH_ENUM(GENERATE_STRING)
 };
 
+const char* AlltoallvFuncSM::m_algorithmName[] = {
+    "pairwise", "bruck"
+};
+
 void AlltoallvFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
 {
     assert( NULL == m_event );
@@ -52,6 +56,21 @@ void AlltoallvFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
         memcpy( recv, send, recvChunkSize(m_rank));
     }
 
+    // alltoallv counts differ between ranks so they could pick different
+    // algorithms, it always goes pairwise
+    m_algorithm = Pairwise;
+    if ( ! m_event->sendcnts && ! m_event->recvcnts &&
+                    sendChunkSize(0) == recvChunkSize(0) ) {
+        m_algorithm = m_algorithms.select( sendChunkSize(0), m_size );
+    }
+    m_dbg.debug(CALL_INFO,1,0,"%s\n", m_algorithmName[m_algorithm] );
+
+    if ( Bruck == m_algorithm ) {
+        m_schedule.init( m_info->getGroup( m_event->group ), CtrlMsg::AlltoallvTag, m_seq,
+                            m_smallCollectiveVN, m_smallCollectiveSize );
+        buildBruck();
+    }
+
     retval.setDelay( 0 );
 }
 
@@ -59,6 +78,18 @@ void AlltoallvFuncSM::handleEnterEvent( Retval& retval )
 {
 	Hermes::MemAddr addr;
     MP:: RankID rank;
+
+    if ( Bruck == m_algorithm ) {
+        if ( m_schedule.enter( proto() ) ) {
+            finishBruck();
+            m_dbg.debug(CALL_INFO,1,0,"leave\n");
+            retval.setExit(0);
+            delete m_event;
+            m_event = NULL;
+        }
+        return;
+    }
+
     switch ( m_state ) {
       case PostRecv:
 
@@ -109,3 +140,56 @@ void AlltoallvFuncSM::handleEnterEvent( Retval& retval )
         break;
     }
 }
+
+/*
+ * Bruck's algorithm, log2(size) steps instead of size-1 at the cost of
+ * moving each block several times. Blocks are first rotated so that block
+ * i is bound for rank+i. In step k every block whose index has bit k set
+ * is sent to rank+2^k and replaced with the block received from rank-2^k.
+ * Block i then came from rank-i and is copied to where that rank's data
+ * belongs.
+ */
+void AlltoallvFuncSM::buildBruck()
+{
+    size_t block = sendChunkSize(0);
+    bool backed = m_event->sendbuf.getBacking() && m_event->recvbuf.getBacking();
+
+    // the rotated blocks followed by room to receive up to half of them
+    m_bruckBuf = m_schedule.scratch( ( m_size + ( m_size + 1 ) / 2 ) * block, backed );
+    unsigned char* recvBuf = m_bruckBuf ? m_bruckBuf + m_size * block : NULL;
+
+    if ( m_bruckBuf ) {
+        for ( unsigned int i = 0; i < m_size; i++ ) {
+            memcpy( m_bruckBuf + i * block, sendChunkPtr( ( m_rank + i ) % m_size ), block );
+        }
+    }
+
+    for ( unsigned int pof2 = 1; pof2 < m_size; pof2 <<= 1 ) {
+        CollectiveSchedule::Step& step = m_schedule.addStep();
+        step.sendTo = ( m_rank + pof2 ) % m_size;
+        step.recvFrom = mod( (long) m_rank - pof2, m_size );
+        step.postOp = CollectiveSchedule::Copy;
+
+        size_t len = 0;
+        for ( unsigned int i = 1; i < m_size; i++ ) {
+            if ( i & pof2 ) {
+                CollectiveSchedule::addSegment( step.sendVec, m_bruckBuf, i * block, block );
+                CollectiveSchedule::addSegment( step.postVec, m_bruckBuf, i * block, block );
+                len += block;
+            }
+        }
+        CollectiveSchedule::addSegment( step.recvVec, recvBuf, 0, len );
+    }
+}
+
+void AlltoallvFuncSM::finishBruck()
+{
+    if ( ! m_bruckBuf ) {
+        return;
+    }
+
+    size_t block = recvChunkSize(0);
+    for ( unsigned int i = 0; i < m_size; i++ ) {
+        memcpy( recvChunkPtr( mod( (long) m_rank - i, m_size ) ), m_bruckBuf + i * block, block );
+    }
+}
@@ -18,6 +18,7 @@
 
 #include "funcSM/api.h"
 #include "funcSM/event.h"
+#include "funcSM/collectiveSchedule.h"
 #include "info.h"
 #include "ctrlMsg.h"
 
@@ -47,9 +48,13 @@ class AlltoallvFuncSM :  public FunctionSMInterface
     )
 
 	SST_ELI_DOCUMENT_PARAMS(
+		{"algorithm","Alltoall algorithm when no algorithm_table entry matches: pairwise or bruck. bruck is only used when every rank sends the same amount to every other rank","pairwise"},
 		{"smallCollectiveVN","Sets the VN to use for small collectives","0"},
 		{"smallCollectiveSize","Sets the size of small collectives","0"},
 	)
+    /* PARAMS
+        algorithm_table.*   "<bytes>[:<ranks>]:<algorithm>", bytes is what each rank sends to each other rank
+    */
   private:
 
     enum StateEnum {
@@ -65,6 +70,8 @@ class AlltoallvFuncSM :  public FunctionSMInterface
   public:
     AlltoallvFuncSM( SST::Params& params ) :
         FunctionSMInterface( params ),
+        m_algorithms( params, m_dbg, m_algorithmName, 2 ),
+        m_schedule( m_dbg ),
         m_event( NULL ),
         m_seq( 0 )
     {
@@ -79,6 +86,12 @@ class AlltoallvFuncSM :  public FunctionSMInterface
 
   private:
 
+    enum Algorithm { Pairwise, Bruck };
+    static const char* m_algorithmName[];
+
+    void buildBruck();
+    void finishBruck();
+
     uint32_t    genTag() {
         return CtrlMsg::AlltoallvTag | (( m_seq & 0xff) << 8 );
     }
@@ -139,6 +152,10 @@ class AlltoallvFuncSM :  public FunctionSMInterface
 
     CtrlMsg::API* proto() { return static_cast<CtrlMsg::API*>(m_proto); }
 
+    CollectiveAlgorithmTable m_algorithms;
+    CollectiveSchedule  m_schedule;
+    int                 m_algorithm;
+    unsigned char*      m_bruckBuf;
     AlltoallStartEvent* m_event;
     CtrlMsg::CommReq    m_recvReq;
     unsigned int        m_count;
@@ -0,0 +1,265 @@
+// Copyright 2013-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <set>
+
+#include "funcSM/collectiveSchedule.h"
+#include "funcSM/collectiveOps.h"
+#include "group.h"
+
+using namespace SST::Firefly;
+
+static bool keyLess( const std::string& a, const std::string& b )
+{
+    return atoi( a.c_str() ) < atoi( b.c_str() );
+}
+
+CollectiveAlgorithmTable::CollectiveAlgorithmTable( SST::Params& params,
+                Output& dbg, const char* names[], int numNames ) :
+    m_dbg( dbg ),
+    m_names( names ),
+    m_numNames( numNames )
+{
+    m_default = lookup( params.find<std::string>( "algorithm", names[0] ), "algorithm" );
+
+    Params table = params.get_scoped_params( "algorithm_table" );
+    table.enableVerify( false );
+
+    std::set<std::string> tmp = table.getKeys();
+    std::vector<std::string> keys( tmp.begin(), tmp.end() );
+    std::sort( keys.begin(), keys.end(), keyLess );
+
+    for ( unsigned i = 0; i < keys.size(); i++ ) {
+        std::string where = "algorithm_table." + keys[i];
+        std::string value = table.find<std::string>( keys[i] );
+
+        std::vector<std::string> fields;
+        size_t start = 0;
+        size_t pos;
+        while ( std::string::npos != ( pos = value.find( ':', start ) ) ) {
+            fields.push_back( value.substr( start, pos - start ) );
+            start = pos + 1;
+        }
+        fields.push_back( value.substr( start ) );
+
+        if ( fields.size() < 2 || fields.size() > 3 ) {
+            m_dbg.fatal( CALL_INFO, -1, "%s: expected <bytes>[:<ranks>]:<algorithm>, got '%s'\n",
+                        where.c_str(), value.c_str() );
+        }
+
+        Entry entry;
+        parseRange( fields[0], entry.minBytes, entry.maxBytes, where );
+        if ( 3 == fields.size() ) {
+            parseRange( fields[1], entry.minRanks, entry.maxRanks, where );
+        } else {
+            entry.minRanks = 0;
+            entry.maxRanks = -1;
+        }
+        entry.algorithm = lookup( fields.back(), where );
+
+        m_dbg.debug(CALL_INFO,1,0,"%s bytes %" PRIu64 "-%" PRIu64 " ranks %" PRIu64 "-%" PRIu64 " %s\n",
+                    where.c_str(), entry.minBytes, entry.maxBytes,
+                    entry.minRanks, entry.maxRanks, name( entry.algorithm ) );
+        m_table.push_back( entry );
+    }
+}
+
+int CollectiveAlgorithmTable::select( size_t bytes, int ranks ) const
+{
+    for ( unsigned i = 0; i < m_table.size(); i++ ) {
+        const Entry& entry = m_table[i];
+        if ( bytes >= entry.minBytes && bytes <= entry.maxBytes &&
+                (uint64_t) ranks >= entry.minRanks && (uint64_t) ranks <= entry.maxRanks ) {
+            return entry.algorithm;
+        }
+    }
+    return m_default;
+}
+
+int CollectiveAlgorithmTable::lookup( const std::string& name, const std::string& where )
+{
+    for ( int i = 0; i < m_numNames; i++ ) {
+        if ( 0 == name.compare( m_names[i] ) ) {
+            return i;
+        }
+    }
+
+    std::string valid;
+    for ( int i = 0; i < m_numNames; i++ ) {
+        valid += i ? ", " : "";
+        valid += m_names[i];
+    }
+    m_dbg.fatal( CALL_INFO, -1, "%s: unknown algorithm '%s', expected one of %s\n",
+                where.c_str(), name.c_str(), valid.c_str() );
+    return 0;
+}
+
+void CollectiveAlgorithmTable::parseRange( const std::string& str,
+                uint64_t& lo, uint64_t& hi, const std::string& where )
+{
+    char* end;
+    lo = strtoull( str.c_str(), &end, 10 );
+    if ( end == str.c_str() ) {
+        m_dbg.fatal( CALL_INFO, -1, "%s: bad range '%s'\n", where.c_str(), str.c_str() );
+    }
+
+    if ( '\0' == *end ) {
+        hi = lo;
+    } else if ( '-' == *end && '\0' == *(end + 1) ) {
+        hi = -1;
+    } else if ( '-' == *end ) {
+        const char* start = end + 1;
+        hi = strtoull( start, &end, 10 );
+        if ( end == start || '\0' != *end || hi < lo ) {
+            m_dbg.fatal( CALL_INFO, -1, "%s: bad range '%s'\n", where.c_str(), str.c_str() );
+        }
+    } else {
+        m_dbg.fatal( CALL_INFO, -1, "%s: bad range '%s'\n", where.c_str(), str.c_str() );
+    }
+}
+
+void CollectiveSchedule::init( Group* group, uint64_t funcTag, int seq,
+                int smallVN, size_t smallSize )
+{
+    m_group = group;
+    m_tag = funcTag | 0x08000000 | ( ( seq & 0xff ) << 16 );
+    m_smallVN = smallVN;
+    m_smallSize = smallSize;
+    m_steps.clear();
+    m_step = 0;
+    m_phase = PostRecv;
+}
+
+unsigned char* CollectiveSchedule::scratch( size_t len, bool backed )
+{
+    if ( ! backed ) {
+        return NULL;
+    }
+    if ( m_scratch.size() < len ) {
+        m_scratch.resize( len );
+    }
+    return m_scratch.data();
+}
+
+void CollectiveSchedule::addSegment( std::vector<IoVec>& vec, void* base,
+                size_t offset, size_t len )
+{
+    if ( 0 == len ) {
+        return;
+    }
+
+    unsigned char* ptr = base ? (unsigned char*) base + offset : NULL;
+
+    // merge with the previous segment if this one follows it, segments
+    // that are not backed can always be merged
+    if ( ! vec.empty() ) {
+        IoVec& last = vec.back();
+        unsigned char* lastPtr = (unsigned char*) last.addr.getBacking();
+        if ( ( ! ptr && ! lastPtr ) || ( ptr && lastPtr && lastPtr + last.len == ptr ) ) {
+            last.len += len;
+            return;
+        }
+    }
+
+    IoVec seg;
+    seg.addr.setSimVAddr( 1 );
+    seg.addr.setBacking( ptr );
+    seg.len = len;
+    vec.push_back( seg );
+}
+
+bool CollectiveSchedule::enter( CtrlMsg::API* proto )
+{
+    std::vector<IoVec> empty( 1 );
+    empty[0].addr.setSimVAddr( 1 );
+    empty[0].addr.setBacking( NULL );
+    empty[0].len = 0;
+
+    while ( m_step < m_steps.size() ) {
+        Step& step = m_steps[m_step];
+
+        switch ( m_phase ) {
+          case PostRecv:
+            m_phase = Send;
+            if ( -1 != step.recvFrom ) {
+                m_dbg.debug(CALL_INFO,1,0,"step %zu irecv from %d\n", m_step, step.recvFrom );
+                proto->irecvv( step.recvVec.empty() ? empty : step.recvVec,
+                        m_group->getMapping( step.recvFrom ), tag( step ), &m_recvReq );
+                return false;
+            }
+
+          case Send:
+            m_phase = Wait;
+            if ( -1 != step.sendTo ) {
+                size_t length = 0;
+                for ( unsigned i = 0; i < step.sendVec.size(); i++ ) {
+                    length += step.sendVec[i].len;
+                }
+                int vn = length <= m_smallSize ? m_smallVN : 0;
+
+                m_dbg.debug(CALL_INFO,1,0,"step %zu send %zu bytes to %d vn=%d\n",
+                            m_step, length, step.sendTo, vn );
+                proto->sendv( step.sendVec.empty() ? empty : step.sendVec,
+                        m_group->getMapping( step.sendTo ), tag( step ), vn );
+                return false;
+            }
+
+          case Wait:
+            m_phase = Finish;
+            if ( -1 != step.recvFrom ) {
+                m_dbg.debug(CALL_INFO,1,0,"step %zu wait\n", m_step );
+                proto->wait( &m_recvReq );
+                return false;
+            }
+
+          case Finish:
+            finishStep( step );
+            m_phase = PostRecv;
+            ++m_step;
+        }
+    }
+    return true;
+}
+
+void CollectiveSchedule::finishStep( Step& step )
+{
+    if ( None == step.postOp || step.recvVec.empty() ) {
+        return;
+    }
+
+    unsigned char* src = (unsigned char*) step.recvVec[0].addr.getBacking();
+    if ( ! src ) {
+        return;
+    }
+
+    for ( unsigned i = 0; i < step.postVec.size(); i++ ) {
+        void* dest = step.postVec[i].addr.getBacking();
+        size_t len = step.postVec[i].len;
+
+        if ( Copy == step.postOp ) {
+            memcpy( dest, src, len );
+        } else {
+            void* input[2] = { dest, src };
+            collectiveOp( input, 2, dest, len / m_dtypeSize, m_dtype, m_op );
+        }
+        src += len;
+    }
+}
@@ -0,0 +1,162 @@
+// Copyright 2013-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_FUNCSM_COLLECTIVESCHEDULE_H
+#define COMPONENTS_FIREFLY_FUNCSM_COLLECTIVESCHEDULE_H
+
+#include <sst/core/output.h>
+#include <sst/core/params.h>
+
+#include <string>
+#include <vector>
+
+#include "sst/elements/hermes/msgapi.h"
+#include "ctrlMsg.h"
+#include "ioVec.h"
+
+namespace SST {
+namespace Firefly {
+
+class Group;
+
+/*
+ * Picks the algorithm a collective uses from its message size and
+ * communicator size.
+ *
+ * "algorithm" names the algorithm used when nothing else matches and
+ * "algorithm_table.<n>" entries override it, checked in increasing <n>
+ * until one matches. An entry is "<bytes>:<algorithm>" or
+ * "<bytes>:<ranks>:<algorithm>" where <bytes> and <ranks> are ranges
+ * written "lo-hi", "lo-" (no upper bound) or "n". For example
+ *
+ *   algorithm_table.0 = 0-2048:recursive_doubling
+ *   algorithm_table.1 = 2049-:64-:ring
+ *
+ * Every rank in the communicator must pick the same algorithm, so the
+ * caller passes a size that all ranks agree on.
+ */
+class CollectiveAlgorithmTable {
+  public:
+    CollectiveAlgorithmTable( SST::Params& params, Output& dbg,
+                        const char* names[], int numNames );
+
+    int select( size_t bytes, int ranks ) const;
+    const char* name( int algorithm ) const { return m_names[algorithm]; }
+
+  private:
+    struct Entry {
+        uint64_t minBytes;
+        uint64_t maxBytes;
+        uint64_t minRanks;
+        uint64_t maxRanks;
+        int algorithm;
+    };
+
+    int lookup( const std::string& name, const std::string& where );
+    void parseRange( const std::string& str, uint64_t& lo, uint64_t& hi,
+                        const std::string& where );
+
+    Output&             m_dbg;
+    const char**        m_names;
+    int                 m_numNames;
+    int                 m_default;
+    std::vector<Entry>  m_table;
+};
+
+/*
+ * Runs a collective that has been written out as a list of steps.
+ *
+ * In each step a rank may receive from one peer and send to another; the
+ * receive is posted before the send so that ranks exchanging with each
+ * other do not deadlock. Received data either lands in place or, for
+ * steps that combine or rearrange data, in a scratch buffer that is
+ * reduced or copied into "post" once the receive completes. Peers are
+ * ranks in the collective's communicator.
+ *
+ * enter() issues at most one protocol call each time it is called, the
+ * same way the function state machines do, and returns true once the
+ * last step has finished.
+ *
+ * Tags are the function's tag with bit 27 set, the call's sequence number
+ * in bits 16-23 and the step's stage in bits 0-15, so they never match the
+ * tags the tree, allgather and alltoallv code already uses. The stage is
+ * the step's index unless the builder sets it, which it has to when ranks
+ * run different numbers of steps.
+ */
+class CollectiveSchedule {
+  public:
+    enum PostOp { None, Copy, Reduce };
+
+    struct Step {
+        Step() : stage(0), sendTo(-1), recvFrom(-1), postOp(None) {}
+        unsigned            stage;      // goes in the tag, must match the peer's step
+        int                 sendTo;
+        std::vector<IoVec>  sendVec;
+        int                 recvFrom;
+        std::vector<IoVec>  recvVec;
+        PostOp              postOp;
+        std::vector<IoVec>  postVec;
+    };
+
+    CollectiveSchedule( Output& dbg ) : m_dbg( dbg ), m_group( NULL ) {}
+
+    void init( Group* group, uint64_t funcTag, int seq, int smallVN, size_t smallSize );
+    void setReduction( MP::PayloadDataType dtype, unsigned dtypeSize,
+                        MP::ReductionOperation op ) {
+        m_dtype = dtype;
+        m_dtypeSize = dtypeSize;
+        m_op = op;
+    }
+
+    Step& addStep() {
+        m_steps.resize( m_steps.size() + 1 );
+        m_steps.back().stage = m_steps.size() - 1;
+        return m_steps.back();
+    }
+
+    // scratch space for the steps, NULL if the collective is not backed
+    unsigned char* scratch( size_t len, bool backed );
+
+    bool enter( CtrlMsg::API* );
+
+    // Append len bytes at offset from base to vec, NULL base means not backed
+    static void addSegment( std::vector<IoVec>& vec, void* base,
+                        size_t offset, size_t len );
+
+  private:
+    enum Phase { PostRecv, Send, Wait, Finish };
+
+    void finishStep( Step& );
+    uint64_t tag( Step& step ) { return m_tag | ( step.stage & 0xffff ); }
+
+    Output&                     m_dbg;
+    Group*                      m_group;
+    uint64_t                    m_tag;
+    int                         m_smallVN;
+    size_t                      m_smallSize;
+    MP::PayloadDataType         m_dtype;
+    unsigned                    m_dtypeSize;
+    MP::ReductionOperation      m_op;
+    std::vector<Step>           m_steps;
+    std::vector<unsigned char>  m_scratch;
+    CtrlMsg::CommReq            m_recvReq;
+    size_t                      m_step;
+    Phase                       m_phase;
+};
+
+}
+}
+
+#endif
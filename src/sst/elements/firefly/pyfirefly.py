@@ -208,6 +208,23 @@ class FireflyHades(FireflyOS):
             "functionSM." # prefix needed in the dictionary so things get passed correctly to elements
         )
 
+        # Collective algorithm selection, e.g. functionsm.Allreduce.algorithm = "ring"
+        # and functionsm.Allreduce.algorithm_table.0 = "0-4096:recursive_doubling"
+        for func in [ 'Allreduce', 'Allgather', 'Alltoallv' ]:
+            self._declareParamsWithUserPrefix(
+                "main",
+                "functionsm." + func,
+                [ 'algorithm' ],
+                "functionSM." + func + "."
+            )
+
+            self._declareFormattedParamsWithUserPrefix(
+                "main",
+                "functionsm." + func,
+                [ 'algorithm_table.%d' ],
+                "functionSM." + func + ".algorithm_table."
+            )
+
         # Subscribe to firefly.functionsm platform param set.  Need to
         # prefix the keys with functionsm so that the end use doesn't
         # have to put it on each key entry
@@ -17,6 +17,8 @@
 #include "gensa.h"
 
 #include <fstream>
+#include <climits>
+#include <algorithm>
 
 #include <sst/core/params.h>
 #include <sst/core/rng/marsaglia.h>
@@ -48,6 +50,11 @@ gensa::gensa (ComponentId_t id, Params & params)
     Neuron::dt      = params.find<float> ("dt",              1);  // In seconds. Don't bother with UnitAlgebra because this is usually specified by wrapper script.
     maxRequestDepth = params.find<int>   ("maxRequestDepth", 2);
 
+    string updateMode = params.find<string>("updateMode", "dense");
+    if      (updateMode == "dense")  activeUpdate = false;
+    else if (updateMode == "active") activeUpdate = true;
+    else out.fatal (CALL_INFO, -1, "Unknown updateMode '%s', expected 'dense' or 'active'\n", updateMode.c_str ());
+
     //set our clock
     string clockFreq = params.find<string> ("clock", "1GHz");
     clockTC = registerClock (clockFreq, new Clock::Handler<gensa> (this, &gensa::clockTic));
@@ -138,7 +145,7 @@ gensa::init (unsigned int phase)
             float leak = 1 - atof(piece);  // The parameter in the file is the portion of voltage to get rid of each cycle. It's simpler for us to compute with (1-decay).
             piece = strtok(0, ",");  // Actually, there should only be one piece left, with no more commas.
             float p = atof(piece);
-            n = neurons[id] = new NeuronLIF(Vinit, Vthreshold, Vreset, leak, p);
+            n = neurons[id] = new NeuronLIF(&lif, Vinit, Vthreshold, Vreset, leak, p);
         } else {
             n = neurons[id] = new NeuronInput();
         }
@@ -224,6 +231,8 @@ gensa::init (unsigned int phase)
     ifs.open (modelPath.c_str());
     assert(sizeof(Synapse) == 8);
     uint64_t startAddr = 0x10000;
+    int minDelay = INT_MAX;
+    int maxDelay = 0;
     while (ifs.good()) {
         getline(ifs, line);
         if (line.empty()) break;
@@ -250,6 +259,8 @@ gensa::init (unsigned int phase)
             float weight = atof(piece);
             piece = strtok(0, ",");
             int delay = atoi(piece);
+            minDelay = min(minDelay, delay);
+            maxDelay = max(maxDelay, delay);
 
             if (n->synapseBase == 0)
             {
@@ -269,6 +280,12 @@ gensa::init (unsigned int phase)
         }
     }
 
+    // With no zero-delay synapses, all input for a step is known when the step starts,
+    // so the whole step can be computed at once. Otherwise fall back to updating each neuron as it is visited.
+    bool batched = minDelay > 0;
+    if (! batched) out.verbose (CALL_INFO, 1, 0, "Model has zero-delay synapses; updating LIF neurons one at a time\n");
+    lif.finalize (maxDelay, batched, activeUpdate);
+
     int numNeurons = neurons.size ();
     printf("Constructed %d neurons with %d links\n", numNeurons, countLinks);
 }
@@ -278,6 +295,7 @@ gensa::setup ()
 {
 	memory->setup ();
 	link->setup ();
+    wallStart = chrono::steady_clock::now ();
 }
 
 void
@@ -296,6 +314,9 @@ gensa::finish ()
 
 	printf ("Completed %d neuron firings\n", numFirings);
     printf ("Completed %d spike deliveries\n", numDeliveries);
+
+    double seconds = chrono::duration<double> (chrono::steady_clock::now () - wallStart).count ();
+    if (seconds > 0) out.verbose (CALL_INFO, 1, 0, "Simulated %.0f spikes/sec (wall clock)\n", numFirings / seconds);
 }
 
 // We simulate a von Nuemann style neuromorphic processor, working through our list of nuerons serially.
@@ -336,6 +357,7 @@ gensa::clockTic (Cycle_t t)
         syncSent = false;  // Although this is a wasted operation most of the time, it's the simplest way to reset sync state.
 
         neuronIndex++;
+        if (neuronIndex == 0  &&  lif.batched) lif.step (now);
         if (neuronIndex < count)
         {
             Neuron * n = neurons[neuronIndex];
@@ -23,6 +23,7 @@
 #include <inttypes.h>
 #include <vector>
 #include <queue>
+#include <chrono>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -51,7 +52,8 @@ public:
         {"clock",          "(string) Clock frequency",                                           "1GHz"},
         {"modelPath",      "(string) Path to neuron file",                                       "model"},
         {"steps",          "(uint) how many ticks the simulation should last",                   "1000"},
-        {"dt",             "(float) duration of one tick in sim time; used for output",          "1"}
+        {"dt",             "(float) duration of one tick in sim time; used for output",          "1"},
+        {"updateMode",     "(string) LIF update: 'dense' updates every neuron each step, 'active' only neurons with input, over threshold, or leaking", "dense"}
     )
 
     SST_ELI_DOCUMENT_PORTS( {"mem_link", "Connection to memory", { "memHierarchy.MemEventBase" } } )
@@ -75,6 +77,10 @@ public:
     uint32_t    maxRequestDepth; ///< Shared by memory and network. Should be a pretty small number like 2 or 3.
 
     std::vector<Neuron*> neurons;
+    NeuronLIFArray       lif;             ///< Shared state of all LIF neurons
+    bool                 activeUpdate;    ///< Use the active-only LIF update
+
+    std::chrono::steady_clock::time_point wallStart;  ///< For reporting spikes/sec
 
     TimeConverter *             clockTC;
     Interfaces::StandardMem *   memory;
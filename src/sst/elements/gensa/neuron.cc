@@ -17,6 +17,9 @@
 #include <sst_config.h>
 #include "neuron.h"
 
+#include <algorithm>
+#include <climits>
+
 using namespace SST::gensaComponent;
 using namespace std;
 
@@ -62,51 +65,181 @@ void Neuron::deliverSpike(float str, uint when)
 }
 
 
-// NeuronLIF -----------------------------------------------------------------
+// class NeuronLIFArray ------------------------------------------------------
 
-SST::RNG::MarsagliaRNG NeuronLIF::rng(1,13);
+NeuronLIFArray::NeuronLIFArray()
+{
+    count      = 0;
+    slotMask   = 0;
+    batched    = false;
+    activeOnly = false;
+}
 
-NeuronLIF::NeuronLIF(float Vinit, float Vthreshold, float Vreset, float leak, float p)
-:   V          (Vinit),
-    Vthreshold (Vthreshold),
-    Vreset     (Vreset),
-    leak       (leak),
-    p          (p)
+uint32_t NeuronLIFArray::add(float Vinit, float Vthreshold, float Vreset, float leak, float p)
 {
+    V         .push_back(Vinit);
+    this->Vthreshold.push_back(Vthreshold);
+    this->Vreset    .push_back(Vreset);
+    this->leak      .push_back(leak);
+    this->p         .push_back(p);
+    fired     .push_back(0);
+    if (p > 0  &&  p < 1) chance.push_back(count);
+    return count++;
 }
 
-void NeuronLIF::deliverSpike(float str, uint when)
+void NeuronLIFArray::finalize(uint32_t maxDelay, bool batched, bool activeOnly)
 {
-    temporalBuffer[when] += str;
+    this->batched    = batched;
+    this->activeOnly = batched && activeOnly;
+
+    // A spike is never scheduled more than maxDelay steps ahead, so that many slots plus the current one suffice.
+    uint32_t slots = 1;
+    while (slots <= maxDelay) slots <<= 1;
+    slotMask = slots - 1;
+    delayLine.assign((size_t) slots * count, 0);
+
+    if (! batched) updated.assign(count, 0);
+
+    if (this->activeOnly) {
+        pending.resize(slots);
+        pendingMark.assign((size_t) slots * count, 0);
+        candidateStep.assign(count, UINT32_MAX);
+        // Every neuron gets evaluated on the first step.
+        live.resize(count);
+        for (uint32_t i = 0; i < count; i++) live[i] = i;
+    }
 }
 
-bool NeuronLIF::update(const uint now)
+void NeuronLIFArray::deliverSpike(uint32_t i, float str, uint32_t when)
 {
-    // Add inputs
-    temporalBuffer_t::iterator i = temporalBuffer.find(now);
-    if (i != temporalBuffer.end()) {
-        V += i->second;
-        temporalBuffer.erase(i);
+    // Input for a step the neuron already processed is never seen.
+    if (! batched  &&  when < updated[i]) return;
+
+    size_t slot = (size_t) (when & slotMask) * count + i;
+    delayLine[slot] += str;
+    if (activeOnly  &&  ! pendingMark[slot]) {
+        pendingMark[slot] = 1;
+        pending[when & slotMask].push_back(i);
     }
+}
+
+bool NeuronLIFArray::integrate(uint32_t i, float input)
+{
+    V[i] += input;
 
     // Check for spike
     bool spiked = false;
-    if (V > Vthreshold) {
-        if (p >= 1  ||  p > 0  &&  rng.nextUniform() <= p) {
-            V = Vreset;
+    if (V[i] > Vthreshold[i]) {
+        if (p[i] >= 1  ||  p[i] > 0  &&  NeuronLIF::rng.nextUniform() <= p[i]) {
+            V[i] = Vreset[i];
             spiked = true;
         }
     } else {
-        V *= leak;
+        V[i] *= leak[i];
+    }
+    fired[i] = spiked;
+    return spiked;
+}
+
+bool NeuronLIFArray::updateOne(uint32_t i, uint32_t now)
+{
+    float & input = delayLine[(size_t) (now & slotMask) * count + i];
+    float   in    = input;
+    input      = 0;
+    updated[i] = now + 1;
+    return integrate(i, in);
+}
+
+void NeuronLIFArray::step(uint32_t now)
+{
+    float * input = &delayLine[(size_t) (now & slotMask) * count];
+
+    if (activeOnly) {
+        for (auto i : firedList) fired[i] = 0;
+        firedList.clear();
+
+        // Only neurons with input, or whose state can change without input, need an update.
+        std::vector<uint32_t> & waiting = pending[now & slotMask];
+        candidates.clear();
+        for (auto i : waiting) {
+            pendingMark[(size_t) (now & slotMask) * count + i] = 0;
+            if (candidateStep[i] != now) {candidateStep[i] = now; candidates.push_back(i);}
+        }
+        for (auto i : live) {
+            if (candidateStep[i] != now) {candidateStep[i] = now; candidates.push_back(i);}
+        }
+        waiting.clear();
+        std::sort(candidates.begin(), candidates.end());  // keep RNG draws in neuron order
+
+        live.clear();
+        for (auto i : candidates) {
+            float in = input[i];
+            input[i] = 0;
+            if (integrate(i, in)) firedList.push_back(i);
+            if (V[i] > Vthreshold[i]  ||  leak[i] != 1  &&  V[i] != 0) live.push_back(i);
+        }
+        return;
     }
 
+    // Dense pass over every neuron. Neurons that are over threshold with 0 < p < 1 keep V here,
+    // get marked with bit 1 of fired, and are resolved afterward in index order so the RNG
+    // sequence matches a serial update.
+    float *         v   = V.data();
+    const float *   th  = Vthreshold.data();
+    const float *   rst = Vreset.data();
+    const float *   lk  = leak.data();
+    const float *   pr  = p.data();
+    uint8_t *       f   = fired.data();
+    for (uint32_t i = 0; i < count; i++) {
+        float   x    = v[i] + input[i];
+        uint8_t over = x > th[i];
+        uint8_t fire = over & (pr[i] >= 1);
+        uint8_t roll = over & ! fire & (pr[i] > 0);
+        input[i] = 0;
+        f[i]     = fire | (roll << 1);
+        v[i]     = fire ? rst[i] : (over ? x : x * lk[i]);
+    }
+
+    for (auto i : chance) {
+        if (! (f[i] & 2)) continue;
+        f[i] = 0;
+        if (NeuronLIF::rng.nextUniform() <= pr[i]) {
+            v[i] = rst[i];
+            f[i] = 1;
+        }
+    }
+}
+
+
+// class NeuronLIF -----------------------------------------------------------
+
+SST::RNG::MarsagliaRNG NeuronLIF::rng(1,13);
+
+NeuronLIF::NeuronLIF(NeuronLIFArray * state, float Vinit, float Vthreshold, float Vreset, float leak, float p)
+:   state (state)
+{
+    index = state->add(Vinit, Vthreshold, Vreset, leak, p);
+}
+
+void NeuronLIF::deliverSpike(float str, uint when)
+{
+    state->deliverSpike(index, str, when);
+}
+
+bool NeuronLIF::update(const uint now)
+{
+    // In batched mode the whole step was already computed; just pick up the result.
+    bool spiked;
+    if (state->batched) spiked = state->fired[index];
+    else                spiked = state->updateOne(index, now);
+
     // Outputs
     Trace * t = traces;
     while (t) {
         if (t->probe == 0) {
             if (spiked) t->holder->trace (now*dt, t->column, 1, t->mode);
         } else if (t->probe == 1) {
-            t->holder->trace(now*dt, t->column, V, t->mode);
+            t->holder->trace(now*dt, t->column, state->V[index], t->mode);
         }
         t = t->next;
     }
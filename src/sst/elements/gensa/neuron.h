@@ -17,6 +17,7 @@
 #define _NEURON_H
 
 #include <map>
+#include <vector>
 #include <cstdint>
 
 #include <sst/core/interfaces/stdMem.h>  // supplies type uint
@@ -61,21 +62,55 @@ public:
     virtual bool update      (const uint32_t now) = 0;  ///< performs Leaky Integrate and Fire. Returns true if fired.
 };
 
+/// State of all LIF neurons, stored as parallel arrays so a whole step can be updated in one pass.
+class NeuronLIFArray {
+public:
+    std::vector<float>   V;          // "voltage"; generally in the normal range [0,1]
+    std::vector<float>   Vthreshold; // value of V which triggers a spike
+    std::vector<float>   Vreset;     // value of V immediately after a spike
+    std::vector<float>   leak;       // fraction of V to retain after present cycle, in [0,1]
+    std::vector<float>   p;          // probability of firing when over threshold, in [0,1]
+    std::vector<uint8_t> fired;      // result of the most recent update
+
+    // Delay line of future input, slot-major: input for step t is at [(t & slotMask) * count + i]
+    std::vector<float>   delayLine;
+    uint32_t             count;
+    uint32_t             slotMask;
+
+    bool batched;    ///< Update every neuron at the start of a step. Requires all synapse delays >= 1.
+    bool activeOnly; ///< In batched mode, only update neurons with input, over threshold, or still leaking.
+
+    std::vector<uint32_t> chance;    ///< Neurons with 0 < p < 1, in index order; they draw from the RNG.
+    std::vector<uint32_t> updated;   ///< Unbatched mode: 1 + last step each neuron was updated in, 0 if never.
+
+    // Active mode bookkeeping
+    std::vector<std::vector<uint32_t>> pending;  ///< Per slot, neurons that have input waiting.
+    std::vector<uint8_t>               pendingMark;
+    std::vector<uint32_t>              live;     ///< Neurons that may change without input.
+    std::vector<uint32_t>              firedList;
+    std::vector<uint32_t>              candidates;
+    std::vector<uint32_t>              candidateStep;
+
+    NeuronLIFArray();
+
+    uint32_t add         (float Vinit, float Vthreshold, float Vreset, float leak, float p);
+    void     finalize    (uint32_t maxDelay, bool batched, bool activeOnly);  ///< Size the delay line once all neurons and synapses are known.
+    void     deliverSpike(uint32_t i, float str, uint32_t when);
+    void     step        (uint32_t now);                ///< Batched update of all neurons for the given step.
+    bool     updateOne   (uint32_t i, uint32_t now);    ///< Unbatched update of a single neuron.
+
+protected:
+    bool     integrate   (uint32_t i, float input);     ///< Scalar LIF model shared by the unbatched and active paths.
+};
+
 class NeuronLIF : public Neuron {
 public:
-    float V;          // "voltage"; generally in the normal range [0,1]
-    float Vthreshold; // value of V which triggers a spike
-    float Vreset;     // value of V immediately after a spike
-    float leak;       // fraction of V to retain after present cycle, in [0,1]
-    float p;          // probability of firing when over threshold, in [0,1]
+    NeuronLIFArray * state;
+    uint32_t         index;  ///< position in state arrays
 
     static SST::RNG::MarsagliaRNG rng;
 
-    // temporal buffer
-    typedef std::map<const uint, float> temporalBuffer_t;
-    temporalBuffer_t temporalBuffer;
-
-    NeuronLIF (float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
+    NeuronLIF (NeuronLIFArray * state, float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
 
     virtual void deliverSpike(float str, uint32_t when);
     virtual bool update      (const uint32_t now);
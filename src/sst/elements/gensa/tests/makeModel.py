@@ -0,0 +1,45 @@
+#!/usr/bin/env python
+#
+# Generate a random network in the gensa model format, for scale-up runs.
+# Usage:
+#   python makeModel.py -n 100000 -f 16 > bigModel
+#   sst test_gensa_1.py -- -n bigModel -l 100
+#
+# The first few neurons are inputs that spike at random times. The remainder
+# are LIF neurons with randomly chosen fan-out targets. Delays are at least 1,
+# so gensa can run each step as a single batched update.
+
+import random
+from optparse import OptionParser
+
+op = OptionParser()
+op.add_option("-n", "--neurons", action="store", type="int",   dest="neurons", default=1000,  help="number of LIF neurons")
+op.add_option("-i", "--inputs",  action="store", type="int",   dest="inputs",  default=10,    help="number of input neurons")
+op.add_option("-f", "--fanout",  action="store", type="int",   dest="fanout",  default=8,     help="synapses per neuron")
+op.add_option("-d", "--delay",   action="store", type="int",   dest="delay",   default=4,     help="maximum synapse delay")
+op.add_option("-l", "--steps",   action="store", type="int",   dest="steps",   default=100,   help="time range for input spikes")
+op.add_option("-r", "--rate",    action="store", type="float", dest="rate",    default=0.1,   help="probability an input spikes on a given step")
+op.add_option("-s", "--seed",    action="store", type="int",   dest="seed",    default=1)
+(options, args) = op.parse_args()
+
+random.seed(options.seed)
+total = options.inputs + options.neurons
+
+def synapses():
+    for j in range(options.fanout):
+        target = random.randrange(options.inputs, total)
+        weight = random.uniform(-0.2, 0.6)
+        delay  = random.randint(1, options.delay)
+        print(" %d,%g,%d" % (target, weight, delay))
+
+for i in range(options.inputs):
+    print(i)
+    times = [t for t in range(options.steps) if random.random() < options.rate]
+    if times: print(" t" + ",".join(str(t) for t in times))
+    synapses()
+
+for i in range(options.inputs, total):
+    Vthreshold = random.uniform(0.5, 1.5)
+    decay      = random.uniform(0, 0.2)
+    print("%d,0,%g,0,%g,1" % (i, Vthreshold, decay))
+    synapses()
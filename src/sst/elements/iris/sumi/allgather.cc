@@ -163,6 +163,13 @@ BruckActor::initDag()
   }
 }
 
+bool
+BruckActor::scheduleKey(CollectiveSchedule::Key& key) const
+{
+  makeScheduleKey(key, "bruck", nelems_);
+  return true;
+}
+
 void
 BruckActor::bufferAction(void *dst_buffer, void *msg_buffer, Action* ac)
 {
@@ -221,6 +228,13 @@ RingAllgatherActor::bufferAction(void *dst_buffer, void *msg_buffer, Action *ac)
   my_api_->memcopy(dst_buffer, msg_buffer, ac->nelems * type_size_);
 }
 
+bool
+RingAllgatherActor::scheduleKey(CollectiveSchedule::Key& key) const
+{
+  makeScheduleKey(key, "ring", nelems_);
+  return true;
+}
+
 void
 RingAllgatherActor::initDag()
 {
@@ -101,6 +101,7 @@ class BruckActor : public DagCollectiveActor
   void finalizeBuffers() override;
   void initBuffers() override;
   void initDag() override;
+  bool scheduleKey(CollectiveSchedule::Key& key) const override;
   void bufferAction(void *dst_buffer, void *msg_buffer, Action* ac) override;
 
   int nelems_;
@@ -174,6 +175,7 @@ class RingAllgatherActor : public DagCollectiveActor
   void finalizeBuffers() override;
   void initBuffers() override;
   void initDag() override;
+  bool scheduleKey(CollectiveSchedule::Key& key) const override;
   void bufferAction(void *dst_buffer, void *msg_buffer, Action* ac) override;
 
   int nelems_;
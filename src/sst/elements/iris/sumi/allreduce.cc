@@ -85,10 +85,28 @@ WilkeAllreduceActor::initBuffers()
 }
 
 void
-WilkeAllreduceActor::initDag()
+WilkeAllreduceActor::initTree()
 {
+  //everything but the actions is set up here, initDag is skipped
+  //when the schedule is already cached
   slicer_->fxn = fxn_;
 
+  int virtual_nproc, log2nproc, midpoint;
+  RecursiveDoubling::computeTree(dom_nproc_, log2nproc, midpoint, virtual_nproc);
+  num_reducing_rounds_ = log2nproc;
+  num_total_rounds_ = log2nproc * 2;
+}
+
+bool
+WilkeAllreduceActor::scheduleKey(CollectiveSchedule::Key& key) const
+{
+  makeScheduleKey(key, "wilke", nelems_);
+  return true;
+}
+
+void
+WilkeAllreduceActor::initDag()
+{
   int virtual_nproc, log2nproc, midpoint;
   RecursiveDoubling::computeTree(dom_nproc_, log2nproc, midpoint, virtual_nproc);
   VirtualRankMap rank_map(dom_nproc_, virtual_nproc);
@@ -217,9 +235,6 @@ WilkeAllreduceActor::initDag()
     } //end loop over fan-in recv rounds
 
   }
-
-  num_reducing_rounds_ = num_doubling_rounds;
-  num_total_rounds_ = num_doubling_rounds * 2;
 }
 
 bool
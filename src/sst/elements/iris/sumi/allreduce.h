@@ -76,7 +76,9 @@ class WilkeAllreduceActor :
   bool isLowerPartner(int virtual_me, int partner_gap);
   void finalizeBuffers() override;
   void initBuffers() override;
+  void initTree() override;
   void initDag() override;
+  bool scheduleKey(CollectiveSchedule::Key& key) const override;
 
  private:
   reduce_fxn fxn_;
@@ -156,6 +156,13 @@ BinaryTreeBcastActor::initDag()
   }
 }
 
+bool
+BinaryTreeBcastActor::scheduleKey(CollectiveSchedule::Key& key) const
+{
+  makeScheduleKey(key, "binary_tree", nelems_, root_);
+  return true;
+}
+
 void
 BinaryTreeBcastActor::initBuffers()
 {
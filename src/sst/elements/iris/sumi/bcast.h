@@ -73,6 +73,7 @@ class BinaryTreeBcastActor :
   void finalizeBuffers() override;
   void initBuffers() override;
   void initDag() override;
+  bool scheduleKey(CollectiveSchedule::Key& key) const override;
 
   void init_root(int me, int roundNproc, int nproc);
   void init_child(int me, int roundNproc, int nproc);
@@ -47,7 +47,9 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <iris/sumi/communicator.h>
 //#include <sprockit/output.h>
 #include <mercury/common/null_buffer.h>
+#include <chrono>
 #include <cstring>
+#include <unordered_map>
 #include <utility>
 
 //RegisterDebugSlot(sumi_collective_buffer);
@@ -147,6 +149,14 @@ DagCollectiveActor::start()
 #if SSTMAC_COMM_DELAY_STATS
   my_api_->startCollectiveMessageLog();
 #endif
+  if (schedule_){
+    for (int slot : schedule_->initialSlots()){
+      --sched_initial_left_;
+      startAction(scheduledAction(slot));
+    }
+    return;
+  }
+
   while (!initial_actions_.empty()){
     auto iter = initial_actions_.begin();
     Action* ac = *iter;
@@ -155,6 +165,136 @@ DagCollectiveActor::start()
   }
 }
 
+void
+DagCollectiveActor::initSchedule()
+{
+  CollectiveSchedule::Key key;
+  CollectiveScheduleCache& cache = engine_->scheduleCache();
+  if (!cache.enabled() || !scheduleKey(key)){
+    initDag();
+    return;
+  }
+
+  const CollectiveSchedule* schedule = cache.find(key);
+  if (schedule){
+    instantiateSchedule(schedule);
+    return;
+  }
+
+  auto build_start = std::chrono::steady_clock::now();
+  initDag();
+  std::unique_ptr<CollectiveSchedule> compiled = compileSchedule();
+  uint64_t build_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - build_start).count();
+
+  if (!compiled){
+    cache.uncacheable(build_ns);
+    return;
+  }
+
+  schedule = cache.insert(key, std::move(compiled), build_ns);
+  if (schedule){
+    //run this call from the schedule too, so every call takes the same path
+    deleteDagActions();
+    instantiateSchedule(schedule);
+  }
+}
+
+std::unique_ptr<CollectiveSchedule>
+DagCollectiveActor::compileSchedule() const
+{
+  std::vector<Action*> actions(initial_actions_.begin(), initial_actions_.end());
+  for (auto& pair : pending_comms_){
+    actions.push_back(pair.second);
+  }
+
+  std::unique_ptr<CollectiveSchedule> schedule(new CollectiveSchedule);
+  std::unordered_map<uint32_t, int> slots;
+  std::unordered_map<Action*, int> action_slots;
+  for (Action* ac : actions){
+    if (action_slots.find(ac) != action_slots.end()){
+      continue; //an action with several dependencies
+    }
+
+    int buf_type = 0;
+    CollectiveSchedule::storage_t storage = CollectiveSchedule::other_storage;
+    if (ac->type == Action::send){
+      buf_type = static_cast<SendAction*>(ac)->buf_type;
+      storage = CollectiveSchedule::send_storage;
+    } else if (ac->type == Action::recv){
+      buf_type = static_cast<RecvAction*>(ac)->buf_type;
+      storage = CollectiveSchedule::recv_storage;
+    }
+
+    if (!slots.emplace(ac->id, schedule->numSteps()).second){
+      return nullptr;
+    }
+    action_slots[ac] = schedule->addStep(ac->id, ac->type, buf_type, ac->round,
+                                         ac->partner, ac->offset, ac->nelems, storage);
+  }
+
+  for (auto& pair : pending_comms_){
+    auto iter = slots.find(pair.first);
+    if (iter == slots.end()){
+      return nullptr; //waiting on a rank to be resolved
+    }
+    schedule->addDependency(iter->second, action_slots[pair.second]);
+  }
+
+  schedule->finalize();
+  return schedule;
+}
+
+void
+DagCollectiveActor::deleteDagActions()
+{
+  std::set<Action*> actions(initial_actions_.begin(), initial_actions_.end());
+  for (auto& pair : pending_comms_){
+    actions.insert(pair.second);
+  }
+  for (Action* ac : actions){
+    delete ac;
+  }
+  initial_actions_.clear();
+  pending_comms_.clear();
+}
+
+void
+DagCollectiveActor::instantiateSchedule(const CollectiveSchedule* schedule)
+{
+  schedule_ = schedule;
+  sched_recvs_.reserve(schedule->numStorage(CollectiveSchedule::recv_storage));
+  sched_sends_.reserve(schedule->numStorage(CollectiveSchedule::send_storage));
+  sched_others_.reserve(schedule->numStorage(CollectiveSchedule::other_storage));
+
+  for (int slot=0; slot < schedule->numSteps(); ++slot){
+    const CollectiveSchedule::Step& st = schedule->step(slot);
+    Action* ac;
+    switch (st.storage){
+      case CollectiveSchedule::recv_storage:
+        sched_recvs_.emplace_back(st.round, st.partner, (RecvAction::buf_type_t) st.buf_type);
+        ac = &sched_recvs_.back();
+        break;
+      case CollectiveSchedule::send_storage:
+        sched_sends_.emplace_back(st.round, st.partner, (SendAction::buf_type_t) st.buf_type);
+        ac = &sched_sends_.back();
+        break;
+      default:
+        sched_others_.emplace_back((Action::type_t) st.type, st.round, st.partner);
+        ac = &sched_others_.back();
+        break;
+    }
+    ac->offset = st.offset;
+    ac->nelems = st.nelems;
+    ac->join_counter = st.join_counter;
+    ac->phys_partner = st.partner;
+    ac->slot = slot;
+  }
+
+  sched_deps_left_ = schedule->numDependencies();
+  sched_initial_left_ = schedule->initialSlots().size();
+}
+
 void
 DagCollectiveActor::startAction(Action* ac)
 {
@@ -215,6 +355,22 @@ DagCollectiveActor::startShuffle(Action * /*ac*/)
 void
 DagCollectiveActor::clearDependencies(Action* ac)
 {
+  if (schedule_ && ac->slot >= 0){
+    const CollectiveSchedule::Step& st = schedule_->step(ac->slot);
+    const int* successors = schedule_->successors(ac->slot);
+    for (int i=0; i < st.num_successors; ++i){
+      Action* pending = scheduledAction(successors[i]);
+      --sched_deps_left_;
+      pending->join_counter--;
+      output.output("Rank %s satisfying scheduled dependency to join counter %d for action %s to partner %s on round %d with action %u tag=%d",
+        rankStr().c_str(), pending->join_counter, Action::tostr(pending->type), rankStr(pending->partner).c_str(), pending->round,ac->id,tag_);
+      if (pending->join_counter == 0){
+        startAction(pending);
+      }
+    }
+    return;
+  }
+
   std::multimap<uint32_t, Action*>::iterator it = pending_comms_.find(ac->id);
   std::list<Action*> pending_actions;
   while (it != pending_comms_.end()){
@@ -244,7 +400,8 @@ DagCollectiveActor::clearAction(Action* ac)
   active_comms_.erase(ac->id);
   checkCollectiveDone();
   clearDependencies(ac);
-  completed_actions_.push_back(ac);
+  //scheduled actions are owned by the schedule arrays
+  if (ac->slot < 0) completed_actions_.push_back(ac);
 }
 
 void
@@ -392,7 +549,8 @@ DagCollectiveActor::checkCollectiveDone()
 {
   output.output("Rank %s has %lu active comms, %lu pending comms, %lu initial comms",
     rankStr().c_str(), active_comms_.size(), pending_comms_.size(), initial_actions_.size());
-  if (active_comms_.empty() && pending_comms_.empty() && initial_actions_.empty()){
+  if (active_comms_.empty() && pending_comms_.empty() && initial_actions_.empty()
+      && sched_deps_left_ == 0 && sched_initial_left_ == 0){
     finalize();
     putDoneNotification();
   }
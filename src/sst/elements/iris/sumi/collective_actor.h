@@ -48,6 +48,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <iris/sumi/collective_message.h>
 #include <iris/sumi/dense_rank_map.h>
 #include <iris/sumi/communicator.h>
+#include <iris/sumi/collective_schedule.h>
 #include <set>
 #include <map>
 #include <stdint.h>
@@ -81,6 +82,7 @@ struct Action
   int offset;
   int nelems;
   uint32_t id;
+  int slot; //position in a compiled schedule, -1 if not from one
   SST::Hg::Timestamp start;
 
   static const char*
@@ -124,7 +126,8 @@ struct Action
     type(ty), 
     partner(p),
     join_counter(0),
-    round(r)
+    round(r),
+    slot(-1)
   {
     id = messageId(ty, r, p);
   }
@@ -365,7 +368,7 @@ class DagCollectiveActor :
 
   void init() override {
     initTree();
-    initDag();
+    initSchedule();
     initBuffers();
   }
 
@@ -395,6 +398,30 @@ class DagCollectiveActor :
   void addDependency(Action* precursor, Action* ac);
   void addAction(Action* ac);
 
+  /**
+   * @brief Actors whose DAG depends only on the communicator size and rank,
+   *        the number of elements, the root and whether the datatype is
+   *        contiguous can reuse a compiled schedule.
+   *        initDag is then skipped on a hit, so it must not set any actor state
+   *        other than the actions - anything else belongs in initTree.
+   * @param key Filled in by makeScheduleKey
+   * @return Whether the DAG can be cached
+   */
+  virtual bool scheduleKey(CollectiveSchedule::Key& /*key*/) const {
+    return false;
+  }
+
+  void makeScheduleKey(CollectiveSchedule::Key& key, const char* algorithm,
+                       int nelems, int root = -1) const {
+    key.algorithm = algorithm;
+    key.type = type_;
+    key.nproc = dom_nproc_;
+    key.me = dom_me_;
+    key.nelems = nelems;
+    key.root = root;
+    key.contiguous = slicer_->contiguous();
+  }
+
   static bool isSharedRole(int role, int num_roles, int* my_roles){
     for (int r=0; r < num_roles; ++r){
       if (role == my_roles[r]){
@@ -417,6 +444,28 @@ class DagCollectiveActor :
 
   void checkCollectiveDone();
 
+  void initSchedule();
+
+  /**
+   * @brief Turn the actions built by initDag into a schedule
+   * @return nullptr if the DAG waits on unresolved ranks
+   *         or has two actions with the same message id
+   */
+  std::unique_ptr<CollectiveSchedule> compileSchedule() const;
+
+  void instantiateSchedule(const CollectiveSchedule* schedule);
+
+  void deleteDagActions();
+
+  Action* scheduledAction(int slot) {
+    const CollectiveSchedule::Step& st = schedule_->step(slot);
+    switch (st.storage){
+      case CollectiveSchedule::recv_storage: return &sched_recvs_[st.storage_index];
+      case CollectiveSchedule::send_storage: return &sched_sends_[st.storage_index];
+      default: return &sched_others_[st.storage_index];
+    }
+  }
+
   void putDoneNotification();
 
   void startSend(Action* ac);
@@ -523,6 +572,17 @@ class DagCollectiveActor :
 
   std::set<Action*, action_compare> initial_actions_;
 
+  /**
+   * When running from a cached schedule, the actions live in these arrays
+   * and their dependencies are only tracked by counts
+   */
+  const CollectiveSchedule* schedule_ = nullptr;
+  std::vector<RecvAction> sched_recvs_;
+  std::vector<SendAction> sched_sends_;
+  std::vector<Action> sched_others_;
+  int sched_deps_left_ = 0;
+  int sched_initial_left_ = 0;
+
 #ifdef FEATURE_TAG_SUMI_RESILIENCE
   void dense_partner_ping_failed(int dense_rank);
 #endif
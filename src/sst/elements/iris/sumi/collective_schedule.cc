@@ -0,0 +1,153 @@
+/**
+Copyright 2009-2023 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2023, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#include <iris/sumi/collective_schedule.h>
+#include <mercury/common/stl_string.h>
+#include <algorithm>
+#include <iostream>
+
+namespace SST::Iris::sumi {
+
+int
+CollectiveSchedule::addStep(uint32_t id, int type, int buf_type, int round, int partner,
+                            int offset, int nelems, storage_t storage)
+{
+  Step st;
+  st.id = id;
+  st.type = type;
+  st.buf_type = buf_type;
+  st.round = round;
+  st.partner = partner;
+  st.offset = offset;
+  st.nelems = nelems;
+  st.join_counter = 0;
+  st.storage = storage;
+  st.storage_index = num_storage_[storage]++;
+  st.first_successor = 0;
+  st.num_successors = 0;
+  steps_.push_back(st);
+  return steps_.size() - 1;
+}
+
+void
+CollectiveSchedule::addDependency(int precursor_slot, int slot)
+{
+  dependencies_.emplace_back(precursor_slot, slot);
+  steps_[slot].join_counter++;
+}
+
+void
+CollectiveSchedule::finalize()
+{
+  for (auto& dep : dependencies_){
+    steps_[dep.first].num_successors++;
+  }
+
+  int offset = 0;
+  for (Step& st : steps_){
+    st.first_successor = offset;
+    offset += st.num_successors;
+    st.num_successors = 0;
+  }
+
+  successors_.resize(dependencies_.size());
+  for (auto& dep : dependencies_){
+    Step& pre = steps_[dep.first];
+    successors_[pre.first_successor + pre.num_successors++] = dep.second;
+  }
+
+  for (int slot=0; slot < (int) steps_.size(); ++slot){
+    if (steps_[slot].join_counter == 0){
+      initial_.push_back(slot);
+    }
+  }
+  std::sort(initial_.begin(), initial_.end(), [this](int l, int r){
+    return steps_[l].id < steps_[r].id;
+  });
+}
+
+const CollectiveSchedule*
+CollectiveScheduleCache::find(const CollectiveSchedule::Key& key)
+{
+  auto iter = schedules_.find(key);
+  if (iter == schedules_.end()){
+    ++misses_;
+    return nullptr;
+  }
+  ++hits_;
+  return iter->second.get();
+}
+
+const CollectiveSchedule*
+CollectiveScheduleCache::insert(const CollectiveSchedule::Key& key,
+                                std::unique_ptr<CollectiveSchedule>&& schedule,
+                                uint64_t build_ns)
+{
+  build_ns_ += build_ns;
+  if ((int) schedules_.size() >= max_entries_){
+    return nullptr;
+  }
+  auto* ret = schedule.get();
+  schedules_[key] = std::move(schedule);
+  return ret;
+}
+
+void
+CollectiveScheduleCache::printStats(int rank) const
+{
+  uint64_t total = hits_ + misses_ + uncacheable_;
+  if (total == 0) return;
+
+  uint64_t builds = misses_ + uncacheable_;
+  std::cout << SST::Hg::sprintf("Rank %d collective schedules: %llu calls, %llu hits (%.1f%%), "
+                                "%llu builds, %llu uncacheable, %d cached, %.3f us mean build time",
+                  rank, (unsigned long long) total, (unsigned long long) hits_,
+                  100.0 * hits_ / total, (unsigned long long) builds,
+                  (unsigned long long) uncacheable_, (int) schedules_.size(),
+                  builds ? build_ns_ / 1e3 / builds : 0.0)
+            << std::endl;
+}
+
+}
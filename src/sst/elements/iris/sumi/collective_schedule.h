@@ -0,0 +1,227 @@
+/**
+Copyright 2009-2023 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2023, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+
+#pragma once
+
+#include <iris/sumi/collective.h>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+namespace SST::Iris::sumi {
+
+/**
+ * @class CollectiveSchedule
+ * The action DAG of one rank's actor in a collective, compiled once and
+ * shared by every later call with the same algorithm, communicator size,
+ * rank, element count, root and datatype layout. Actions only hold
+ * communicator ranks and element offsets, so none of the buffers or the
+ * tag are part of it. Whether the datatype is contiguous picks the
+ * buffer types of some actions, so it is part of the key.
+ * Each call copies the steps into a few arrays and walks the dependency
+ * lists here instead of building its own maps of Action objects.
+ */
+class CollectiveSchedule
+{
+ public:
+  struct Key {
+    const char* algorithm;
+    Collective::type_t type;
+    int nproc;
+    int me;
+    int nelems;
+    int root;
+    bool contiguous;
+
+    bool operator==(const Key& other) const {
+      return type == other.type && nproc == other.nproc && me == other.me
+          && nelems == other.nelems && root == other.root
+          && contiguous == other.contiguous
+          && ::strcmp(algorithm, other.algorithm) == 0;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t h = std::hash<int>()(key.type);
+      h = h*31 + std::hash<int>()(key.nproc);
+      h = h*31 + std::hash<int>()(key.me);
+      h = h*31 + std::hash<int>()(key.nelems);
+      h = h*31 + std::hash<int>()(key.root);
+      h = h*31 + std::hash<bool>()(key.contiguous);
+      return h;
+    }
+  };
+
+  typedef enum { recv_storage=0, send_storage=1, other_storage=2 } storage_t;
+
+  struct Step {
+    uint32_t id;
+    int type; //an Action::type_t
+    int buf_type; //a RecvAction or SendAction buf_type_t
+    int round;
+    int partner;
+    int offset;
+    int nelems;
+    int join_counter;
+    storage_t storage;
+    int storage_index;
+    int first_successor;
+    int num_successors;
+  };
+
+  /**
+   * @brief Add an action to the schedule
+   * @return The slot of the action in the schedule
+   */
+  int addStep(uint32_t id, int type, int buf_type, int round, int partner, int offset, int nelems, storage_t storage);
+
+  void addDependency(int precursor_slot, int slot);
+
+  /**
+   * @brief Build the successor lists and the initial action list.
+   *        No steps or dependencies can be added afterwards.
+   */
+  void finalize();
+
+  const Step& step(int slot) const {
+    return steps_[slot];
+  }
+
+  int numSteps() const {
+    return steps_.size();
+  }
+
+  int numStorage(storage_t ty) const {
+    return num_storage_[ty];
+  }
+
+  int numDependencies() const {
+    return dependencies_.size();
+  }
+
+  const int* successors(int slot) const {
+    return successors_.data() + steps_[slot].first_successor;
+  }
+
+  /**
+   * @return Actions with no dependencies, in order of message id
+   */
+  const std::vector<int>& initialSlots() const {
+    return initial_;
+  }
+
+ private:
+  std::vector<Step> steps_;
+  std::vector<std::pair<int,int>> dependencies_;
+  std::vector<int> successors_;
+  std::vector<int> initial_;
+  int num_storage_[3] = {0, 0, 0};
+};
+
+/**
+ * @class CollectiveScheduleCache
+ * Compiled schedules owned by a collective engine. Schedules are never
+ * evicted, since running actors point into them; once the cache is full
+ * new keys are simply built every time.
+ */
+class CollectiveScheduleCache
+{
+ public:
+  CollectiveScheduleCache(bool enabled, int max_entries) :
+    enabled_(enabled), max_entries_(max_entries)
+  {
+  }
+
+  bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * @return The schedule for the key, or nullptr after counting a miss
+   */
+  const CollectiveSchedule* find(const CollectiveSchedule::Key& key);
+
+  /**
+   * @brief Keep a schedule built after a miss
+   * @param build_ns The time spent building the DAG and compiling it
+   * @return The cached schedule, or nullptr if the cache is full
+   */
+  const CollectiveSchedule* insert(const CollectiveSchedule::Key& key,
+                                   std::unique_ptr<CollectiveSchedule>&& schedule,
+                                   uint64_t build_ns);
+
+  /**
+   * @brief Count a call whose DAG could not be cached
+   */
+  void uncacheable(uint64_t build_ns){
+    ++uncacheable_;
+    build_ns_ += build_ns;
+  }
+
+  void printStats(int rank) const;
+
+  uint64_t hits() const {
+    return hits_;
+  }
+
+  uint64_t misses() const {
+    return misses_;
+  }
+
+ private:
+  std::unordered_map<CollectiveSchedule::Key, std::unique_ptr<CollectiveSchedule>,
+                     CollectiveSchedule::KeyHash> schedules_;
+  bool enabled_;
+  int max_entries_;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  uint64_t uncacheable_ = 0;
+  uint64_t build_ns_ = 0;
+};
+
+}
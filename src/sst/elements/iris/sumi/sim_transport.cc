@@ -539,7 +539,9 @@ CollectiveEngine::CollectiveEngine(SST::Params& params, Transport *tport) :
   global_domain_(nullptr),
   eager_cutoff_(512),
   use_put_protocol_(false),
-  system_collective_tag_(-1) //negative tags reserved for special system work
+  system_collective_tag_(-1), //negative tags reserved for special system work
+  schedule_cache_(params.find<bool>("collective_schedule_cache", true),
+                  params.find<int>("collective_schedule_cache_size", 128))
 {
   global_domain_ = new GlobalCommunicator(tport);
   eager_cutoff_ = params.find<int>("eager_cutoff", 512);
@@ -552,10 +554,13 @@ CollectiveEngine::CollectiveEngine(SST::Params& params, Transport *tport) :
   rdma_header_qos_ = params.find<int>("collective_rdma_header_qos", default_qos);
   ack_qos_ = params.find<int>("collective_ack_qos", default_qos);
   smsg_qos_ = params.find<int>("collective_smsg_qos", default_qos);
+
+  print_schedule_stats_ = params.find<bool>("print_collective_schedule_stats", false);
 }
 
 CollectiveEngine::~CollectiveEngine()
 {
+  if (print_schedule_stats_) schedule_cache_.printStats(tport_->rank());
   if (global_domain_) delete global_domain_;
 }
 
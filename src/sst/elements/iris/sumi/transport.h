@@ -59,6 +59,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <iris/sumi/comm_functions.h>
 #include <iris/sumi/options.h>
 #include <iris/sumi/communicator_fwd.h>
+#include <iris/sumi/collective_schedule.h>
 
 #include <unordered_map>
 #include <queue>
@@ -372,6 +373,14 @@ class CollectiveEngine
 
   CollectiveDoneMessage* blockUntilNext(int cq_id);
 
+  /**
+   * Compiled collective DAGs, shared by every call with the same
+   * algorithm, communicator size and rank, element count and root
+   */
+  CollectiveScheduleCache& scheduleCache() {
+    return schedule_cache_;
+  }
+
   /**
    * The total size of the input buffer in bytes is nelems*type_size*comm_size
    * @param dst  Buffer for the result. Can be NULL to ignore payloads.
@@ -557,6 +566,9 @@ class CollectiveEngine
   std::string alltoall_type_;
   std::string allgather_type_;
 
+  CollectiveScheduleCache schedule_cache_;
+  bool print_schedule_stats_;
+
   int rdma_header_qos_;
   int rdma_get_qos_;
   int smsg_qos_;
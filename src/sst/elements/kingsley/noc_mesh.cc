@@ -36,6 +36,8 @@ using namespace std;
 // Start class functions
 noc_mesh::~noc_mesh()
 {
+    for ( auto event : event_pool ) delete event;
+    for ( auto event : credit_pool ) delete event;
 }
 
 noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
@@ -156,8 +158,13 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     }
 
 
-    // Allocate space for all the input buffers
+    // Allocate space for all the input buffers.  Every packet is at
+    // least one flit, so the credits limit the depth to one entry
+    // per flit of buffer.
     port_queues = new port_queue_t[local_port_start + local_ports];
+    for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+        port_queues[i].reserve(input_buf_size / flit_size);
+    }
     port_busy = new int[local_port_start + local_ports];
     for ( int i = 0; i < local_port_start + local_ports; ++i ) {
         port_busy[i] = 0;
@@ -228,7 +235,9 @@ noc_mesh::handle_input_r2r(Event* ev, int port)
         credit_event* credit_ret = static_cast<credit_event*>(ev);
         port_credits[port] += credit_ret->credits;
         // output.output("(%d,%d): Got credit event for VN %d with %d credits\n",my_x,my_y,credit_ret->vn,credit_ret->credits);
-        delete ev;
+        credit_pool.push_back(credit_ret);
+        if (clock_is_off && !credit_stalls.empty())
+            clock_wakeup();
         break;
     }
     case BaseNocEvent::INTERNAL:
@@ -249,10 +258,38 @@ noc_mesh::handle_input_r2r(Event* ev, int port)
 
 }
 
+noc_mesh_event*
+noc_mesh::alloc_event(NocPacket* packet)
+{
+    if ( event_pool.empty() ) return new noc_mesh_event(packet);
+    noc_mesh_event* event = event_pool.back();
+    event_pool.pop_back();
+    event->encap_ev = packet;
+    return event;
+}
+
+void
+noc_mesh::recycle_event(noc_mesh_event* event)
+{
+    event->encap_ev = NULL;
+    event_pool.push_back(event);
+}
+
+credit_event*
+noc_mesh::alloc_credit(int credits)
+{
+    if ( credit_pool.empty() ) return new credit_event(0, credits);
+    credit_event* event = credit_pool.back();
+    credit_pool.pop_back();
+    event->vn = 0;
+    event->credits = credits;
+    return event;
+}
+
 noc_mesh_event*
 noc_mesh::wrap_incoming_packet(NocPacket* packet) {
     // Wrap the incoming NocPacket in a noc_mesh_event
-    noc_mesh_event* event = new noc_mesh_event(packet);
+    noc_mesh_event* event = alloc_event(packet);
 
     // Compute the destination router
     int dest = packet->request->dest;
@@ -319,7 +356,9 @@ noc_mesh::handle_input_ep2r(Event* ev, int port)
     {
         credit_event* credit_ret = static_cast<credit_event*>(ev);
         port_credits[port] += credit_ret->credits;
-        delete ev;
+        credit_pool.push_back(credit_ret);
+        if (clock_is_off && !credit_stalls.empty())
+            clock_wakeup();
         break;
     }
     case BaseNocEvent::PACKET:
@@ -355,6 +394,17 @@ noc_mesh::handle_input_ep2r(Event* ev, int port)
 void noc_mesh::clock_wakeup() {
     Cycle_t time = reregisterClock(clock_tc, my_clock_handler);
     Cycle_t cyclesOff = time - last_time - 1;
+
+    // Each cycle the clock was off, every queue head waiting on
+    // credits would have stalled, on the xbar while its output port
+    // was still busy and on the output port after that.
+    for ( int port : credit_stalls ) {
+        Cycle_t busy_cycles = port_busy[port] > 1 ? std::min<Cycle_t>(port_busy[port] - 1, cyclesOff) : 0;
+        if ( busy_cycles > 0 ) xbar_stalls[port]->addDataNTimes(busy_cycles, 1);
+        if ( cyclesOff > busy_cycles ) output_port_stalls[port]->addDataNTimes(cyclesOff - busy_cycles, 1);
+    }
+    credit_stalls.clear();
+
     // Update busy values
     for ( int i = 0; i < local_port_start + local_ports; ++i) {
         port_busy[i] = (port_busy[i] < cyclesOff) ? 0 : port_busy[i] - cyclesOff;
@@ -424,8 +474,7 @@ noc_mesh::clock_handler(Cycle_t cycle)
                     if ( edge_status & ( 1 << port) ) {
                         ports[port]->send(event->encap_ev);
                         send_bit_count[port]->addData(event->encap_ev->request->size_in_bits);
-                        event->encap_ev = NULL;
-                        delete event;
+                        recycle_event(event);
                     }
                     else {
                         ports[port]->send(event);
@@ -443,7 +492,7 @@ noc_mesh::clock_handler(Cycle_t cycle)
                                       dest);
                     }
                     // Need to send credit event back to last router
-                    credit_event* cr_ev = new credit_event(0, flits);
+                    credit_event* cr_ev = alloc_credit(flits);
                     // ports[local_port_start + i]->send(cr_ev);
                     ports[lru_port]->send(cr_ev);
                     lru.satisfied(true);
@@ -462,6 +511,24 @@ noc_mesh::clock_handler(Cycle_t cycle)
     }
 
     // }
+
+    // A queue head that doesn't have enough credits stays blocked
+    // until a credit event arrives, so if that is all that is left,
+    // turn the clock off and let the credit event wake it up.
+    credit_stalls.clear();
+    if ( keepClockOn ) {
+        keepClockOn = false;
+        for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+            if ( port_queues[i].empty() ) continue;
+            noc_mesh_event* event = port_queues[i].front();
+            if ( port_credits[event->next_port] >= event->encap_ev->getSizeInFlits() ) {
+                keepClockOn = true;
+                credit_stalls.clear();
+                break;
+            }
+            credit_stalls.push_back(event->next_port);
+        }
+    }
     clock_is_off = !keepClockOn;
 
     // Stay on clock list
@@ -27,10 +27,11 @@
 
 #include <sst/core/statapi/stataccumulator.h>
 
-#include <queue>
+#include <vector>
 
 #include "sst/elements/kingsley/nocEvents.h"
 #include "sst/elements/kingsley/lru_unit.h"
+#include "sst/elements/kingsley/ring_buffer.h"
 
 using namespace SST;
 
@@ -111,13 +112,17 @@ private:
     bool route_y_first;
 
 
-    typedef std::queue<noc_mesh_event*> port_queue_t;
+    typedef ring_buffer<noc_mesh_event*> port_queue_t;
 
     Clock::Handler<noc_mesh>* my_clock_handler;
     TimeConverter* clock_tc;
     void clock_wakeup();
     bool clock_is_off;
     Cycle_t last_time = 0;
+    // Output ports that queue heads were waiting on for credits when
+    // the clock was turned off.  Used to account for stalls while
+    // the clock is off.
+    std::vector<int> credit_stalls;
 
     Link** ports;
     port_queue_t* port_queues;
@@ -129,6 +134,15 @@ private:
     Shared::SharedArray<int> dense_map;
 
     std::vector< lru_unit<int> > lru_units;
+
+    // Recycled events, to avoid an allocation per packet and per
+    // credit return
+    std::vector<noc_mesh_event*> event_pool;
+    std::vector<credit_event*> credit_pool;
+
+    noc_mesh_event* alloc_event(NocPacket* packet);
+    void recycle_event(noc_mesh_event* event);
+    credit_event* alloc_credit(int credits);
     // lru_unit<int> local_lru;
     // lru_unit<int> mesh_lru;
 
@@ -0,0 +1,83 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_KINGSLEY_RING_BUFFER_H
+#define COMPONENTS_KINGSLEY_RING_BUFFER_H
+
+#include <vector>
+#include <cstddef>
+
+namespace SST {
+namespace Kingsley {
+
+// FIFO backed by a power of two sized array.  Storage is allocated up
+// front for the expected depth and only grows if that depth is
+// exceeded.  Provides the subset of std::queue used by the router.
+template<typename T>
+class ring_buffer {
+
+    std::vector<T> buffer;
+    size_t head;
+    size_t count;
+    size_t mask;
+
+    void grow() {
+        std::vector<T> new_buffer(buffer.size() * 2);
+        for ( size_t i = 0; i < count; ++i ) {
+            new_buffer[i] = buffer[(head + i) & mask];
+        }
+        buffer.swap(new_buffer);
+        mask = buffer.size() - 1;
+        head = 0;
+    }
+
+public:
+    ring_buffer(size_t capacity = 4) : head(0), count(0)
+    {
+        reserve(capacity);
+    }
+
+    // Sets the initial depth.  Only valid while the buffer is empty.
+    void reserve(size_t capacity) {
+        size_t size = 1;
+        while ( size < capacity ) size <<= 1;
+        buffer.assign(size, T());
+        mask = size - 1;
+        head = 0;
+    }
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    T& front() { return buffer[head]; }
+
+    void push(const T& data) {
+        if ( count == buffer.size() ) grow();
+        buffer[(head + count) & mask] = data;
+        count++;
+    }
+
+    void pop() {
+        head = (head + 1) & mask;
+        count--;
+    }
+
+};
+
+}
+}
+
+#endif // COMPONENTS_KINGSLEY_RING_BUFFER_H
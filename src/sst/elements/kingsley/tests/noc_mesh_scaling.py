@@ -0,0 +1,109 @@
+# Scaling benchmark for kingsley.noc_mesh.
+#
+# Builds an x_size by y_size mesh with endpoints on every router and
+# on the halo, using the same configuration as noc_mesh_32_test.py.
+# Most routers are idle most of the time, so this shows the effect of
+# turning the router clocks off when there is nothing to do.
+#
+# Run a sweep with, for example:
+#   for n in 8 16 32 64; do
+#     /usr/bin/time -f "$n x $n: %e s, %M KB" sst --print-timing-info noc_mesh_scaling.py --model-options="--size $n"
+#   done
+
+import sst
+import argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--size", type=int, default=8, help="mesh size in each dimension")
+parser.add_argument("--x_size", type=int, default=0, help="overrides --size in the X dimension")
+parser.add_argument("--y_size", type=int, default=0, help="overrides --size in the Y dimension")
+parser.add_argument("--endpoints", type=int, default=1, help="endpoints per router")
+parser.add_argument("--messages", type=int, default=10, help="messages sent by each endpoint")
+parser.add_argument("--stats", action="store_true", help="write router statistics to stats.csv")
+args = parser.parse_args()
+
+x_size = args.x_size or args.size
+y_size = args.y_size or args.size
+num_endpoints = args.endpoints
+
+num_peers = (num_endpoints * (x_size * y_size)) + (2*x_size) + (2*y_size)
+msg_size = "64B"
+link_bw = "32GB/s"
+flit_size = "32B"
+input_buf_size = "64B"
+
+sst.setProgramOption("timebase", "1ps")
+
+links = dict()
+def getLink(name1, name2):
+    name = "link.%s_%s"%(name1, name2)
+    if name not in links:
+        links[name] = sst.Link(name)
+    return links[name]
+
+def addEndpoint(name, link):
+    ep = sst.Component(name, "merlin.test_nic")
+    ep.addParams({
+        "num_peers" : "%d"%(num_peers),
+        "link_bw" : "1GB/s",
+        "message_size" : msg_size,
+        "num_messages" : "%d"%(args.messages)
+    })
+    sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
+    sub.addParam("link_bw","1GB/s")
+    sub.addLink(link, "rtr_port", "800ps")
+
+for y in range(y_size):
+    for x in range(x_size):
+        rtr = sst.Component("rtr_%d_%d"%(x,y), "kingsley.noc_mesh")
+        rtr.addParams({
+            "local_ports" : "%d"%(num_endpoints),
+            "link_bw" : link_bw,
+            "input_buf_size" : input_buf_size,
+            "flit_size" : flit_size,
+            "use_dense_map" : "true"
+        })
+
+        # Mesh links, with halo endpoints on the edges
+        if y != y_size - 1:
+            rtr.addLink(getLink("rtr_%d_%d"%(x,y), "rtr_%d_%d"%(x,y+1)), "north", "800ps")
+        else:
+            link = getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x,y+1))
+            rtr.addLink(link, "north", "800ps")
+            addEndpoint("ep0_%d_%d"%(x,y+1), link)
+
+        if y != 0:
+            rtr.addLink(getLink("rtr_%d_%d"%(x,y-1), "rtr_%d_%d"%(x,y)), "south", "800ps")
+        else:
+            link = getLink("rtr_%d_X"%(x), "ep0_%d_%d"%(x,y))
+            rtr.addLink(link, "south", "800ps")
+            addEndpoint("ep0_%d_X"%(x), link)
+
+        if x != x_size - 1:
+            rtr.addLink(getLink("rtr_%d_%d"%(x,y), "rtr_%d_%d"%(x+1,y)), "east", "800ps")
+        else:
+            link = getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x+1,y))
+            rtr.addLink(link, "east", "800ps")
+            addEndpoint("ep0_%d_%d"%(x+1,y), link)
+
+        if x != 0:
+            rtr.addLink(getLink("rtr_%d_%d"%(x-1,y), "rtr_%d_%d"%(x,y)), "west", "800ps")
+        else:
+            link = getLink("rtr_X_%d"%(y), "ep0_%d_%d"%(x,y))
+            rtr.addLink(link, "west", "800ps")
+            addEndpoint("ep0_X_%d"%(y), link)
+
+        # Local endpoints
+        for z in range(num_endpoints):
+            link = getLink("rtr_%d_%d"%(x,y), "ep%d_%d_%d"%(z,x,y))
+            rtr.addLink(link, "local%d"%(z), "800ps")
+            addEndpoint("ep%d_%d_%d"%(z,x,y), link)
+
+if args.stats:
+    sst.setStatisticLoadLevel(9)
+    sst.setStatisticOutput("sst.statOutputCSV")
+    sst.setStatisticOutputOptions({
+        "filepath" : "stats.csv",
+        "separator" : ", "
+    })
+    sst.enableAllStatisticsForComponentType("kingsley.noc_mesh", {"type":"sst.AccumulatorStatistic","rate":"0ns"})
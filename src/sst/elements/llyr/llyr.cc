@@ -53,6 +53,8 @@ LlyrComponent::LlyrComponent(ComponentId_t id, Params& params) :
     output_->verbose(CALL_INFO, 1, 0, "Clock is configured for %s\n", clock_rate.c_str());
     clock_tick_handler_ = new Clock::Handler<LlyrComponent>(this, &LlyrComponent::tick);
     time_converter_ = registerClock(clock_rate, clock_tick_handler_);
+    handler_registered_ = 1;
+    last_tick_ = 0;
 
     //set up memory interfaces
     mem_interface_ = loadUserSubComponent<SST::Interfaces::StandardMem>("iface", ComponentInfo::SHARE_NONE, time_converter_,
@@ -121,6 +123,9 @@ LlyrComponent::LlyrComponent(ComponentId_t id, Params& params) :
     llyr_mapper_->mapGraph(hardwareGraph_, applicationGraph_, mappedGraph_, configData_);
     mappedGraph_.printDotHardware("llyr_mapped.dot");
 
+    //flatten the mapped graph for the clock handler
+    compileGraph();
+
     //init stats
     zeroEventCycles_ = registerStatistic< uint64_t >("cycles_zero_events");
     eventCycles_ = registerStatistic< uint64_t >("cycles_events");
@@ -213,60 +218,147 @@ void LlyrComponent::finish()
 {
 }
 
+void LlyrComponent::compileGraph()
+{
+    //BFS from node 0 (the dummy entry node) fixes the order PEs are evaluated in each tick
+    std::queue< uint32_t > nodeQueue;
+    std::map< ProcessingElement*, uint32_t > pePosition;
+
+    std::map< uint32_t, Vertex< ProcessingElement* > >* vertex_map_ = mappedGraph_.getVertexMap();
+    for( auto vertexIterator = vertex_map_->begin(); vertexIterator != vertex_map_->end(); ++vertexIterator ) {
+        vertexIterator->second.setVisited(0);
+    }
+
+    nodeQueue.push(0);
+    vertex_map_->at(0).setVisited(1);
+    while( nodeQueue.empty() == 0 ) {
+        uint32_t currentNode = nodeQueue.front();
+        nodeQueue.pop();
+
+        ProcessingElement* pe = vertex_map_->at(currentNode).getValue();
+        vertex_position_[currentNode] = pe_order_.size();
+        pePosition[pe] = pe_order_.size();
+        pe_order_.push_back(pe);
+
+        std::vector< Edge* >* adjacencyList = vertex_map_->at(currentNode).getAdjacencyList();
+        for( auto it = adjacencyList->begin(); it != adjacencyList->end(); it++ ) {
+            uint32_t destinationVertx = (*it)->getDestination();
+            if( vertex_map_->at(destinationVertx).getVisited() == 0 ) {
+                vertex_map_->at(destinationVertx).setVisited(1);
+                nodeQueue.push(destinationVertx);
+            }
+        }
+    }
+
+    //resolve the send targets of each PE now that all queues are bound
+    pe_successors_.resize(pe_order_.size());
+    for( uint32_t position = 0; position < pe_order_.size(); ++position ) {
+        pe_order_[position]->compileLinks();
+
+        const std::vector< SendLink >& links = pe_order_[position]->getSendLinks();
+        for( auto it = links.begin(); it != links.end(); ++it ) {
+            auto dst = pePosition.find(it->dst_pe_);
+            if( dst != pePosition.end() ) {
+                pe_successors_[position].push_back(dst->second);
+            }
+        }
+    }
+
+    //every PE is evaluated on the first tick
+    queued_now_.assign(pe_order_.size(), 0);
+    queued_next_.assign(pe_order_.size(), 1);
+    for( uint32_t position = 0; position < pe_order_.size(); ++position ) {
+        ready_next_.push_back(position);
+    }
+
+    output_->verbose(CALL_INFO, 1, 0, "Compiled %" PRIu64 " PEs for execution\n", uint64_t(pe_order_.size()));
+}
+
+void LlyrComponent::activatePe( uint32_t position, uint32_t boundary )
+{
+    //PEs at or after the boundary have not been evaluated yet this tick
+    if( position >= boundary ) {
+        if( queued_now_[position] == 0 ) {
+            queued_now_[position] = 1;
+            ready_now_.push(position);
+        }
+    } else if( queued_next_[position] == 0 ) {
+        queued_next_[position] = 1;
+        ready_next_.push_back(position);
+    }
+}
+
+bool LlyrComponent::lsHeadReady() const
+{
+    return ls_queue_->getNumEntries() > 0 && ls_queue_->getEntryReady(ls_queue_->getNextEntry()) != 0;
+}
+
 bool LlyrComponent::tick(SST::Cycle_t currentCycle)
 {
     // TraceFunction trace(CALL_INFO_LONG);
     if( clock_enabled_ == 0 ) {
-        return false;
+        // wait for the host to start the device, handle(Write) restarts the clock
+        handler_registered_ = 0;
+        return true;
     }
 
     compute_complete = 0;
-    //On each tick perform BFS on graph and compute based on operand availability
+    //PEs are evaluated in BFS order, but only those whose queues may have changed are on the ready list
     //NOTE node0 is a dummy node to simplify the algorithm
-    std::queue< uint32_t > nodeQueue;
-
     output_->verbose(CALL_INFO, 1, 0, "Device clock tick\n");
 
-    //Mark all nodes in the PE graph un-visited
-    std::map< uint32_t, Vertex< ProcessingElement* > >* vertex_map_ = mappedGraph_.getVertexMap();
-    typename std::map< uint32_t, Vertex< ProcessingElement* > >::iterator vertexIterator;
-    for(vertexIterator = vertex_map_->begin(); vertexIterator != vertex_map_->end(); ++vertexIterator) {
-        vertexIterator->second.setVisited(0);
+    for( auto it = ready_next_.begin(); it != ready_next_.end(); ++it ) {
+        queued_next_[*it] = 0;
+        activatePe(*it, 0);
     }
+    ready_next_.clear();
+
+    //one round of L/S ops precedes each PE in BFS order, as if every PE were visited
+    const uint32_t num_pes = pe_order_.size();
+    uint32_t ls_round = 0;
+    while( 1 ) {
+        while( ls_round < num_pes && lsHeadReady() ) {
+            if( ready_now_.empty() == 0 && ls_round > ready_now_.top() ) {
+                break;
+            }
 
-    //Node 0 is a dummy node and is always the entry point
-    nodeQueue.push(0);
+            //send n responses from L/S unit to destination
+            doLoadStoreOps(ls_entries_, ls_round);
+            ++ls_round;
+        }
 
-    //BFS and do operations if values available in input queues
-    while( nodeQueue.empty() == 0 ) {
-        uint32_t currentNode = nodeQueue.front();
-        nodeQueue.pop();
+        //once the head is waiting on memory the remaining rounds cannot do anything this tick
+        if( lsHeadReady() == 0 ) {
+            ls_round = num_pes;
+        }
 
-        std::vector< Edge* >* adjacencyList = vertex_map_->at(currentNode).getAdjacencyList();
+        if( ready_now_.empty() == 1 ) {
+            break;
+        }
 
-        //set visited for bfs
-        vertex_map_->at(currentNode).setVisited(1);
+        uint32_t position = ready_now_.top();
+        ready_now_.pop();
+        queued_now_[position] = 0;
 
-        //send n responses from L/S unit to destination
-        doLoadStoreOps(ls_entries_);
+        ProcessingElement* pe = pe_order_[position];
 
         //Let the PE decide whether or not it can do the compute
-        vertex_map_->at(currentNode).getValue()->doCompute();
+        pe->doCompute();
 
         //send one item from each output queue to destination
-        vertex_map_->at(currentNode).getValue()->doSend();
+        pe->doSend();
 
-        compute_complete = compute_complete | vertex_map_->at(currentNode).getValue()->getPendingOp();
+        compute_complete = compute_complete | pe->getPendingOp();
         output_->verbose(CALL_INFO, 1, 0, "PE(%" PRIu32 ") pending: %" PRIu32 " status: %" PRIu32 "\n\n",
-                        currentNode, vertex_map_->at(currentNode).getValue()->getPendingOp(), compute_complete );
+                        pe->getProcessorId(), pe->getPendingOp(), compute_complete );
 
-        //add the destination vertices from this node to the node queue
-        for( auto it = adjacencyList->begin(); it != adjacencyList->end(); it++ ) {
-            uint32_t destinationVertx = (*it)->getDestination();
-            if( vertex_map_->at(destinationVertx).getVisited() == 0 ) {
-                vertex_map_->at(destinationVertx).setVisited(1);
-                nodeQueue.push(destinationVertx);
-            }
+        //destinations may have new tokens, downstream ones are still evaluated this tick
+        for( auto it = pe_successors_[position].begin(); it != pe_successors_[position].end(); ++it ) {
+            activatePe(*it, position + 1);
+        }
+
+        if( pe->isQuiescent() == 0 ) {
+            activatePe(position, position + 1);
         }
     }
 
@@ -278,6 +370,13 @@ bool LlyrComponent::tick(SST::Cycle_t currentCycle)
     } else if( ls_queue_->getNumEntries() > 0 ) {
         zeroEventCycles_->addData(1);
         output_->verbose(CALL_INFO, 40, 0, "Continuing simulation due to live memory...\n");
+
+        //nothing can happen until memory responds, so stop the clock until it does
+        if( ready_next_.empty() == 1 && lsHeadReady() == 0 ) {
+            last_tick_ = currentCycle;
+            handler_registered_ = 0;
+            return true;
+        }
         return false;
     } else {
         output_->verbose(CALL_INFO, 40, 0, "Ending simulation due to flying cows...\n");
@@ -286,6 +385,22 @@ bool LlyrComponent::tick(SST::Cycle_t currentCycle)
     }
 }
 
+void LlyrComponent::wakeClock()
+{
+    if( handler_registered_ == 1 || clock_enabled_ == 0 ) {
+        return;
+    }
+
+    //account for the cycles spent waiting on memory while the clock was off
+    SST::Cycle_t skipped = getCurrentSimTime(time_converter_) - last_tick_;
+    if( skipped > 0 ) {
+        zeroEventCycles_->addDataNTimes(skipped, 1);
+    }
+
+    reregisterClock(time_converter_, clock_tick_handler_);
+    handler_registered_ = 1;
+}
+
 void LlyrComponent::handleEvent(StandardMem::Request* req) {
     req->handle(mem_handlers_);
 }
@@ -304,6 +419,10 @@ void LlyrComponent::LlyrMemHandlers::handle(StandardMem::Write* write) {
     out->verbose(CALL_INFO, 8, 0, "Handle Write for Address p-0x%" PRIx64 " -- v-0x%" PRIx64 ".\n", write->pAddr, write->vAddr);
 
     llyr_->clock_enabled_ = 1;
+    if( llyr_->handler_registered_ == 0 ) {
+        llyr_->reregisterClock(llyr_->time_converter_, llyr_->clock_tick_handler_);
+        llyr_->handler_registered_ = 1;
+    }
 
     /* Send response (ack) if needed */
     if (!(write->posted)) {
@@ -346,6 +465,7 @@ void LlyrComponent::LlyrMemHandlers::handle(StandardMem::ReadResp* resp) {
 
     ls_queue_->setEntryData( resp->getID(), testArg );
     ls_queue_->setEntryReady( resp->getID(), 1 );
+    llyr_->wakeClock();
 
     // Need to clean up the events coming back from the cache
     delete resp;
@@ -359,13 +479,14 @@ void LlyrComponent::LlyrMemHandlers::handle(StandardMem::WriteResp* resp) {
     out->verbose(CALL_INFO, 8, 0, "Response to a write for addr: %" PRIu64 " to PE %" PRIu32 "\n",
                  resp->pAddr, ls_queue_->lookupEntry( resp->getID() ).second );
     ls_queue_->setEntryReady( resp->getID(), 2 );
+    llyr_->wakeClock();
 
     // Need to clean up the events coming back from the cache
     delete resp;
     out->verbose(CALL_INFO, 4, 0, "Complete cache response handling.\n");
 }
 
-void LlyrComponent::doLoadStoreOps( uint32_t numOps )
+void LlyrComponent::doLoadStoreOps( uint32_t numOps, uint32_t round )
 {
     // TraceFunction trace(CALL_INFO_LONG);
     output_->verbose(CALL_INFO, 10, 0, "Doing L/S ops\n");
@@ -381,6 +502,11 @@ void LlyrComponent::doLoadStoreOps( uint32_t numOps )
 
                 mappedGraph_.getVertex(srcPe)->getValue()->doReceive(data);
 
+                auto position = vertex_position_.find(srcPe);
+                if( position != vertex_position_.end() ) {
+                    activatePe(position->second, round);
+                }
+
                 ls_queue_->removeEntry( next );
             } else if( ls_queue_->getEntryReady(next) == 2 ){
                 output_->verbose(CALL_INFO, 10, 0, "--(2)Mem Req ID %" PRIu32 "\n", uint32_t(next));
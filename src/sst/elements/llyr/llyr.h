@@ -21,9 +21,13 @@
 #include <sst/core/component.h>
 #include <sst/core/interfaces/stdMem.h>
 
+#include <queue>
 #include <string>
+#include <vector>
 #include <fstream>
 #include <cinttypes>
+#include <functional>
+#include <unordered_map>
 
 #include "graph/graph.h"
 #include "lsQueue.h"
@@ -160,7 +164,26 @@ private:
 
     uint32_t ls_entries_;
     LSQueue* ls_queue_;
-    void doLoadStoreOps( uint32_t numOps );
+    void doLoadStoreOps( uint32_t numOps, uint32_t round );
+    bool lsHeadReady() const;
+
+    // Mapped graph compiled at construction: PEs in BFS order from the dummy node 0 and,
+    // per position, the positions of the PEs its output queues feed
+    std::vector< ProcessingElement* > pe_order_;
+    std::vector< std::vector< uint32_t > > pe_successors_;
+    std::unordered_map< uint32_t, uint32_t > vertex_position_;
+    void compileGraph();
+
+    // Ready list: PEs to evaluate this tick (in BFS order) and on the next tick
+    std::priority_queue< uint32_t, std::vector< uint32_t >, std::greater< uint32_t > > ready_now_;
+    std::vector< uint32_t > ready_next_;
+    std::vector< uint8_t > queued_now_;
+    std::vector< uint8_t > queued_next_;
+    void activatePe( uint32_t position, uint32_t boundary );
+
+    // Clock is stopped while waiting on memory with no live tokens
+    SST::Cycle_t last_tick_;
+    void wakeClock();
 
 };
 
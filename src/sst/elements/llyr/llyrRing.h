@@ -0,0 +1,96 @@
+// Copyright 2013-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _LLYR_RING
+#define _LLYR_RING
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace SST {
+namespace Llyr {
+
+/**
+ * Ring buffer used for the PE input/output queues. Storage is allocated once
+ * at the queue depth (rounded up to a power of two) and only grows if a PE
+ * pushes past that depth, e.g. when routing or re-queuing a constant.
+ * Provides the subset of the std::queue interface the PEs use.
+ */
+template< typename T >
+class LlyrRing
+{
+public:
+    explicit LlyrRing( uint32_t capacity = 16 ) : head_(0), count_(0)
+    {
+        size_t ringSize = 1;
+        while( ringSize < capacity ) {
+            ringSize = ringSize << 1;
+        }
+
+        buffer_.resize(ringSize);
+        mask_ = ringSize - 1;
+    }
+
+    bool   empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+
+    T& front() { return buffer_[head_]; }
+    const T& front() const { return buffer_[head_]; }
+
+    T& back() { return buffer_[(head_ + count_ - 1) & mask_]; }
+    const T& back() const { return buffer_[(head_ + count_ - 1) & mask_]; }
+
+    void push( const T& value )
+    {
+        if( count_ == buffer_.size() ) {
+            grow();
+        }
+
+        buffer_[(head_ + count_) & mask_] = value;
+        ++count_;
+    }
+
+    void pop()
+    {
+        head_ = (head_ + 1) & mask_;
+        --count_;
+    }
+
+private:
+    void grow()
+    {
+        std::vector< T > newBuffer(buffer_.size() << 1);
+        for( size_t i = 0; i < count_; ++i ) {
+            newBuffer[i] = buffer_[(head_ + i) & mask_];
+        }
+
+        buffer_.swap(newBuffer);
+        mask_ = buffer_.size() - 1;
+        head_ = 0;
+    }
+
+    std::vector< T > buffer_;
+    size_t head_;
+    size_t count_;
+    size_t mask_;
+
+}; // LlyrRing
+
+} // namespace Llyr
+} // namespace SST
+
+#endif // _LLYR_RING
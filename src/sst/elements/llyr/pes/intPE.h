@@ -329,7 +329,7 @@ public:
             tempQueue->forwarded_ = 0;
             tempQueue->argument_ = 0;  //TODO all args are consts right now, should change to -1
             tempQueue->routing_arg_ = new std::string("");
-            tempQueue->data_queue_ = new std::queue< LlyrData >;
+            tempQueue->data_queue_ = new LlyrRing< LlyrData >( queue_depth_ );
             input_queues_->push_back(tempQueue);
         }
 
@@ -617,7 +617,7 @@ std::cout << "XXX " << temp.to_ullong() << " + " << argList[0].to_ullong() <<std
             tempQueue->forwarded_ = 0;
             tempQueue->argument_ = 0;
             tempQueue->routing_arg_ = new std::string("");
-            tempQueue->data_queue_ = new std::queue< LlyrData >;
+            tempQueue->data_queue_ = new LlyrRing< LlyrData >( queue_depth_ );
             input_queues_->push_back(tempQueue);
         }
 
@@ -32,6 +32,7 @@
 
 #include "../graph/graph.h"
 #include "../lsQueue.h"
+#include "../llyrRing.h"
 #include "../llyrTypes.h"
 #include "../llyrHelpers.h"
 
@@ -43,7 +44,7 @@ typedef struct alignas(uint64_t) {
     bool forwarded_;
     int32_t argument_;
     std::string* routing_arg_;
-    std::queue< LlyrData >* data_queue_;
+    LlyrRing< LlyrData >* data_queue_;
 } LlyrQueue;
 
 typedef struct alignas(uint64_t) {
@@ -51,6 +52,15 @@ typedef struct alignas(uint64_t) {
     LlyrData    data_;
 } QueueData;
 
+class ProcessingElement;
+
+// Output queue resolved to the destination PE and its matching input queue
+typedef struct {
+    uint32_t            queue_id_;
+    ProcessingElement*  dst_pe_;
+    int32_t             dst_queue_;
+} SendLink;
+
 class ProcessingElement
 {
 public:
@@ -90,7 +100,7 @@ public:
         tempQueue->forwarded_ = 0;
         tempQueue->argument_  = 0;
         tempQueue->routing_arg_ = new std::string("");
-        tempQueue->data_queue_ = new std::queue< LlyrData >;
+        tempQueue->data_queue_ = new LlyrRing< LlyrData >( queue_depth_ );
         input_queues_->push_back(tempQueue);
 
         return queueId;
@@ -111,7 +121,7 @@ public:
             tempQueue->forwarded_   = 0;
             tempQueue->routing_arg_ = new std::string("");
             tempQueue->argument_    = 0;
-            tempQueue->data_queue_  = new std::queue< LlyrData >;
+            tempQueue->data_queue_  = new LlyrRing< LlyrData >( queue_depth_ );
             input_queues_->push_back(tempQueue);
         }
 
@@ -135,7 +145,7 @@ public:
             tempQueue->forwarded_   = 0;
             tempQueue->routing_arg_ = new std::string("");
             tempQueue->argument_    = 0;
-            tempQueue->data_queue_  = new std::queue< LlyrData >;
+            tempQueue->data_queue_  = new LlyrRing< LlyrData >( queue_depth_ );
             input_queues_->push_back(tempQueue);
         }
 
@@ -161,7 +171,7 @@ public:
         tempQueue->forwarded_ = 0;
         tempQueue->argument_  = 0;
         tempQueue->routing_arg_ = new std::string("");
-        tempQueue->data_queue_ = new std::queue< LlyrData >;
+        tempQueue->data_queue_ = new LlyrRing< LlyrData >( queue_depth_ );
         output_queues_->push_back(tempQueue);
 
         return queueId;
@@ -182,7 +192,7 @@ public:
             tempQueue->forwarded_ = 0;
             tempQueue->argument_  = 0;
             tempQueue->routing_arg_ = new std::string("");
-            tempQueue->data_queue_ = new std::queue< LlyrData >;
+            tempQueue->data_queue_ = new LlyrRing< LlyrData >( queue_depth_ );
             output_queues_->push_back(tempQueue);
         }
 
@@ -206,7 +216,7 @@ public:
             tempQueue->forwarded_   = 0;
             tempQueue->routing_arg_ = new std::string("");
             tempQueue->argument_    = 0;
-            tempQueue->data_queue_  = new std::queue< LlyrData >;
+            tempQueue->data_queue_  = new LlyrRing< LlyrData >( queue_depth_ );
             input_queues_->push_back(tempQueue);
         }
 
@@ -352,27 +362,63 @@ public:
         }
     }
 
+    // Resolve each output queue to its destination input queue once the mapping is final
+    void compileLinks()
+    {
+        send_links_.clear();
+        for( auto it = output_queue_map_.begin(); it != output_queue_map_.end(); ++it ) {
+            SendLink link = { it->first, it->second, it->second->getInputQueueId(processor_id_) };
+            send_links_.push_back(link);
+        }
+    }
+
+    const std::vector< SendLink >& getSendLinks() const { return send_links_; }
+
+    // With no queued tokens and no pending op, doCompute and doSend have nothing to do
+    bool isQuiescent() const
+    {
+        if( pending_op_ == 1 ) {
+            return false;
+        }
+
+        for( auto it = input_queues_->begin(); it != input_queues_->end(); ++it ) {
+            if( (*it)->data_queue_->empty() == 0 ) {
+                return false;
+            }
+        }
+
+        for( auto it = output_queues_->begin(); it != output_queues_->end(); ++it ) {
+            if( (*it)->data_queue_->empty() == 0 ) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     virtual bool doSend()
     {
         uint32_t queueId;
+        uint32_t dstQueue;
         LlyrData sendVal;
         ProcessingElement* dstPe;
 
-        for(auto it = output_queue_map_.begin() ; it != output_queue_map_.end(); ++it ) {
-            queueId = it->first;
-            dstPe = it->second;
+        for( auto it = send_links_.begin(); it != send_links_.end(); ++it ) {
+            queueId = it->queue_id_;
+            dstPe = it->dst_pe_;
+            dstQueue = it->dst_queue_;
 
             if( output_queues_->at(queueId)->data_queue_->size() > 0 ) {
                 std::cout << " Input Queue Depth at PE-" << dstPe->getProcessorId();
-                std::cout << "(" << queueId << ") " << dstPe->getInputQueueSize(dstPe->getInputQueueId(processor_id_));
+                std::cout << "(" << queueId << ") " << dstPe->getInputQueueSize(dstQueue);
                 std::cout << ", max is " << queue_depth_ << std::endl;
-                if( dstPe->getInputQueueSize(dstPe->getInputQueueId(processor_id_)) < queue_depth_ ) {
+                if( dstPe->getInputQueueSize(dstQueue) < queue_depth_ ) {
                     output_->verbose(CALL_INFO, 8, 0, ">> Sending (%llu)...%" PRIu32 "-%" PRIu32 " to %" PRIu32 "\n",
                                 output_queues_->at(queueId)->data_queue_->front().to_ullong(), processor_id_, queueId,
                                 dstPe->getProcessorId());
 
                     sendVal = output_queues_->at(queueId)->data_queue_->front();
-                    dstPe->pushInputQueue(dstPe->getInputQueueId(processor_id_), sendVal);
+                    dstPe->pushInputQueue(dstQueue, sendVal);
                     output_queues_->at(queueId)->data_queue_->pop();
                 } else {
                     output_->verbose(CALL_INFO, 8, 0, ">> Sending failed...%" PRIu32 "-%" PRIu32 " to %" PRIu32 "\n",
@@ -417,6 +463,9 @@ protected:
     std::map< uint32_t, ProcessingElement* > input_queue_map_;
     std::map< uint32_t, ProcessingElement* > output_queue_map_;
 
+    // output_queue_map_ flattened by compileLinks() for the send path
+    std::vector< SendLink > send_links_;
+
     // track outstanding L/S requests (passed from top-level)
     LSQueue* lsqueue_;
 
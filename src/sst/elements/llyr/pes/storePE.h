@@ -135,7 +135,7 @@ public:
             tempQueue->forwarded_ = 0;
             tempQueue->argument_ = 0;
             tempQueue->routing_arg_ = new std::string("");
-            tempQueue->data_queue_ = new std::queue< LlyrData >;
+            tempQueue->data_queue_ = new LlyrRing< LlyrData >( queue_depth_ );
             input_queues_->push_back(tempQueue);
         }
 
@@ -311,3 +311,15 @@ extern "C" int mask_mpi_pack_size(int incount, MPI_Datatype datatype, MPI_Comm c
 {
   return SST::MASKMPI::mask_mpi()->packSize(incount, datatype, comm, size);
 }
+
+extern "C" int mask_mpi_pack(const void *inbuf, int incount, MPI_Datatype datatype, void *outbuf,
+             int outsize, int *position, MPI_Comm comm)
+{
+  return SST::MASKMPI::mask_mpi()->pack(inbuf, incount, datatype, outbuf, outsize, position, comm);
+}
+
+extern "C" int mask_mpi_unpack(const void *inbuf, int insize, int *position, void *outbuf, int outcount,
+               MPI_Datatype datatype, MPI_Comm comm)
+{
+  return SST::MASKMPI::mask_mpi()->unpack(inbuf, insize, position, outbuf, outcount, datatype, comm);
+}
@@ -132,7 +132,8 @@ MpiApi::MpiApi(SST::Params& params, SST::Hg::App* app,
   OTF2Writer_(nullptr),
 #endif
   req_counter_(0),
-  generate_ids_(true)
+  generate_ids_(true),
+  flatten_types_(true)
 {
   if (!engine_) engine_ = new Iris::sumi::CollectiveEngine(params, this);
 
@@ -144,6 +145,8 @@ MpiApi::MpiApi(SST::Params& params, SST::Hg::App* app,
   double test_delay_s = params.find<SST::UnitAlgebra>("test_delay", "1us").getValue().toDouble();
   test_delay_us_ = test_delay_s * 1e6;
 
+  flatten_types_ = params.find<bool>("flatten_types", true);
+
 #ifdef SST_HG_OTF2_ENABLED
 #if !SST_HG_INTEGRATED_SST_CORE
   auto subname = sprockit::sprintf("App%d-Rank%d", app->sid().app_, app->sid().task_);
@@ -524,6 +524,12 @@ class MpiApi : public SST::Iris::sumi::SimTransport
   int packSize(int incount, MPI_Datatype datatype,
          MPI_Comm comm, int *size);
 
+  int pack(const void *inbuf, int incount, MPI_Datatype datatype,
+         void *outbuf, int outsize, int *position, MPI_Comm comm);
+
+  int unpack(const void *inbuf, int insize, int *position,
+         void *outbuf, int outcount, MPI_Datatype datatype, MPI_Comm comm);
+
   int winFlush(int rank, MPI_Win win);
 
   int winFlushLocal(int rank, MPI_Win win);
@@ -874,6 +880,8 @@ class MpiApi : public SST::Iris::sumi::SimTransport
 
   bool generate_ids_;
 
+  bool flatten_types_;
+
   uint64_t traceClock() const;
 
 #ifdef SST_HG_OTF2_ENABLED
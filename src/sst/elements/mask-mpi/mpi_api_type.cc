@@ -46,6 +46,7 @@ Questions? Contact sst-macro-help@sandia.gov
 //#include <sumi-mpi/otf2_output_stat.h>
 #include <mercury/components/operating_system.h>
 #include <climits>
+#include <algorithm>
 
 namespace SST::Hg {
 extern void apiLock();
@@ -259,6 +260,44 @@ MpiApi::packSize(int incount, MPI_Datatype datatype, MPI_Comm  /*comm*/, int *si
   return MPI_SUCCESS;
 }
 
+int
+MpiApi::pack(const void *inbuf, int incount, MPI_Datatype datatype,
+             void *outbuf, int outsize, int *position, MPI_Comm  /*comm*/)
+{
+  auto it = known_types_.find(datatype);
+  if (it == known_types_.end()){
+      return MPI_ERR_TYPE;
+  }
+  MpiType* type_obj = it->second;
+  int bytes = incount * type_obj->packed_size();
+  if (*position + bytes > outsize){
+    return MPI_ERR_TRUNCATE;
+  }
+  type_obj->packSend(const_cast<void*>(inbuf), (char*) outbuf + *position, incount);
+  *position += bytes;
+
+  return MPI_SUCCESS;
+}
+
+int
+MpiApi::unpack(const void *inbuf, int insize, int *position,
+               void *outbuf, int outcount, MPI_Datatype datatype, MPI_Comm  /*comm*/)
+{
+  auto it = known_types_.find(datatype);
+  if (it == known_types_.end()){
+      return MPI_ERR_TYPE;
+  }
+  MpiType* type_obj = it->second;
+  int bytes = outcount * type_obj->packed_size();
+  if (*position + bytes > insize){
+    return MPI_ERR_TRUNCATE;
+  }
+  type_obj->unpack_recv((char*) const_cast<void*>(inbuf) + *position, outbuf, outcount);
+  *position += bytes;
+
+  return MPI_SUCCESS;
+}
+
 int
 MpiApi::typeSetName(MPI_Datatype id, const char* name)
 {
@@ -387,10 +426,10 @@ MpiApi::doTypeHindexed(int count, const int lens[],
     if (lens[i] > 0) {
       ind_block& next = idata->blocks[index];
       next.base = in_type_obj;
-      next.byte_disp = extent;
+      next.byte_disp = displs[i];
       next.num = lens[i];
       packed_size += lens[i] * in_type_obj->packed_size();
-      extent += displs[i];
+      extent = std::max(extent, int(displs[i] + lens[i] * in_type_obj->extent()));
       index++;
     }
   }
@@ -458,6 +497,7 @@ MpiApi::typeCommit(MPI_Datatype* type)
 {
   MpiType* type_obj = typeFromId(*type);
   type_obj->set_committed(true);
+  if (flatten_types_) type_obj->flatten();
   return MPI_SUCCESS;
 }
 
@@ -484,6 +524,7 @@ MpiApi::commitBuiltinType(MpiType* type, MPI_Datatype id)
   type->set_builtin(true);
   known_types_[id] = type;
   known_types_[id]->set_committed(true);
+  if (flatten_types_) type->flatten();
 
 #ifdef SST_HG_OTF2_ENABLED
   if(OTF2Writer_) {
@@ -502,9 +543,10 @@ MpiApi::typeContiguous(int count, MPI_Datatype old_type,
   MpiType* new_type_obj = new MpiType;
   MpiType* old_type_obj = typeFromId(old_type);
   MPI_Aint byte_stride = count * old_type_obj->extent();
+  //a single block of count elements
   new_type_obj->init_vector("contiguous-" + old_type_obj->label,
                         old_type_obj,
-                        count, 1, byte_stride);
+                        1, count, byte_stride);
 
   allocateTypeId(new_type_obj);
   *new_type = new_type_obj->id;
@@ -546,6 +588,7 @@ MpiApi::typeCreateStruct(const int count, const int* blocklens,
 
   int packed_size = 0;
   int extent = 0;
+  int align = 1;
   int index = 0;
 
   for (int i = 0; i < count; i++) {
@@ -565,10 +608,13 @@ MpiApi::typeCreateStruct(const int count, const int* blocklens,
       next.byte_disp = indices[i];
       next.num = blocklens[i];
       packed_size += old_type_obj->packed_size() * blocklens[i];
-      extent = next.byte_disp + old_type_obj->packed_size() * blocklens[i];
+      extent = std::max(extent, next.byte_disp + old_type_obj->extent() * blocklens[i]);
+      align = std::max(align, old_type_obj->alignment());
       index++;
     }
   }
+  //pad the extent the way the compiler pads the struct
+  extent = (extent + align - 1) / align * align;
 
   new_type_obj->init_indexed("struct", idata, packed_size, extent);
 
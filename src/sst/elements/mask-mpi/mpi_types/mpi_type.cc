@@ -50,6 +50,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <iostream>
 #include <sstream>
 #include <cstring>
+#include <algorithm>
 
 //sprockit::NeedDeletestatics<sumi::MpiType> delete_static_types;
 
@@ -60,6 +61,8 @@ MpiType::MpiType() :
   type_(NONE),
   contiguous_(true),
   committed_(false),
+  flattened_(false),
+  dense_(false),
   pdata_(nullptr),
   vdata_(nullptr),
   idata_(nullptr),
@@ -218,7 +221,44 @@ MpiType::init_indexed(const std::string &labelit,
   size_ = sz;
   extent_ = ext;
   idata_ = dat;
+  //contiguous only if the blocks are packed in address order with no gaps
   contiguous_ = extent_ == size_;
+  int next_disp = 0;
+  for (const ind_block& next_block : idata_->blocks){
+    if (next_block.byte_disp != next_disp || !next_block.base->contiguous()){
+      contiguous_ = false;
+      break;
+    }
+    next_disp += next_block.base->packed_size() * next_block.num;
+  }
+}
+
+int
+MpiType::alignment() const
+{
+  switch(type_)
+  {
+  case PRIM: {
+    //basic types are aligned to their size, up to 8 bytes
+    int align = 1;
+    while (align < 8 && size_ % (2*align) == 0) align *= 2;
+    return align;
+  }
+  case PAIR:
+    return std::max(pdata_->base1->alignment(), pdata_->base2->alignment());
+  case VEC:
+    return vdata_->base->alignment();
+  case IND: {
+    int align = 1;
+    for (const ind_block& next_block : idata_->blocks){
+      align = std::max(align, next_block.base->alignment());
+    }
+    return align;
+  }
+  case NONE:
+    break;
+  }
+  return 1;
 }
 
 MpiType::~MpiType()
@@ -305,7 +345,11 @@ void
 MpiType::pack(const void* inbuf, void *outbuf) const
 {
   //we are packing from inbuf into outbuf
-  pack_action(outbuf, const_cast<void*>(inbuf), true);
+  if (flattened_){
+    copy_runs<true>((char*) outbuf, (char*) const_cast<void*>(inbuf));
+  } else {
+    pack_action(outbuf, const_cast<void*>(inbuf), true);
+  }
 }
 
 void
@@ -313,7 +357,157 @@ MpiType::unpack(const void* inbuf, void *outbuf) const
 {
   //we are unpacking from inbuf into outbuf
   //false = unpack
-  pack_action(const_cast<void*>(inbuf), outbuf, false);
+  if (flattened_){
+    copy_runs<false>((char*) const_cast<void*>(inbuf), (char*) outbuf);
+  } else {
+    pack_action(const_cast<void*>(inbuf), outbuf, false);
+  }
+}
+
+void
+MpiType::append_run(std::vector<TypeRun>& runs, int64_t offset, int64_t length)
+{
+  if (length == 0) return;
+
+  if (!runs.empty()){
+    TypeRun& last = runs.back();
+    if (last.offset + last.length == offset){
+      //abuts the previous block, grow it
+      last.length += length;
+      return;
+    }
+  }
+  runs.push_back({offset, length, length, 1});
+}
+
+void
+MpiType::encode_repeats(std::vector<TypeRun>& runs)
+{
+  //blocks have already been merged, fold equal sized blocks
+  //a constant distance apart into a single run
+  size_t next = 0;
+  for (size_t i=0; i < runs.size(); ++i){
+    const TypeRun& block = runs[i];
+    if (next > 0){
+      TypeRun& last = runs[next-1];
+      if (last.length == block.length){
+        if (last.count == 1){
+          last.stride = block.offset - last.offset;
+          last.count = 2;
+          continue;
+        } else if (block.offset == last.offset + last.count * last.stride){
+          ++last.count;
+          continue;
+        }
+      }
+    }
+    runs[next++] = block;
+  }
+  runs.resize(next);
+}
+
+void
+MpiType::append_runs(std::vector<TypeRun>& runs, int64_t offset) const
+{
+  //this must visit bytes in exactly the order pack_action does
+  switch(type_)
+  {
+  case PRIM: {
+    append_run(runs, offset, size_);
+    break;
+  }
+  case PAIR: {
+    int first_size = pdata_->base1->size_;
+    append_run(runs, offset, first_size);
+    append_run(runs, offset + first_size, pdata_->base2->size_);
+    break;
+  }
+  case VEC: {
+    MpiType* base = vdata_->base;
+    for (int j=0; j < vdata_->count; ++j){
+      int64_t block_offset = offset + int64_t(vdata_->byte_stride) * j;
+      for (int b=0; b < vdata_->blocklen; ++b){
+        base->append_runs(runs, block_offset + int64_t(base->extent()) * b);
+      }
+    }
+    break;
+  }
+  case IND: {
+    for (const ind_block& next_block : idata_->blocks){
+      MpiType* base = next_block.base;
+      int64_t block_offset = offset + next_block.byte_disp;
+      if (base->contiguous()){
+        append_run(runs, block_offset, int64_t(base->packed_size()) * next_block.num);
+      } else {
+        for (int k=0; k < next_block.num; ++k){
+          base->append_runs(runs, block_offset + int64_t(base->extent()) * k);
+        }
+      }
+    }
+    break;
+  }
+  case NONE: {
+    SST::Hg::abort("mpi_type::append_runs: cannot flatten NONE type");
+  }
+  }
+}
+
+void
+MpiType::flatten()
+{
+  if (flattened_ || type_ == NONE) return;
+
+  runs_.clear();
+  append_runs(runs_, 0);
+  encode_repeats(runs_);
+  runs_.shrink_to_fit();
+
+  dense_ = size_ == int64_t(extent_)
+      && (runs_.empty() || (runs_.size() == 1 && runs_[0].count == 1 && runs_[0].offset == 0));
+  flattened_ = true;
+}
+
+template <bool pack, int64_t len>
+static inline void
+copyBlocks(char* packed_ptr, char* unpacked_ptr, int64_t stride, int count)
+{
+  //fixed size copies compile down to single loads and stores
+  for (int k=0; k < count; ++k, packed_ptr += len, unpacked_ptr += stride){
+    if (pack) ::memcpy(packed_ptr, unpacked_ptr, len);
+    else      ::memcpy(unpacked_ptr, packed_ptr, len);
+  }
+}
+
+template <bool pack>
+void
+MpiType::copy_runs(char* packed_ptr, char* unpacked_ptr) const
+{
+  for (const TypeRun& run : runs_){
+    char* unpacked_run = unpacked_ptr + run.offset;
+    if (run.count == 1){
+      if (pack) ::memcpy(packed_ptr, unpacked_run, run.length);
+      else      ::memcpy(unpacked_run, packed_ptr, run.length);
+    } else {
+      switch (run.length){
+      case 4:
+        copyBlocks<pack,4>(packed_ptr, unpacked_run, run.stride, run.count);
+        break;
+      case 8:
+        copyBlocks<pack,8>(packed_ptr, unpacked_run, run.stride, run.count);
+        break;
+      case 16:
+        copyBlocks<pack,16>(packed_ptr, unpacked_run, run.stride, run.count);
+        break;
+      default:
+        for (int k=0; k < run.count; ++k, unpacked_run += run.stride){
+          if (pack) ::memcpy(packed_ptr + k*run.length, unpacked_run, run.length);
+          else      ::memcpy(unpacked_run, packed_ptr + k*run.length, run.length);
+        }
+        break;
+      }
+    }
+    packed_ptr += run.length * run.count;
+  }
 }
 
 void
@@ -336,12 +530,15 @@ MpiType::pack_action_vector(void* packed_buf, void* unpacked_buf, bool pack) con
   char* packed_ptr = (char*) packed_buf;
   char* unpacked_ptr = (char*) unpacked_buf;
   int packed_stride = vdata_->base->packed_size();
+  int base_extent = vdata_->base->extent();
   for (int j=0; j < vdata_->count; ++j){
     char* this_unpacked_ptr = unpacked_ptr + vdata_->byte_stride * j;
-    vdata_->base->pack_action(packed_ptr, this_unpacked_ptr, pack);
-    packed_ptr += packed_stride;
+    for (int b=0; b < vdata_->blocklen; ++b){
+      vdata_->base->pack_action(packed_ptr, this_unpacked_ptr, pack);
+      packed_ptr += packed_stride;
+      this_unpacked_ptr += base_extent;
+    }
   }
-  unpacked_ptr += extent_;
 }
 
 void
@@ -352,17 +549,18 @@ MpiType::pack_action_indexed(void* packed_buf, void* unpacked_buf, bool pack) co
   for (int j=0; j < idata_->blocks.size(); ++j){
     const ind_block& next_block = idata_->blocks[j];
     int size = next_block.base->packed_size();
+    //blocks are placed by displacement, not one after another
+    char* block_ptr = unpacked_ptr + next_block.byte_disp;
     if (next_block.base->contiguous()){
       char *src, *dst;
-      if (pack){ src = unpacked_ptr; dst = packed_ptr; }
-      else     { src = packed_ptr;   dst = unpacked_ptr; }
+      if (pack){ src = block_ptr;  dst = packed_ptr; }
+      else     { src = packed_ptr; dst = block_ptr; }
       ::memcpy(dst, src, size*next_block.num);
     } else {
-      if (pack) next_block.base->packSend(unpacked_ptr, packed_ptr, next_block.num);
-      else      next_block.base->unpack_recv(packed_ptr, unpacked_ptr, next_block.num);
+      if (pack) next_block.base->packSend(block_ptr, packed_ptr, next_block.num);
+      else      next_block.base->unpack_recv(packed_ptr, block_ptr, next_block.num);
     }
     packed_ptr += size*next_block.num;
-    unpacked_ptr += next_block.base->extent()*next_block.num;
   }
 }
 
@@ -371,6 +569,10 @@ MpiType::packSend(void* srcbuf, void* dstbuf, int sendcnt)
 {
   char* src = (char*) srcbuf;
   char* dst = (char*) dstbuf;
+  if (dense_){
+    ::memcpy(dst, src, size_t(size_) * sendcnt);
+    return;
+  }
   int src_stride = extent_;
   int dst_stride = size_;
   for (int i=0; i < sendcnt; ++i, src += src_stride, dst += dst_stride){
@@ -383,6 +585,10 @@ MpiType::unpack_recv(void *srcbuf, void *dstbuf, int recvcnt)
 {
   char* src = (char*) srcbuf;
   char* dst = (char*) dstbuf;
+  if (dense_){
+    ::memcpy(dst, src, size_t(size_) * recvcnt);
+    return;
+  }
   int src_stride = size_;
   int dst_stride = extent_;
   for (int i=0; i < recvcnt; ++i, src += src_stride, dst += dst_stride){
@@ -45,6 +45,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <iris/sumi/comm_functions.h>
 #include <mpi_integers.h>
 #include <mpi_types.h>
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -61,6 +62,18 @@ struct pairdata;
 struct vecdata;
 struct inddata;
 
+/**
+ * A piece of a flattened datatype: count blocks of length bytes,
+ * the k-th block starting offset + k*stride bytes into one element
+ * of the unpacked buffer. Blocks are consecutive in the packed buffer.
+ */
+struct TypeRun {
+  int64_t offset;
+  int64_t length;
+  int64_t stride;
+  int count;
+};
+
 using SST::Iris::sumi::ReduceOp;
 using SST::Iris::sumi::Add;
 using SST::Iris::sumi::And;
@@ -152,10 +165,30 @@ class MpiType
     return committed_;
   }
 
+  /**
+   * Build the run list that packing and unpacking use instead of
+   * walking the type tree. Called when the type is committed.
+   */
+  void flatten();
+
+  bool flattened() const {
+    return flattened_;
+  }
+
+  const std::vector<TypeRun>& runs() const {
+    return runs_;
+  }
+
   bool contiguous() const {
     return contiguous_;
   }
 
+  /**
+   * Alignment in bytes of the most strictly aligned basic type in this type.
+   * A struct's extent is padded to a multiple of this, as a C struct would be.
+   */
+  int alignment() const;
+
   std::unordered_map<MPI_Op, SST::Iris::sumi::reduce_fxn> fxns_;
 
   template <typename data_t>
@@ -277,6 +310,15 @@ class MpiType
 
   void pack_action_indexed(void* packed_buf, void* unpacked_buf, bool pack) const;
 
+  void append_runs(std::vector<TypeRun>& runs, int64_t offset) const;
+
+  static void append_run(std::vector<TypeRun>& runs, int64_t offset, int64_t length);
+
+  static void encode_repeats(std::vector<TypeRun>& runs);
+
+  template <bool pack>
+  void copy_runs(char* packed_ptr, char* unpacked_ptr) const;
+
 
  private:
   TYPE_TYPE type_;
@@ -285,6 +327,13 @@ class MpiType
 
   bool committed_;
 
+  bool flattened_;
+
+  //true if an element is one block of size_ bytes and elements abut
+  bool dense_;
+
+  std::vector<TypeRun> runs_;
+
   pairdata* pdata_;
   vecdata* vdata_;
   inddata* idata_;
@@ -0,0 +1,132 @@
+/**
+Copyright 2009-2023 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2023, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#define ssthg_app_name collective_cache
+
+#include <stdio.h>
+#include <vector>
+#include <mask_mpi.h>
+#include <mercury/common/skeleton.h>
+
+// Broadcasts the same number of elements back to back with a contiguous
+// type and a strided vector type, with allreduces in between, while the
+// SUMI collective schedule cache is on. The vector type is packed before
+// the broadcast, so both layouts look up the same cached schedule and
+// both must still land in the right place. Reductions are only defined
+// for the predefined types, so the allreduce always uses MPI_INT.
+
+static const int nelems = 16;
+static const int niter = 3;
+
+static int
+checkBcast(MPI_Datatype type, int stride, int rank, int iter)
+{
+  std::vector<int> buf(nelems*stride, -1);
+  if (rank == 0){
+    for (int i=0; i < nelems; ++i) buf[i*stride] = 100*iter + i;
+  }
+  MPI_Bcast(buf.data(), 1, type, 0, MPI_COMM_WORLD);
+
+  int errors = 0;
+  for (int i=0; i < nelems*stride; ++i){
+    int expected = i % stride == 0 ? 100*iter + i/stride : -1;
+    if (buf[i] != expected){
+      printf("Rank %d: bcast with stride %d, buf[%d] = %d != %d\n",
+             rank, stride, i, buf[i], expected);
+      ++errors;
+    }
+  }
+  return errors;
+}
+
+static int
+checkAllreduce(int rank, int size)
+{
+  std::vector<int> send(nelems), recv(nelems, -1);
+  for (int i=0; i < nelems; ++i) send[i] = rank + i;
+  MPI_Allreduce(send.data(), recv.data(), nelems, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+
+  int errors = 0;
+  for (int i=0; i < nelems; ++i){
+    int expected = size*(size-1)/2 + size*i;
+    if (recv[i] != expected){
+      printf("Rank %d: allreduce recv[%d] = %d != %d\n", rank, i, recv[i], expected);
+      ++errors;
+    }
+  }
+  return errors;
+}
+
+int main(int argc, char** argv)
+{
+  MPI_Init(&argc, &argv);
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  MPI_Datatype block, column;
+  MPI_Type_contiguous(nelems, MPI_INT, &block);
+  MPI_Type_commit(&block);
+  MPI_Type_vector(nelems, 1, 2, MPI_INT, &column);
+  MPI_Type_commit(&column);
+
+  int errors = 0;
+  for (int iter=0; iter < niter; ++iter){
+    errors += checkBcast(block, 1, rank, iter);
+    errors += checkBcast(column, 2, rank, iter);
+    errors += checkAllreduce(rank, size);
+  }
+
+  MPI_Type_free(&block);
+  MPI_Type_free(&column);
+
+  int total = 0;
+  MPI_Reduce(&errors, &total, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+  if (rank == 0){
+    printf("collective_cache: %s\n", total ? "FAILED" : "PASSED");
+  }
+
+  MPI_Finalize();
+  return 0;
+}
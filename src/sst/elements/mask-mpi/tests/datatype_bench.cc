@@ -0,0 +1,183 @@
+/**
+Copyright 2009-2023 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2023, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+
+#define ssthg_app_name datatype_bench
+
+#include <stddef.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <mask_mpi.h>
+#include <mercury/common/skeleton.h>
+
+// Wall clock cost of MPI_Pack/MPI_Unpack for derived datatypes.
+// Simulated time does not advance while packing, so this times the
+// simulator itself. Run with MpiApi.flatten_types set to 0 and 1 to
+// compare the type tree walk with the flattened copy runs.
+
+static const int niter = 200;
+
+struct particle {
+  double pos[3];
+  int id;
+  double vel[3];
+  char flag;
+};
+
+//covered[i] is set if byte i of buf is part of the type, so it has to come
+//back from an unpack unchanged while every other byte stays zero
+static int
+bench(const char* name, MPI_Datatype type, int count, char* buf, size_t bufsize,
+      const std::vector<char>& covered)
+{
+  int packed_size;
+  MPI_Pack_size(count, type, MPI_COMM_WORLD, &packed_size);
+  std::vector<char> packed(packed_size);
+  std::vector<char> unpacked(bufsize, 0);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i=0; i < niter; ++i){
+    int position = 0;
+    MPI_Pack(buf, count, type, packed.data(), packed_size, &position, MPI_COMM_WORLD);
+  }
+  auto mid = std::chrono::steady_clock::now();
+  for (int i=0; i < niter; ++i){
+    int position = 0;
+    MPI_Unpack(packed.data(), packed_size, &position, unpacked.data(), count, type, MPI_COMM_WORLD);
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  //every packed byte has to come back to where it came from
+  int errors = 0;
+  for (size_t i=0; i < bufsize; ++i){
+    char expected = covered[i] ? buf[i] : 0;
+    if (unpacked[i] != expected) ++errors;
+  }
+
+  double pack_s = std::chrono::duration<double>(mid - start).count();
+  double unpack_s = std::chrono::duration<double>(stop - mid).count();
+  double mb = double(packed_size) * niter / 1e6;
+  printf("%-8s %10d bytes  pack %9.1f MB/s  unpack %9.1f MB/s%s\n",
+         name, packed_size, mb / pack_s, mb / unpack_s,
+         errors ? "  MISMATCH" : "");
+  return errors;
+}
+
+int main(int argc, char** argv)
+{
+  MPI_Init(&argc, &argv);
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  int errors = 0;
+  if (rank == 0){
+    //a column of a 512x512 grid, as in a halo exchange
+    const int n = 512;
+    std::vector<double> grid(n*n);
+    for (int i=0; i < n*n; ++i) grid[i] = i + 1;
+    std::vector<char> grid_covered(grid.size()*sizeof(double), 0);
+    for (int row=0; row < n; ++row){
+      std::fill_n(grid_covered.begin() + row*n*sizeof(double), 2*sizeof(double), 1);
+    }
+    MPI_Datatype column;
+    MPI_Type_vector(n, 2, n, MPI_DOUBLE, &column);
+    MPI_Type_commit(&column);
+    errors += bench("vector", column, 1, (char*) grid.data(), grid.size()*sizeof(double),
+                    grid_covered);
+    MPI_Type_free(&column);
+
+    //irregular blocks of a 1D array
+    const int nblocks = 1024;
+    std::vector<int> lens(nblocks), displs(nblocks);
+    int next = 0;
+    for (int i=0; i < nblocks; ++i){
+      lens[i] = 1 + i % 7;
+      displs[i] = next;
+      next += lens[i] + 3;
+    }
+    std::vector<double> array(next);
+    for (int i=0; i < next; ++i) array[i] = i + 1;
+    std::vector<char> array_covered(array.size()*sizeof(double), 0);
+    for (int i=0; i < nblocks; ++i){
+      std::fill_n(array_covered.begin() + displs[i]*sizeof(double), lens[i]*sizeof(double), 1);
+    }
+    MPI_Datatype blocks;
+    MPI_Type_indexed(nblocks, lens.data(), displs.data(), MPI_DOUBLE, &blocks);
+    MPI_Type_commit(&blocks);
+    errors += bench("indexed", blocks, 1, (char*) array.data(), array.size()*sizeof(double),
+                    array_covered);
+    MPI_Type_free(&blocks);
+
+    //an array of structs
+    const int nparticles = 4096;
+    std::vector<particle> particles(nparticles);
+    for (int i=0; i < nparticles; ++i){
+      particles[i].id = i + 1;
+      particles[i].flag = 1 + i % 2;
+      for (int j=0; j < 3; ++j){
+        particles[i].pos[j] = i + j + 1;
+        particles[i].vel[j] = i - j - 1;
+      }
+    }
+    int struct_lens[] = {3, 1, 3, 1};
+    MPI_Aint struct_displs[] = {offsetof(particle, pos), offsetof(particle, id),
+                                offsetof(particle, vel), offsetof(particle, flag)};
+    int struct_sizes[] = {sizeof(double), sizeof(int), sizeof(double), sizeof(char)};
+    MPI_Datatype struct_types[] = {MPI_DOUBLE, MPI_INT, MPI_DOUBLE, MPI_CHAR};
+    //the padding between and after the fields is not part of the type
+    std::vector<char> particles_covered(particles.size()*sizeof(particle), 0);
+    for (int i=0; i < nparticles; ++i){
+      for (int f=0; f < 4; ++f){
+        std::fill_n(particles_covered.begin() + i*sizeof(particle) + struct_displs[f],
+                    struct_lens[f]*struct_sizes[f], 1);
+      }
+    }
+    MPI_Datatype ptype;
+    MPI_Type_create_struct(4, struct_lens, struct_displs, struct_types, &ptype);
+    MPI_Type_commit(&ptype);
+    errors += bench("struct", ptype, nparticles, (char*) particles.data(),
+                    particles.size()*sizeof(particle), particles_covered);
+    MPI_Type_free(&ptype);
+
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Finalize();
+  return 0;
+}
@@ -21,6 +21,14 @@ class testcase_mask_mpi(SSTTestCase):
 #####
 
     def test_testme(self):
+        self.set_lib_path()
+        self.mask_mpi_template("test_sendrecv")
+
+    def test_collective_cache(self):
+        self.set_lib_path()
+        self.mask_mpi_check_template("test_collective_cache", "collective_cache: PASSED")
+
+    def set_lib_path(self):
         lib_dir = subprocess.run(["sst-config", "SST_ELEMENT_LIBRARY", "SST_ELEMENT_LIBRARY_LIBDIR"],
             stdout=subprocess.PIPE, stderr=subprocess.PIPE)
         lib_dir = lib_dir.stdout.rstrip().decode()
@@ -36,8 +44,6 @@ class testcase_mask_mpi(SSTTestCase):
         else:
             os.environ["SST_LIB_PATH"] = paths + ":" + sst_lib_path
 
-        self.mask_mpi_template("test_sendrecv")
-
 #####
 
     def mask_mpi_template(self, testcase, striptotail=0):
@@ -83,3 +89,25 @@ class testcase_mask_mpi(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(cmpfile, reffile))
+
+    # Runs an app that checks its own results and prints a pass line,
+    # so no reference file (and its simulated time) is needed
+    def mask_mpi_check_template(self, testcase, passline):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="{0}".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("hg test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        with open(outfile, 'r') as fp:
+            lines = fp.read().splitlines()
+        self.assertTrue(passline in lines, "{0} not found in output file {1}".format(passline, outfile))
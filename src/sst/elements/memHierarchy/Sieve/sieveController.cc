@@ -21,49 +21,60 @@
 #include <sst_config.h>
 #include <sst/core/interfaces/stringEvent.h>
 
+#include <algorithm>
+#include <cstdio>
+
 #include "sieveController.h"
 #include "../memEvent.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
 
-void Sieve::recordMiss(Addr addr, bool isRead) {
-    allocMap_t::iterator allocI = activeAllocMap.lower_bound(addr);
-
-    // lower_bound returns iterator to address just above or equal to addr
-    if (allocI->first != addr) {
-        if (allocI == activeAllocMap.begin()) {
-            allocI = activeAllocMap.end(); // Not found
-        } else {
-            allocI--; // Actually want the address just below the one we got
-        }
-    }
-    if (allocI != activeAllocMap.end()) {
-        // is it in range
-        if (addr < (allocI->first +  allocI->second.size)) {
-            uint64_t allocID = allocI->second.id;
-            allocCountMap_t::iterator evI = allocMap.find(allocID);
-            if (evI == allocMap.end()) {
-                allocMap[allocID] = rwCount_t();
-                evI = allocMap.find(allocID);
-            }
-            if (isRead) {
-                evI->second.first++;
-                statReadMisses->addData(1);
-            } else {
-                evI->second.second++;
-                statWriteMisses->addData(1);
-            }
-            return;
-        }
+/* Returns the index in activeAllocs of the allocation containing addr, or -1 */
+int64_t Sieve::findAlloc(Addr addr) {
+    // Misses tend to cluster in one allocation, so check the last one we found first
+    if (lastAlloc != -1) {
+        const mallocEntry &last = activeAllocs[lastAlloc];
+        bool nextStartsAbove = (lastAlloc + 1 == (int64_t)activeAllocs.size()) || (activeAllocs[lastAlloc + 1].start > addr);
+        if (addr >= last.start && addr < last.end && nextStartsAbove)
+            return lastAlloc;
     }
 
-    if (isRead) {
-        statUnassocReadMisses->addData(1);
+    // Find the allocation with the highest start address at or below addr
+    vector<mallocEntry>::iterator it = std::upper_bound(activeAllocs.begin(), activeAllocs.end(), addr,
+            [](Addr a, const mallocEntry &entry) { return a < entry.start; });
+    if (it == activeAllocs.begin())
+        return -1;
+    it--;
+    if (addr >= it->end)
+        return -1;
+
+    lastAlloc = it - activeAllocs.begin();
+    return lastAlloc;
+}
+
+void Sieve::recordMiss(Addr addr, bool isRead) {
+    if (isRead)
         statReadMisses->addData(1);
-    } else {
-        statUnassocWriteMisses->addData(1);
+    else
         statWriteMisses->addData(1);
+
+    // In sampled mode, only attribute every sampleInterval-th miss and scale it
+    if (--sampleCountdown != 0)
+        return;
+    sampleCountdown = sampleInterval;
+
+    int64_t alloc = findAlloc(addr);
+    if (alloc != -1) {
+        uint32_t site = activeAllocs[alloc].site;
+        if (isRead)
+            siteReads[site] += sampleInterval;
+        else
+            siteWrites[site] += sampleInterval;
+    } else if (isRead) {
+        statUnassocReadMisses->addData(sampleInterval);
+    } else {
+        statUnassocWriteMisses->addData(sampleInterval);
     }
 }
 
@@ -72,31 +83,42 @@ void Sieve::processAllocEvent(SST::Event* event) {
     AllocTrackEvent* ev = static_cast<AllocTrackEvent*>(event);
 
     if (ev->getType() == AllocTrackEvent::ALLOC) {
-        // add to the list of active allocations (i.e. not FREEd)
-        mallocEntry entry = {ev->getInstructionPointer(), ev->getAllocateLength()};
-        activeAllocMap[ev->getVirtualAddress()] = entry;
+        // Look up the allocation site, giving it counters if it is new
+        std::unordered_map<uint64_t, uint32_t>::iterator siteIt = siteIndex.find(ev->getInstructionPointer());
+        if (siteIt == siteIndex.end()) {
+            siteIt = siteIndex.insert(std::make_pair(ev->getInstructionPointer(), (uint32_t)siteIDs.size())).first;
+            siteIDs.push_back(ev->getInstructionPointer());
+            siteReads.push_back(0);
+            siteWrites.push_back(0);
+        }
 
+        // add to the list of active allocations (i.e. not FREEd)
+        mallocEntry entry = {ev->getVirtualAddress(), ev->getVirtualAddress() + ev->getAllocateLength(), siteIt->second};
+        vector<mallocEntry>::iterator it = std::lower_bound(activeAllocs.begin(), activeAllocs.end(), entry.start,
+                [](const mallocEntry &e, Addr a) { return e.start < a; });
+        int64_t index = it - activeAllocs.begin();
+        if (it != activeAllocs.end() && it->start == entry.start) {
 #ifdef __SST_DEBUG_OUTPUT__
-        if (activeAllocMap.find(ev->getVirtualAddress()) != activeAllocMap.end()) {
             // sometimes ariel replaces both malloc() and _malloc(), so we get two reports. Just ignore the first.
-            output_->debug(_INFO_, "Trying to add allocation event at an address (%p %" PRIx64") with an active allocation. %" PRIu64 "\n", ev, ev->getVirtualAddress(), (uint64_t)activeAllocMap.size());
-        }
+            output_->debug(_INFO_, "Trying to add allocation event at an address (%p %" PRIx64") with an active allocation. %" PRIu64 "\n", ev, ev->getVirtualAddress(), (uint64_t)activeAllocs.size());
 #endif
+            *it = entry;
+        } else {
+            activeAllocs.insert(it, entry);
+            if (lastAlloc >= index)
+                lastAlloc++;
+        }
         delete ev;
     } else if (ev->getType() == AllocTrackEvent::FREE) {
-        allocMap_t::iterator targ = activeAllocMap.find(ev->getVirtualAddress());
-        if (targ != activeAllocMap.end()) {
-            uint64_t allocID = targ->second.id;
-            allocCountMap_t::iterator mapIt = allocMap.find(allocID);
-
-            // In this case ALWAYS delete the entry from active alloc & delete the event
-            activeAllocMap.erase(targ);
-
-            // If the entry in the count map is 0, remove it as well
-            if (mapIt != allocMap.end() && (mapIt->second.first == 0 && mapIt->second.second == 0)) {
-                allocMap.erase(mapIt);
-            }
-
+        vector<mallocEntry>::iterator it = std::lower_bound(activeAllocs.begin(), activeAllocs.end(), ev->getVirtualAddress(),
+                [](const mallocEntry &e, Addr a) { return e.start < a; });
+        if (it != activeAllocs.end() && it->start == ev->getVirtualAddress()) {
+            int64_t index = it - activeAllocs.begin();
+            activeAllocs.erase(it);
+            if (lastAlloc == index)
+                lastAlloc = -1;
+            else if (lastAlloc > index)
+                lastAlloc--;
 #ifdef __SST_DEBUG_OUTPUT__
         } else {
             output_->debug(_INFO_,"FREEing an address that was never ALLOCd\n");
@@ -169,7 +191,7 @@ void Sieve::processEvent(SST::Event* ev, int link) {
     // Currently, Ariel does not care about the payload.  Therefore,
     // there is no need to construct the payload.
 
-    responseEvent->setDst(event->getSrc());
+    responseEvent->setDstID(event->getSrcID());
     SST::Link * ret = cpuLinks_[link];
     ret->send(responseEvent);
 
@@ -202,41 +224,73 @@ void Sieve::outputStats(int marker) {
     if (-1 != marker)  {
         fileName << "-" << marker;
     }
-    fileName << ".txt";
 
-    // create new file
-    Output* output_file = new Output("",0,0,SST::Output::FILE, fileName.str());
+    if (binaryOutput) {
+        outputBinaryProfile(fileName.str() + ".bin");
 
-    // have the listener (if any) output stats
-    if (listener_) {
-        listener_->printStats(*output_file);
-    }
+        // have the listener (if any) output stats
+        if (listener_) {
+            Output* output_file = new Output("",0,0,SST::Output::FILE, fileName.str() + ".txt");
+            listener_->printStats(*output_file);
+            delete output_file;
+        }
+    } else {
+        fileName << ".txt";
 
-    // print out all the allocations and how often they were touched
-    output_file->output(CALL_INFO, "#Printing allocation memory accesses (mallocID, reads, writes):\n");
-    vector<uint64_t> entriesToErase;
-    for (allocCountMap_t::iterator i = allocMap.begin(); i != allocMap.end(); i++) {
-	rwCount_t &counts = i->second;
+        // create new file
+        Output* output_file = new Output("",0,0,SST::Output::FILE, fileName.str());
 
-        if (counts.first == 0 && counts.second == 0) {
-            entriesToErase.push_back(i->first);
-            continue;
+        // have the listener (if any) output stats
+        if (listener_) {
+            listener_->printStats(*output_file);
         }
-        output_file->output(CALL_INFO, "%" PRIu64 " %" PRId64 " %" PRId64 "\n",
-                            i->first, counts.first, counts.second);
-
-        // clear the counts
-        if (resetStatsOnOutput) {
-            counts.first = 0;
-            counts.second = 0;
-            entriesToErase.push_back(i->first);
+
+        // print out all the allocations and how often they were touched
+        output_file->output(CALL_INFO, "#Printing allocation memory accesses (mallocID, reads, writes):\n");
+        for (size_t i = 0; i < siteIDs.size(); i++) {
+            if (siteReads[i] == 0 && siteWrites[i] == 0)
+                continue;
+            output_file->output(CALL_INFO, "%" PRIu64 " %" PRId64 " %" PRId64 "\n",
+                                siteIDs[i], siteReads[i], siteWrites[i]);
         }
+        // clean up
+        delete output_file;
     }
-    for (vector<uint64_t>::iterator it = entriesToErase.begin(); it != entriesToErase.end(); it++) {
-        allocMap.erase(*it); // remove entry from allocMap
+
+    // clear the counts
+    if (resetStatsOnOutput) {
+        std::fill(siteReads.begin(), siteReads.end(), 0);
+        std::fill(siteWrites.begin(), siteWrites.end(), 0);
+    }
+}
+
+void Sieve::outputBinaryProfile(const std::string &fileName) {
+    FILE* file = fopen(fileName.c_str(), "wb");
+    if (file == nullptr) {
+        output_->fatal(CALL_INFO, -1, "%s, Error: unable to open profile file '%s'\n", getName().c_str(), fileName.c_str());
+    }
+
+    uint64_t records = 0;
+    for (size_t i = 0; i < siteIDs.size(); i++) {
+        if (siteReads[i] != 0 || siteWrites[i] != 0)
+            records++;
+    }
+
+    const uint32_t version = 1;
+    const uint32_t recordSize = 3 * sizeof(uint64_t);
+    fwrite("SIEVEPRF", 1, 8, file);
+    fwrite(&version, sizeof(version), 1, file);
+    fwrite(&recordSize, sizeof(recordSize), 1, file);
+    fwrite(&sampleInterval, sizeof(sampleInterval), 1, file);
+    fwrite(&records, sizeof(records), 1, file);
+
+    for (size_t i = 0; i < siteIDs.size(); i++) {
+        if (siteReads[i] == 0 && siteWrites[i] == 0)
+            continue;
+        uint64_t record[3] = { siteIDs[i], siteReads[i], siteWrites[i] };
+        fwrite(record, sizeof(uint64_t), 3, file);
     }
-    // clean up
-    delete output_file;
+    fclose(file);
 }
 
 void Sieve::finish(){
@@ -27,6 +27,7 @@
 #include <sst/core/output.h>
 
 #include <unordered_map>
+#include <vector>
 
 #include "sst/elements/memHierarchy/lineTypes.h"
 #include "sst/elements/memHierarchy/cacheArray.h"
@@ -54,7 +55,9 @@ public:
             {"profiler",                "(string) Name of profiling subcomponent. Currently only configured to work with cassini.AddrHistogrammer. Add params using 'profiler.paramName'", ""},
             {"debug",                   "(uint) Print debug information. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",             "(uint) Debugging/verbosity level. Between 0 and 10", "0"},
-            {"output_file",             "(string) Name of file to output malloc information to. Will have sequence number (and optional marker number) and .txt appended to it. E.g. sieveMallocRank-3.txt", "sieveMallocRank"},
+            {"output_file",             "(string) Name of file to output malloc information to. Will have sequence number (and optional marker number) and .txt or .bin appended to it. E.g. sieveMallocRank-3.txt", "sieveMallocRank"},
+            {"output_format",           "(string) Format of the malloc information files. Options: 'text' (one 'mallocID reads writes' line per allocation site), 'binary' (see sieveController.h for the layout)", "text"},
+            {"sample_interval",         "(uint) Attribute only one in this many misses to an allocation site and scale the counts by this much. 1 attributes every miss.", "1"},
             {"reset_stats_at_buoy",     "(bool) Whether to reset allocation hit/miss stats when a buoy is found (i.e., when a new output file is dumped). Any value other than 0 is true." "0"} )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -66,8 +69,8 @@ public:
             {"ReadMisses",  "Number of read requests that missed in the sieve", "count", 1},
             {"WriteHits",   "Number of write requests that hit in the sieve", "count", 1},
             {"WriteMisses", "Number of write requests that missed in the sieve", "count", 1},
-            {"UnassociatedReadMisses", "Number of read misses that did not match a malloc", "count", 1},
-            {"UnassociatedWriteMisses", "Number of write misses that did not match a malloc", "count", 1} )
+            {"UnassociatedReadMisses", "Number of read misses that did not match a malloc. Scaled if sample_interval > 1.", "count", 1},
+            {"UnassociatedWriteMisses", "Number of write misses that did not match a malloc. Scaled if sample_interval > 1.", "count", 1} )
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( {"profiler", "(string) Name of profiling subcomponent. Currently only configured to work with cassini.AddrHistogrammer.", "SST::MemHierarchy::CacheListener"} )
 
@@ -89,29 +92,37 @@ public:
     }
 
 private:
+    /** An active (not FREEd) allocation */
     struct mallocEntry {
-        uint64_t id;    // ID assigned by ariel
-        uint64_t size;  // Number of bytes
+        Addr start;     // First address
+        Addr end;       // One past the last address
+        uint32_t site;  // Index into the per-site counters
     };
 
-
-    typedef map<Addr, mallocEntry> allocMap_t;
-    typedef pair<uint64_t, uint64_t> rwCount_t;
-    typedef std::unordered_map<uint64_t, rwCount_t > allocCountMap_t;
-
-
     /** Name of the output file */
     string outFileName;
     /** output file counter */
     uint64_t outCount;
-    /** All Allocations */
-    allocCountMap_t allocMap;
-     /** All allocations in list form */
-    /** Active Allocations */
-    allocMap_t activeAllocMap;
-    /** misses not associated with an alloc'd region */
+    /** Whether to write the binary profile instead of text */
+    bool binaryOutput;
+
+    /** Active allocations, sorted by start address */
+    vector<mallocEntry> activeAllocs;
+    /** Index in activeAllocs of the allocation the last miss fell in, or -1 */
+    int64_t lastAlloc;
+
+    /** Per allocation site: ID assigned by ariel (malloc call site) and read/write miss counts */
+    std::unordered_map<uint64_t, uint32_t> siteIndex;
+    vector<uint64_t> siteIDs;
+    vector<uint64_t> siteReads;
+    vector<uint64_t> siteWrites;
+
+    /** Sampling: attribute one in sampleInterval misses, sampleCountdown misses from now */
+    uint64_t sampleInterval;
+    uint64_t sampleCountdown;
 
     void recordMiss(Addr addr, bool isRead);
+    int64_t findAlloc(Addr addr);
 
     /** Destructor for Sieve Component */
     ~Sieve();
@@ -129,6 +140,7 @@ private:
 
     /** output and clear stats to file  */
     void outputStats(int marker);
+    void outputBinaryProfile(const std::string &fileName);
     bool resetStatsOnOutput;
 
     CacheArray<SharedCacheLine>* cacheArray_;
@@ -172,6 +184,19 @@ private:
 
         - Class member variables have a suffix "_".
 
+        - Misses are attributed to the allocation with the highest start address at or below the
+        miss address, if the miss falls inside it. Allocations are kept in a sorted vector and
+        found by binary search, with the last allocation hit checked first.
+
+        - Binary profile layout (output_format = binary), in host byte order:
+            char[8]     "SIEVEPRF"
+            uint32_t    version (1)
+            uint32_t    record size in bytes (24)
+            uint64_t    sample_interval
+            uint64_t    number of records
+            records:    { uint64_t mallocID; uint64_t reads; uint64_t writes; }
+        Only allocation sites with a non-zero count are written.
+
 */
 
 }}
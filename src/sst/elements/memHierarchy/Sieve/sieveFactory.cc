@@ -73,8 +73,19 @@ Sieve::Sieve(ComponentId_t id, Params &params) : Component(id) {
     }
     outCount = 0;
 
+    string outFormat = params.find<std::string>("output_format", "text");
+    to_lower(outFormat);
+    if (outFormat == "text")        binaryOutput = false;
+    else if (outFormat == "binary") binaryOutput = true;
+    else output_->fatal(CALL_INFO, -1, "Invalid param: output_format - must be 'text' or 'binary'. You specified '%s'\n", outFormat.c_str());
+
     resetStatsOnOutput = params.find<bool>("reset_stats_at_buoy", 0) != 0;
 
+    sampleInterval = params.find<uint64_t>("sample_interval", 1);
+    if (sampleInterval == 0)        output_->fatal(CALL_INFO, -1, "Invalid param: sample_interval - must be at least 1\n");
+    sampleCountdown = sampleInterval;
+    lastAlloc = -1;
+
     // optional link for allocation / free tracking
     configureLinks();
 
@@ -0,0 +1,112 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_ADDRSET_H
+#define MEMHIERARCHY_ADDRSET_H
+
+#include <vector>
+
+#include "sst/elements/memHierarchy/util.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Small open-addressed set of addresses for per-cycle bookkeeping
+ * (e.g., lines a cache has accessed this cycle).
+ *
+ * Each slot is tagged with the generation it was written in, so clear()
+ * only bumps the generation. The table is sized up front for the expected
+ * number of insertions between clears and only grows if a caller exceeds
+ * half of its capacity.
+ */
+class AddrSet {
+public:
+    explicit AddrSet(size_t capacity = 16) : size_(0), generation_(1) {
+        size_t slots = 8;
+        while (slots < 2 * capacity)
+            slots <<= 1;
+        slots_.assign(slots, Slot());
+        mask_ = slots - 1;
+    }
+
+    void clear() {
+        size_ = 0;
+        if (++generation_ == 0) { // Wrapped, forget all old tags
+            for (size_t i = 0; i < slots_.size(); i++)
+                slots_[i].gen = 0;
+            generation_ = 1;
+        }
+    }
+
+    bool contains(Addr addr) const {
+        for (size_t i = hash(addr) & mask_; slots_[i].gen == generation_; i = (i + 1) & mask_) {
+            if (slots_[i].addr == addr)
+                return true;
+        }
+        return false;
+    }
+
+    void insert(Addr addr) {
+        size_t i = hash(addr) & mask_;
+        for (; slots_[i].gen == generation_; i = (i + 1) & mask_) {
+            if (slots_[i].addr == addr)
+                return;
+        }
+        slots_[i].addr = addr;
+        slots_[i].gen = generation_;
+        if (++size_ * 2 > slots_.size())
+            grow();
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    struct Slot {
+        Slot() : addr(0), gen(0) { }
+        Addr addr;
+        uint32_t gen;
+    };
+
+    static size_t hash(Addr addr) {
+        addr ^= addr >> 33;
+        addr *= 0xff51afd7ed558ccdULL;
+        addr ^= addr >> 33;
+        return (size_t)addr;
+    }
+
+    void grow() {
+        std::vector<Slot> old;
+        old.swap(slots_);
+        slots_.assign(old.size() * 2, Slot());
+        mask_ = slots_.size() - 1;
+        size_ = 0;
+        uint32_t gen = generation_;
+        generation_ = 1;
+        for (size_t i = 0; i < old.size(); i++) {
+            if (old[i].gen == gen)
+                insert(old[i].addr);
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t mask_;
+    size_t size_;
+    uint32_t generation_;
+};
+
+}}
+
+#endif
@@ -56,7 +56,21 @@ void Cache::handleEvent(SST::Event * ev) {
         fflush(stdout);
     }
     
-    eventBuffer_.push_back(event);
+    queueEvent(event, false);
+}
+
+/* Queue an event on its bank's FIFO. Events that bypass the cache array go on the last FIFO */
+void Cache::queueEvent(MemEventBase* ev, bool retry) {
+    std::vector<std::deque<QueuedEvent> > &queues = retry ? retryQueues_ : eventQueues_;
+    size_t queue = queues.size() - 1;
+    if (!allNoncacheableRequests_ && MemEventTypeArr[(int)ev->getCmd()] == MemEventType::Cache && !ev->queryFlag(MemEventBase::F_NONCACHEABLE))
+        queue = banked_ ? coherenceMgr_->getBank(static_cast<MemEvent*>(ev)->getBaseAddr()) : 0;
+
+    queues[queue].push_back({arrivalSeq_++, ev});
+    if (retry)
+        retryCount_++;
+    else
+        eventCount_++;
 }
 
 /* 
@@ -73,8 +87,8 @@ void Cache::handlePrefetchEvent(SST::Event * ev) {
 void Cache::processPrefetchEvent(SST::Event * ev) {
     MemEvent * event = static_cast<MemEvent*>(ev);
     event->setBaseAddr(toBaseAddr(event->getAddr()));
-    event->setRqstr(getName());
-    event->setSrc(getName());
+    event->setRqstrID(endpointID_);
+    event->setSrcID(endpointID_);
 
     if (!clockIsOn_) {
         turnClockOn();
@@ -97,6 +111,8 @@ void Cache::processPrefetchEvent(SST::Event * ev) {
 bool Cache::clockTick(Cycle_t time) {
     timestamp_++;
 
+    PayloadCounters payloadStart = Payload::getCounters();
+
     // Drain any outgoing messages
     bool idle = coherenceMgr_->sendOutgoingEvents();
 
@@ -116,54 +132,25 @@ bool Cache::clockTick(Cycle_t time) {
 
     addrsThisCycle_.clear();
 
-    // Handle events from each of the buffers
-    // 1. Retry buffer      -> Events that need to be retried, e.g., were stalled due to a pending action that is now resolved
-    // 2. Event buffer      -> Incoming (new) events
+    // Handle events from each of the queues
+    // 1. Retry queues      -> Events that need to be retried, e.g., were stalled due to a pending action that is now resolved
+    // 2. Event queues      -> Incoming (new) events
     // 3. Prefetch buffer   -> Drop any prefetch that can't be handled immediately
+    // Retry and event queues are each handled in arrival order across all of their FIFOs
 
     int accepted = 0;
-    size_t entries = retryBuffer_.size();
 
-    std::list<MemEventBase*>::iterator it = retryBuffer_.begin();
-    while (it != retryBuffer_.end()) {
-        if (accepted == maxRequestsPerCycle_)
-            break;
-        if (is_debug_event((*it))) {
-            dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Retry   (%s)\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), (*it)->getVerboseString().c_str());
-            fflush(stdout);
-        }
-        if (processEvent(*it, true)) {
-            accepted++;
-            statRetryEvents->addData(1);
-            it = retryBuffer_.erase(it);
-        } else {
-            it++;
-        }
-    }
+    processQueues(retryQueues_, true, accepted);
 
-    // Event buffer has both requests and responses
+    // Event queues have both requests and responses
     // Deadlock will not occur because an event cannot indefinitely block another one
     // 1. An event can be accepted, in which case a later response moves up the queue
-    // 2. An event can be rejected, in which case we check the next one with no penalty (doesn't block a later response)
-    it = eventBuffer_.begin();
-    while (it != eventBuffer_.end()) {
-        if (accepted == maxRequestsPerCycle_)
-            break;
-        Command cmd = (*it)->getCmd();
-        if (is_debug_event((*it))) {
-            dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:New     (%s)\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), (*it)->getVerboseString().c_str());
-            fflush(stdout);
-        }
-        if (processEvent(*it, false)) {
-            accepted++;
-            statRecvEvents->addData(1);
-            it = eventBuffer_.erase(it);
-        } else {
-            it++;
-        }
-    }
+    // 2. An event can be rejected because its bank was accessed this cycle, in which case
+    //    it keeps its place and the bank's later events wait for the next cycle
+    // 3. An event can be rejected for any other reason (e.g., line accessed this cycle, MSHR full),
+    //    in which case it keeps its place and we check the next one with no penalty
+    processQueues(eventQueues_, false, accepted);
+
     while (!prefetchBuffer_.empty()) {
         if (is_debug_event(prefetchBuffer_.front())) {
             dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Pref    (%s)\n",
@@ -182,13 +169,16 @@ bool Cache::clockTick(Cycle_t time) {
 
     // Push any events that need to be retried next cycle onto the retry buffer
     std::vector<MemEventBase*>* rBuf = coherenceMgr_->getRetryBuffer();
-    std::copy( rBuf->begin(), rBuf->end(), std::back_inserter(retryBuffer_) );
+    for (std::vector<MemEventBase*>::iterator it = rBuf->begin(); it != rBuf->end(); it++)
+        queueEvent(*it, true);
     coherenceMgr_->clearRetryBuffer();
 
     idle &= coherenceMgr_->checkIdle();
 
+    recordPayloadStats(payloadStart);
+
     // Disable lower-level cache clocks if they're idle
-    if (eventBuffer_.empty() && retryBuffer_.empty() && idle) {
+    if (eventCount_ == 0 && retryCount_ == 0 && idle) {
         turnClockOff();
         return true;
     }
@@ -197,6 +187,69 @@ bool Cache::clockTick(Cycle_t time) {
     return false;
 }
 
+/*
+ * Handle events from 'queues' in arrival order until none can be handled this cycle or the
+ * per-cycle limit is reached. This visits events in the same order as a single arrival-ordered
+ * list, but a bank handles one event per cycle, so once a bank has been accessed the rest of its
+ * FIFO waits for the next cycle without being examined. Events rejected for other reasons
+ * (line already accessed this cycle, MSHR full, etc.) keep their place.
+ */
+void Cache::processQueues(std::vector<std::deque<QueuedEvent> > &queues, bool inMSHR, int &accepted) {
+    queueCursors_.assign(queues.size(), 0);
+    size_t noncacheable = queues.size() - 1;
+
+    while (accepted != maxRequestsPerCycle_) {
+        // Find the oldest event not yet examined this cycle
+        size_t queue = queues.size();
+        for (size_t i = 0; i < queues.size(); i++) {
+            if (queueCursors_[i] == queues[i].size())
+                continue;
+            if (queue == queues.size() || queues[i][queueCursors_[i]].seq < queues[queue][queueCursors_[queue]].seq)
+                queue = i;
+        }
+        if (queue == queues.size())
+            break;
+
+        std::deque<QueuedEvent>::iterator entry = queues[queue].begin() + queueCursors_[queue];
+        MemEventBase* ev = entry->ev;
+        if (is_debug_event(ev)) {
+            dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:%s   (%s)\n",
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), inMSHR ? "Retry" : "New  ", ev->getVerboseString().c_str());
+            fflush(stdout);
+        }
+        if (processEvent(ev, inMSHR)) {
+            queues[queue].erase(entry);
+            accepted++;
+            if (inMSHR) {
+                statRetryEvents->addData(1);
+                retryCount_--;
+            } else {
+                statRecvEvents->addData(1);
+                eventCount_--;
+            }
+        } else if (banked_ && queue != noncacheable && bankStatus_[queue]) {
+            // Lost bank arbitration, everything behind it waits on the same bank and counts as a conflict
+            size_t waiting = queues[queue].size() - queueCursors_[queue] - 1;
+            if (waiting)
+                statBankConflicts->addDataNTimes(waiting, 1);
+            queueCursors_[queue] = queues[queue].size();
+        } else {
+            queueCursors_[queue]++;
+        }
+    }
+}
+
+/* Attribute data payload copies made on this thread since 'start' to this cache */
+void Cache::recordPayloadStats(const PayloadCounters &start) {
+    const PayloadCounters &now = Payload::getCounters();
+    if (now.allocations != start.allocations)
+        statPayloadAllocs->addData(now.allocations - start.allocations);
+    if (now.copies != start.copies) {
+        statPayloadCopies->addData(now.copies - start.copies);
+        statPayloadBytesCopied->addData(now.bytesCopied - start.bytesCopied);
+    }
+}
+
 void Cache::turnClockOn() {
     if (clockIsOn_) return;
     Cycle_t time = reregisterClock(defaultTimeBase_, clockHandler_);
@@ -351,10 +404,7 @@ bool Cache::processEvent(MemEventBase* ev, bool inMSHR) {
 /* Arbitrate for access. Return whether successful */
 bool Cache::arbitrateAccess(Addr addr) {
     if (!banked_) {
-        if (addrsThisCycle_.find(addr) == addrsThisCycle_.end()) {
-            return true;
-        }
-        return false;
+        return !addrsThisCycle_.contains(addr);
     }
 
     Addr bank = coherenceMgr_->getBank(addr);
@@ -381,16 +431,16 @@ void Cache::processNoncacheable(MemEventBase* event) {
     
     if (CommandRouteByAddress[(int)event->getCmd()]) { /* These events don't have a destination already */
         if (!(event->queryFlag(MemEvent::F_NORESPONSE))) {
-            noncacheableResponseDst_.insert(std::make_pair(event->getID(), event->getSrc()));
+            noncacheableResponseDst_.insert(std::make_pair(event->getID(), event->getSrcID()));
         }
         coherenceMgr_->forwardByAddress(event);
     } else {
-        std::map<SST::Event::id_type,std::string>::iterator it = noncacheableResponseDst_.find(event->getResponseToID());
+        std::map<SST::Event::id_type,uint32_t>::iterator it = noncacheableResponseDst_.find(event->getResponseToID());
         if (it == noncacheableResponseDst_.end()) {
             out_->fatal(CALL_INFO, 01, "%s, Error: noncacheable response received does not match a request. Event: (%s). Time: %" PRIu64 "\n",
                     getName().c_str(), event->getVerboseString().c_str(), getCurrentSimTimeNano());
         }
-        event->setDst(it->second);
+        event->setDstID(it->second);
         coherenceMgr_->forwardByDestination(event);
         noncacheableResponseDst_.erase(it);
     }
@@ -522,6 +572,9 @@ void Cache::setup() {
     if (linkUp_ != linkDown_) 
         linkDown_->setup();
 
+    // Replay warmup traces, if any. The first cache to reach setup() warms the whole hierarchy
+    WarmupRegistry::run(out_);
+
     // Enqueue the first wakeup event to check for deadlock
     if (timeout_ != 0)
         timeoutSelfLink_->send(1, nullptr);
@@ -542,7 +595,7 @@ void Cache::finish() {
 void Cache::printStatus(Output &out) {
     out.output("MemHierarchy::Cache %s\n", getName().c_str());
     out.output("  Clock is %s. Last active cycle: %" PRIu64 "\n", clockIsOn_ ? "on" : "off", timestamp_);
-    out.output("  Events in queues: Retry = %zu, Event = %zu, Prefetch = %zu\n", retryBuffer_.size(), eventBuffer_.size(), prefetchBuffer_.size());
+    out.output("  Events in queues: Retry = %zu, Event = %zu, Prefetch = %zu\n", retryCount_, eventCount_, prefetchBuffer_.size());
     if (mshr_) {
         out.output("  MSHR Status:\n");
         mshr_->printStatus(out);
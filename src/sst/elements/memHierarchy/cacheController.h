@@ -16,6 +16,7 @@
 #ifndef MEMHIERARCHY_CACHECONTROLLER_H_
 #define MEMHIERARCHY_CACHECONTROLLER_H_
 
+#include <deque>
 #include <queue>
 #include <map>
 #include <string>
@@ -35,6 +36,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/addrSet.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -90,6 +92,9 @@ public:
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"warmup_trace",            "(string) L1s only. Trace of accesses to replay functionally through the memory hierarchy before simulation starts, warming tag, coherence, and replacement state without simulating time. Requires a serial simulation and MESI/MSI caches, directories, and memory controllers below the L1.", ""},
+            {"warmup_trace_format",     "(string) Format of warmup_trace. Options: addr[one '<addr> [R|W] [pc]' per line], prospero_text, prospero_binary, prospero_compressed[requires zlib]. The prospero formats are also written by Ariel.", "addr"},
+            {"warmup_max_accesses",     "(uint) Stop replaying warmup_trace after this many accesses. 0 replays the whole trace.", "0"},
             /* Old parameters - deprecated or moved */
             {"network_address",             "DEPRECATED - Now auto-detected by link control."}, // Remove 9.0
             {"network_bw",                  "MOVED - Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove 9.0
@@ -118,6 +123,9 @@ public:
             {"TotalEventsReplayed",     "Total number of events that were initially blocked and then were replayed", "events", 1},
             {"MSHR_occupancy",          "Number of events in MSHR each cycle", "events", 1},
             {"Bank_conflicts",          "Total number of bank conflicts detected", "count", 1},
+            {"Payload_allocations",     "Data payload buffers allocated from the heap while handling events; other buffers are reused from a pool", "count", 2},
+            {"Payload_copies",          "Number of times data payloads were copied while handling events", "count", 2},
+            {"Payload_bytes_copied",    "Bytes of data payloads copied while handling events", "bytes", 2},
             {"Prefetch_requests",       "Number of prefetches received from prefetcher at this cache", "events", 1},
             {"Prefetch_drops",          "Number of prefetches that were cancelled. Reasons: too many prefetches outstanding, cache can't handle prefetch this cycle, currently handling another event for the address.", "events", 1},
             /*Event receives */
@@ -173,7 +181,7 @@ public:
 
     /** Constructor for Cache Component */
     Cache(ComponentId_t id, Params &params);
-    ~Cache() { }
+    ~Cache() { WarmupRegistry::removeTarget(getName(), coherenceMgr_); }
 
     /** Component API - pre- and post-simulation */
     virtual void init(unsigned int);
@@ -208,11 +216,20 @@ private:
     // Coherence manager creation
     void createCoherenceManager(Params &params);
 
+    /** Register for functional warmup and open the warmup trace, if any */
+    void createWarmup(Params &params);
+
     // Configure links
     void configureLinks(Params &params, TimeConverter* tc);
 
     /** Cache operation ********************************************************/
 
+    // An event waiting in one of the cache's FIFOs
+    struct QueuedEvent {
+        uint64_t seq;       // Arrival order
+        MemEventBase* ev;
+    };
+
     // Computes base address based on line size
     Addr toBaseAddr(Addr addr) {
         return (addr) & ~(lineSize_ - 1);
@@ -224,6 +241,12 @@ private:
     // Handle incoming prefetching events -> prepare to process
     void handlePrefetchEvent(SST::Event *event);
 
+    // Queue an event for processing on its bank's FIFO
+    void queueEvent(MemEventBase * ev, bool retry);
+
+    // Process events from a set of FIFOs in arrival order
+    void processQueues(std::vector<std::deque<QueuedEvent> > &queues, bool inMSHR, int &accepted);
+
     // Process events
     bool processEvent(MemEventBase * ev, bool inMSHR);
 
@@ -285,11 +308,21 @@ private:
     uint64_t                    timestamp_;
     int                         requestsThisCycle_;
     std::vector<bool>           bankStatus_;
-    std::set<Addr>              addrsThisCycle_;
-    std::list<MemEventBase*>    retryBuffer_;
-    std::list<MemEventBase*>    eventBuffer_;
+    AddrSet                     addrsThisCycle_;
+    // Waiting events, one FIFO per bank (a single FIFO if unbanked) plus a last FIFO for events
+    // that bypass the cache array. Events are tagged with their arrival order so the FIFOs can be
+    // handled in that order. A bank handles one event per cycle, so events queued behind a busy
+    // bank are not rescanned.
+    // Events that conflict in the MSHR are held there and queued for retry when woken.
+    std::vector<std::deque<QueuedEvent> > retryQueues_;     // Events woken by the coherence manager
+    std::vector<std::deque<QueuedEvent> > eventQueues_;     // New events
+    std::vector<size_t>         queueCursors_;              // Scratch, next event to examine in each FIFO
+    uint64_t                    arrivalSeq_;                // Arrival order of the next queued event
+    size_t                      retryCount_;
+    size_t                      eventCount_;
     std::queue<MemEventBase*>   prefetchBuffer_;
-    std::map<SST::Event::id_type, std::string> noncacheableResponseDst_;
+    std::map<SST::Event::id_type, uint32_t> noncacheableResponseDst_;  // Request ID -> requestor's endpoint id
+    uint32_t                    endpointID_;                // Endpoint id of this cache's name (see EndpointRegistry)
 
 
     /** Output and debug *******************************************************/
@@ -301,6 +334,12 @@ private:
     Statistic<uint64_t>* statMSHROccupancy;
     Statistic<uint64_t>* statBankConflicts;
 
+    // Data payload statistics
+    Statistic<uint64_t>* statPayloadAllocs;
+    Statistic<uint64_t>* statPayloadCopies;
+    Statistic<uint64_t>* statPayloadBytesCopied;
+    void recordPayloadStats(const PayloadCounters &start);
+
     // Prefetch statistics
     Statistic<uint64_t>* statPrefetchRequest;
     Statistic<uint64_t>* statPrefetchDrop;
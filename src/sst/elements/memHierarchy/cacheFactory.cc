@@ -23,6 +23,7 @@
 #include "cacheListener.h"
 #include "mshr.h"
 #include "memLinkBase.h"
+#include "warmup.h"
 
 using namespace SST::MemHierarchy;
 using namespace std;
@@ -45,6 +46,8 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
     bool found;
 
+    endpointID_ = EndpointRegistry::intern(getName());
+
     /* Warn about deprecated parameters */
     checkDeprecatedParams(params);
 
@@ -58,6 +61,11 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
     uint64_t banks = params.find<uint64_t>("banks", 0);
     bankStatus_.resize(banks, false);
     banked_ = banks;
+    retryQueues_.resize((banked_ ? banks : 1) + 1); // Last FIFO holds events that bypass the cache array
+    eventQueues_.resize((banked_ ? banks : 1) + 1);
+    arrivalSeq_ = 0;
+    retryCount_ = 0;
+    eventCount_ = 0;
 
     /* Create clock, deadlock timeout, etc. */
     createClock(params);
@@ -75,6 +83,7 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
     if (maxRequestsPerCycle_ == 0) {
         maxRequestsPerCycle_ = -1;  // Simplify compare
     }
+    addrsThisCycle_ = AddrSet(maxRequestsPerCycle_ > 0 ? maxRequestsPerCycle_ : 16);
     requestsThisCycle_ = 0;
 
     /* Configure links */
@@ -82,6 +91,8 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
     createCoherenceManager(params);
 
+    createWarmup(params);
+
     /* Register statistics */
     registerStatistics();
 
@@ -210,6 +221,24 @@ void Cache::createCoherenceManager(Params &params) {
 }
 
 
+void Cache::createWarmup(Params &params) {
+    WarmupRegistry::addTarget(getName(), coherenceMgr_);
+
+    std::string trace = params.find<std::string>("warmup_trace", "");
+    if (trace == "")
+        return;
+
+    if (!params.find<bool>("L1", false))
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: warmup_trace - only L1 caches can replay a warmup trace.\n", getName().c_str());
+    if (getNumRanks().rank > 1 || getNumRanks().thread > 1)
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: warmup_trace - functional warmup requires a serial simulation (1 rank, 1 thread).\n", getName().c_str());
+
+    std::string format = params.find<std::string>("warmup_trace_format", "addr");
+    uint64_t maxAccesses = params.find<uint64_t>("warmup_max_accesses", 0);
+    WarmupRegistry::addTrace(getName(), lineSize_, new WarmupTraceReader(trace, format, getName(), out_), maxAccesses);
+}
+
+
 /*
  *  Configure links to components above (closer to CPU) and below (closer to memory)
  *  Check for connected ports to determine which links to use
@@ -589,6 +618,7 @@ void Cache::createListeners(Params &params) {
             if (lists->isPopulated(i)) {
                 listeners_.push_back(lists->create<CacheListener>(i, ComponentInfo::SHARE_NONE));
                 listeners_[k]->registerResponseCallback(new Event::Handler<Cache>(this, &Cache::handlePrefetchEvent));
+                listeners_[k]->registerMSHROccupancy([this]() { return mshr_->getSize(); }, mshr_->getMaxSize());
                 k++;
             }
         }
@@ -599,6 +629,7 @@ void Cache::createListeners(Params &params) {
             prefParams = params.get_scoped_params("prefetcher");
             listeners_.push_back(loadAnonymousSubComponent<CacheListener>(prefetcher, "prefetcher", 0, ComponentInfo::INSERT_STATS, prefParams));
             listeners_[0]->registerResponseCallback(new Event::Handler<Cache>(this, &Cache::handlePrefetchEvent));
+            listeners_[0]->registerMSHROccupancy([this]() { return mshr_->getSize(); }, mshr_->getMaxSize());
         }
     }
     if (!listeners_.empty()) {
@@ -794,4 +825,7 @@ void Cache::registerStatistics() {
 
     statMSHROccupancy               = registerStatistic<uint64_t>("MSHR_occupancy");
     statBankConflicts               = registerStatistic<uint64_t>("Bank_conflicts");
+    statPayloadAllocs               = registerStatistic<uint64_t>("Payload_allocations");
+    statPayloadCopies               = registerStatistic<uint64_t>("Payload_copies");
+    statPayloadBytesCopied          = registerStatistic<uint64_t>("Payload_bytes_copied");
 }
@@ -26,6 +26,8 @@
 #include <sst/core/subcomponent.h>
 #include <sst/core/warnmacros.h>
 
+#include <functional>
+
 #include "sst/elements/memHierarchy/memEvent.h"
 
 using namespace SST;
@@ -87,6 +89,11 @@ public:
     virtual void printStats(Output &UNUSED(out)) {}
     virtual void notifyAccess(const CacheListenerNotification& UNUSED(notify)) {}
     virtual void registerResponseCallback(Event::HandlerBase *handler) { delete handler; }
+
+    /* Caches call this so a prefetcher can see how busy the cache is.
+     * occupancy returns the number of MSHR entries in use, maxSize is
+     * negative if the MSHR is unlimited. */
+    virtual void registerMSHROccupancy(std::function<int()> UNUSED(occupancy), int UNUSED(maxSize)) {}
 };
 
 }}
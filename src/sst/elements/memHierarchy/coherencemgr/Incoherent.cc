@@ -35,7 +35,7 @@ using namespace SST::MemHierarchy;
 bool Incoherent::handleGetS(MemEvent * event, bool inMSHR) {
     Addr addr = event->getBaseAddr();
     PrivateCacheLine * line = cacheArray_->lookup(addr, true);
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     State state = line ? line->getState() : I;
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -210,7 +210,7 @@ bool Incoherent::handleFlushLine(MemEvent * event, bool inMSHR) {
     switch (state) {
         case I:
             if (status == MemEventStatus::OK) {
-                forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0);
+                forwardFlush(event, event->getEvict(), &(event->getSharedPayload()), event->getDirty(), 0);
                 mshr_->setInProgress(addr);
             }
             break;
@@ -260,7 +260,7 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool inMSHR) {
     switch (state) {
         case I:
             if (status == MemEventStatus::OK) {
-                forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0);
+                forwardFlush(event, event->getEvict(), &(event->getSharedPayload()), event->getDirty(), 0);
                 mshr_->setInProgress(addr);
             }
             break;
@@ -303,7 +303,7 @@ bool Incoherent::handlePutE(MemEvent * event, bool inMSHR) {
         case I:
             status = allocateLine(event, line, inMSHR);
             if (status == MemEventStatus::OK) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getSharedPayload(), 0);
                 line->setState(E);
                 if (sendWritebackAck_)
                     sendWritebackAck(event);
@@ -346,7 +346,7 @@ bool Incoherent::handlePutM(MemEvent * event, bool inMSHR) {
         case I:
             status = allocateLine(event, line, inMSHR);
             if (status == MemEventStatus::OK) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getSharedPayload(), 0);
                 line->setState(M);
                 if (sendWritebackAck_)
                     sendWritebackAck(event);
@@ -356,7 +356,7 @@ bool Incoherent::handlePutM(MemEvent * event, bool inMSHR) {
         case E:
             line->setState(M);
         case M:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getSharedPayload(), 0);
             if (sendWritebackAck_)
                 sendWritebackAck(event);
             cleanUpAfterRequest(event, inMSHR);
@@ -391,11 +391,11 @@ bool Incoherent::handleGetSResp(MemEvent * event, bool inMSHR) {
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     req->setFlags(event->getMemFlags());
 
-    sendResponseUp(req, &event->getPayload(), true, 0);
+    sendResponseUp(req, &event->getSharedPayload(), true, 0);
 
     if (line) {
         line->setState(E);
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getSharedPayload(), 0);
         // Has to be a local prefetch
         line->setPrefetch(true);
         recordPrefetchLatency(req->getID(), LatType::MISS);
@@ -425,7 +425,7 @@ bool Incoherent::handleGetXResp(MemEvent * event, bool inMSHR) {
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     req->setFlags(event->getMemFlags());
 
-    sendResponseUp(req, &event->getPayload(), true, 0);
+    sendResponseUp(req, &event->getSharedPayload(), true, 0);
 
     cleanUpAfterResponse(event);
 
@@ -629,7 +629,7 @@ void Incoherent::cleanUpAfterRequest(MemEvent * event, bool inMSHR) {
     Addr addr = event->getBaseAddr();
 
     if (inMSHR) {
-        if (event->isPrefetch() && event->getRqstr() == cachename_) outstandingPrefetches_--;
+        if (event->isPrefetch() && event->getRqstrID() == cachenameID_) outstandingPrefetches_--;
         mshr_->removeFront(addr);
     }
 
@@ -652,7 +652,7 @@ void Incoherent::cleanUpAfterResponse(MemEvent * event) {
     delete event;
 
     if (req) {
-        if (req->isPrefetch() && req->getRqstr() == cachename_) outstandingPrefetches_--;
+        if (req->isPrefetch() && req->getRqstrID() == cachenameID_) outstandingPrefetches_--;
         delete req;
     }
     retry(addr);
@@ -681,7 +681,7 @@ void Incoherent::doEvict(MemEvent * event, PrivateCacheLine * line) {
     if (state == E || state == M) {
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getSharedPayload(), 0);
         }
 
         event->setEvict(false);
@@ -692,7 +692,7 @@ void Incoherent::doEvict(MemEvent * event, PrivateCacheLine * line) {
  * Event creation and send
  ***********************************************************************************************************/
 
-SimTime_t Incoherent::sendResponseUp(MemEvent * event, vector<uint8_t> * data, bool inMSHR, SimTime_t time, Command cmd, bool success) {
+SimTime_t Incoherent::sendResponseUp(MemEvent * event, const Payload* data, bool inMSHR, SimTime_t time, Command cmd, bool success) {
     MemEvent * responseEvent = event->makeResponse();
     if (cmd != Command::NULLCMD)
         responseEvent->setCmd(cmd);
@@ -729,7 +729,7 @@ void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty)
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t time = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     time += latency;
@@ -738,7 +738,7 @@ void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty)
 }
 
 
-void Incoherent::forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time) {
+void Incoherent::forwardFlush(MemEvent * event, bool evict, const Payload* data, bool dirty, uint64_t time) {
     MemEvent * flush = new MemEvent(*event);
 
     uint64_t latency = tagLatency_;
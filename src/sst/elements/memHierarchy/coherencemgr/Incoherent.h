@@ -303,11 +303,11 @@ private:
 
     void doEvict(MemEvent * event, PrivateCacheLine * line);
 
-    SimTime_t sendResponseUp(MemEvent * event, vector<uint8_t> * data, bool inMSHR, SimTime_t time, Command cmd = Command::NULLCMD, bool success = true);
+    SimTime_t sendResponseUp(MemEvent * event, const Payload* data, bool inMSHR, SimTime_t time, Command cmd = Command::NULLCMD, bool success = true);
 
     void sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty);
 
-    void forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t> * data, bool dirty, uint64_t time);
+    void forwardFlush(MemEvent * event, bool evict, const Payload* data, bool dirty, uint64_t time);
 
     void sendWritebackAck(MemEvent * event);
 
@@ -38,7 +38,7 @@ using namespace SST::MemHierarchy;
 bool IncoherentL1::handleGetS(MemEvent* event, bool inMSHR){
     Addr addr = event->getBaseAddr();
     L1CacheLine * line = cacheArray_->lookup(addr, true);
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     State state = line ? line->getState() : I;
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -181,7 +181,7 @@ bool IncoherentL1::handleGetX(MemEvent* event, bool inMSHR) {
 
             // Handle
             if (!event->isStoreConditional() || line->isAtomic(event->getThreadID())) { /* Don't write on a non-atomic SC */
-                line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+                line->setData(event->getSharedPayload(), event->getAddr() - event->getBaseAddr());
                 line->atomicEnd();
                 if (is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
@@ -411,13 +411,13 @@ bool IncoherentL1::handleGetSResp(MemEvent * event, bool inMSHR) {
     stat_eventState[(int)(event->getCmd())][state]->addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
 
    if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), Command::GetSResp, (localPrefetch ? "-pref" : ""), addr, state);
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getSharedPayload(), 0);
     line->setState(E);
     if (is_debug_addr(addr))
         printDataValue(addr, line->getData(), false);
@@ -468,7 +468,7 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool inMSHR) {
     req->setMemFlags(event->getMemFlags());
 
     // Set line data
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getSharedPayload(), 0);
     if (is_debug_addr(line->getAddr()))
         printDataValue(line->getAddr(), line->getData(), true);
 
@@ -481,7 +481,7 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool inMSHR) {
     bool success = true;
     if (req->getCmd() == Command::GetX || req->getCmd() == Command::Write) {
         if (!req->isStoreConditional() || line->isAtomic(req->getThreadID())) {
-            line->setData(req->getPayload(), offset);
+            line->setData(req->getSharedPayload(), offset);
             if (is_debug_addr(line->getAddr()))
                 printDataValue(line->getAddr(), line->getData(), true);
             line->atomicEnd();
@@ -640,7 +640,7 @@ MemEventStatus IncoherentL1::allocateMSHR(MemEvent * event, bool fwdReq, int pos
     // Screen prefetches first to ensure limits are not exceeeded:
     //      - Maximum number of outstanding prefetches
     //      - MSHR too full to accept prefetches
-    if (event->isPrefetch() && event->getRqstr() == cachename_) {
+    if (event->isPrefetch() && event->getRqstrID() == cachenameID_) {
         if (dropPrefetchLevel_ <= mshr_->getSize()) {
             eventDI.action = "Reject";
             eventDI.reason = "Prefetch drop level";
@@ -921,7 +921,7 @@ void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -48,12 +48,12 @@ using namespace SST::MemHierarchy;
 bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
     Addr addr = event->getBaseAddr();
     SharedCacheLine * line = cacheArray_->lookup(addr, true);
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     State state = line ? line->getState() : I;
 
     MemEventStatus status = MemEventStatus::OK;
     uint64_t sendTime = 0;
-    vector<uint8_t>* data;
+    const Payload* data;
     Command respcmd;
 
     if (is_debug_addr(addr))
@@ -1318,7 +1318,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
     //if (is_debug_addr(addr))
         //debug->debug(_L5_, "    Request: %s\n", req->getBriefString().c_str());
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
     req->setFlags(event->getMemFlags());
 
     // Sanity check line state
@@ -1328,7 +1328,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     }
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getSharedPayload(), 0);
     line->setState(S);
 
     if (is_debug_addr(addr))
@@ -1367,7 +1367,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
 
     // Get matching request
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
     req->setFlags(event->getMemFlags());
 
     std::vector<uint8_t> data;
@@ -1376,7 +1376,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     switch (state) {
         case IS:
         {
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getSharedPayload(), 0);
 
             if (event->getDirty())  {
                 line->setState(M); // Sometimes get dirty data from a noninclusive cache
@@ -1406,7 +1406,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             break;
         }
         case IM:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getSharedPayload(), 0);
             if (is_debug_addr(line->getAddr()))
                 printDataValue(addr, line->getData(), true);
         case SM:
@@ -1740,6 +1740,139 @@ bool MESIInclusive::handleNACK(MemEvent * event, bool inMSHR) {
 }
 
 
+/***********************************************************************************************************
+ * Functional warmup
+ ***********************************************************************************************************/
+
+/* Apply a GetS/GetX from an upper level 'src', mirroring handleGetS/handleGetX and their responses */
+State MESIInclusive::warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data) {
+    SharedCacheLine * line = cacheArray_->lookup(addr, true);
+    State state = line ? line->getState() : I;
+
+    if (state == I) {
+        if (!line)
+            line = warmAllocate(addr);
+        Payload fill(lineSize_);
+        State granted = getWarmupTargetDown(addr)->warmRequest(addr, cmd, cachename_, fill);
+        line->setData(fill, 0);
+        if (cmd == Command::GetX)
+            state = M;
+        else
+            state = (granted == S) ? S : protocolState_;
+    } else if (cmd == Command::GetX && state == S) {
+        if (lastLevel_) {
+            state = protocol_ ? E : M;
+        } else {
+            Payload fill(lineSize_);
+            getWarmupTargetDown(addr)->warmRequest(addr, cmd, cachename_, fill);
+            state = M;
+        }
+    }
+
+    State granted;
+    if (cmd == Command::GetS) {
+        if (line->hasOwner()) { // FetchInvX the owner, it becomes a sharer
+            std::string owner = line->getOwner();
+            if (getWarmupTargetUp(owner)->warmInvalidate(addr, Command::FetchInvX))
+                state = M;
+            line->removeOwner();
+            line->addSharer(owner);
+        }
+        if (protocol_ && state != S && !line->hasSharers()) {
+            line->setOwner(src);
+            granted = E;
+        } else {
+            line->addSharer(src);
+            granted = S;
+        }
+    } else {
+        std::set<std::string> sharers = *(line->getSharers());
+        for (std::set<std::string>::iterator it = sharers.begin(); it != sharers.end(); it++) {
+            if (*it == src)
+                continue;
+            getWarmupTargetUp(*it)->warmInvalidate(addr, Command::Inv);
+            line->removeSharer(*it);
+        }
+        if (line->hasOwner() && line->getOwner() != src) {
+            if (getWarmupTargetUp(line->getOwner())->warmInvalidate(addr, Command::FetchInv))
+                state = M;
+            line->removeOwner();
+        }
+        if (line->isSharer(src))
+            line->removeSharer(src);
+        line->setOwner(src);
+        granted = M;
+    }
+
+    line->setState(state);
+    data.write(*line->getData(), 0);
+    return granted;
+}
+
+/* Apply a PutS/PutE/PutM from an upper level 'src' */
+void MESIInclusive::warmWriteback(Addr addr, Command cmd, const std::string &src) {
+    SharedCacheLine * line = cacheArray_->lookup(addr, false);
+    if (!line || line->getState() == I)
+        return;
+
+    if (line->getOwner() == src)
+        line->removeOwner();
+    else if (line->isSharer(src))
+        line->removeSharer(src);
+
+    if (cmd == Command::PutM && line->getState() == E)
+        line->setState(M);
+}
+
+/* Inv/FetchInv invalidate this line and all upper copies, FetchInvX downgrades the owner and this line to S */
+bool MESIInclusive::warmInvalidate(Addr addr, Command cmd) {
+    SharedCacheLine * line = cacheArray_->lookup(addr, false);
+    State state = line ? line->getState() : I;
+    if (state == I)
+        return false;
+
+    bool dirty = (state == M);
+    if (line->hasOwner()) {
+        std::string owner = line->getOwner();
+        if (getWarmupTargetUp(owner)->warmInvalidate(addr, cmd == Command::FetchInvX ? Command::FetchInvX : Command::FetchInv))
+            dirty = true;
+        line->removeOwner();
+        if (cmd == Command::FetchInvX)
+            line->addSharer(owner);
+    }
+
+    if (cmd == Command::FetchInvX) {
+        line->setState(S);
+        return dirty;
+    }
+
+    std::set<std::string> sharers = *(line->getSharers());
+    for (std::set<std::string>::iterator it = sharers.begin(); it != sharers.end(); it++) {
+        getWarmupTargetUp(*it)->warmInvalidate(addr, Command::Inv);
+        line->removeSharer(*it);
+    }
+    line->setState(I);
+    return dirty;
+}
+
+/* Evict the replacement candidate for addr, if any, and allocate a line for addr */
+SharedCacheLine * MESIInclusive::warmAllocate(Addr addr) {
+    SharedCacheLine * line = cacheArray_->findReplacementCandidate(addr);
+    State state = line->getState();
+
+    if (state != I) {
+        Addr victim = line->getAddr();
+        bool dirty = warmInvalidate(victim, Command::FetchInv);
+        if (dirty || !silentEvictClean_) {
+            Command cmd = dirty ? Command::PutM : (state == E ? Command::PutE : Command::PutS);
+            getWarmupTargetDown(victim)->warmWriteback(victim, cmd, cachename_);
+        }
+    }
+    cacheArray_->replace(addr, line);
+    return line;
+}
+
+
 /***********************************************************************************************************
  * MSHR and CacheArray management
  ***********************************************************************************************************/
@@ -1874,7 +2007,7 @@ void MESIInclusive::cleanUpEvent(MemEvent* event, bool inMSHR) {
 
     /* Remove from MSHR */
     if (inMSHR) {
-        if (event->isPrefetch() && event->getRqstr() == cachename_) outstandingPrefetches_--;
+        if (event->isPrefetch() && event->getRqstrID() == cachenameID_) outstandingPrefetches_--;
         mshr_->removeFront(addr);
     }
 
@@ -1918,7 +2051,7 @@ void MESIInclusive::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
     mshr_->removeFront(addr);
     delete event;
     if (req) {
-        if (req->isPrefetch() && req->getRqstr() == cachename_) 
+        if (req->isPrefetch() && req->getRqstrID() == cachenameID_) 
             outstandingPrefetches_--;
         delete req;
     }
@@ -1966,7 +2099,7 @@ State MESIInclusive::doEviction(MemEvent * event, SharedCacheLine * line, State
     recordPrefetchResult(line, statPrefetchEvict);
 
     if (event->getDirty()) {
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getSharedPayload(), 0);
         if (is_debug_addr(event->getBaseAddr())) {
                 printDataValue(event->getBaseAddr(), line->getData(), true);
         }
@@ -2000,7 +2133,7 @@ State MESIInclusive::doEviction(MemEvent * event, SharedCacheLine * line, State
  * Event creation and send
  ***********************************************************************************************************/
 
-SimTime_t MESIInclusive::sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t time, Command cmd, bool success) {
+SimTime_t MESIInclusive::sendResponseUp(MemEvent * event, const Payload* data, bool inMSHR, uint64_t time, Command cmd, bool success) {
     MemEvent * responseEvent = event->makeResponse();
     if (cmd != Command::NULLCMD)
         responseEvent->setCmd(cmd);
@@ -2103,7 +2236,7 @@ void MESIInclusive::sendWriteback(Command cmd, SharedCacheLine* line, bool dirty
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -2204,7 +2337,7 @@ uint64_t MESIInclusive::invalidateSharer(std::string shr, MemEvent * event, Shar
         if (event) {
             inv->copyMetadata(event);
         } else {
-            inv->setRqstr(cachename_);
+            inv->setRqstrID(cachenameID_);
         }
         inv->setDst(shr);
         inv->setSize(lineSize_);
@@ -2241,7 +2374,7 @@ bool MESIInclusive::invalidateOwner(MemEvent * event, SharedCacheLine * line, bo
     if (event) {
         inv->copyMetadata(event);
     } else {
-        inv->setRqstr(cachename_);
+        inv->setRqstrID(cachenameID_);
     }
     inv->setDst(line->getOwner());
     inv->setSize(lineSize_);
@@ -498,6 +498,11 @@ public:
     virtual bool handleAckInv(MemEvent * event, bool inMSHR);
     virtual bool handleAckPut(MemEvent * event, bool inMSHR);
     virtual bool handleNACK(MemEvent * event, bool inMSHR);
+
+    /** Functional warmup */
+    virtual State warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data);
+    virtual void warmWriteback(Addr addr, Command cmd, const std::string &src);
+    virtual bool warmInvalidate(Addr addr, Command cmd);
     virtual bool handleNULLCMD(MemEvent * event, bool inMSHR);
 
     /** Cache interface **/
@@ -543,6 +548,7 @@ private:
     MemEventStatus processCacheMiss(MemEvent * event, SharedCacheLine * line, bool inMSHR);
     SharedCacheLine * allocateLine(MemEvent * event, SharedCacheLine * line);
     bool handleEviction(Addr addr, SharedCacheLine *& line);
+    SharedCacheLine * warmAllocate(Addr addr);
     void cleanUpAfterRequest(MemEvent * event, bool inMSHR);
     void cleanUpAfterResponse(MemEvent * event, bool inMSHR);
     void cleanUpEvent(MemEvent * event, bool inMSHR);
@@ -558,7 +564,7 @@ private:
     void forwardFlush(MemEvent * event, SharedCacheLine * line, bool data);
 
     /** Send response up (towards processor) */
-    SimTime_t sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t time, Command cmd = Command::NULLCMD, bool success = true);
+    SimTime_t sendResponseUp(MemEvent * event, const Payload* data, bool inMSHR, uint64_t time, Command cmd = Command::NULLCMD, bool success = true);
 
     /** Send response down (towards memory) */
     void sendResponseDown(MemEvent * event, SharedCacheLine * line, bool data, bool evict);
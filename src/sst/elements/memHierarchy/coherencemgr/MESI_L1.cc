@@ -44,7 +44,7 @@ using namespace SST::MemHierarchy;
 bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
     Addr addr = event->getBaseAddr();
     L1CacheLine * line = cacheArray_->lookup(addr, true);
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     State state = line ?  line->getState() : I;
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
@@ -243,7 +243,7 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
             }
 
             if (!event->isStoreConditional() || line->isAtomic(event->getThreadID())) { // Don't write on a non-atomic SC
-                line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+                line->setData(event->getSharedPayload(), event->getAddr() - event->getBaseAddr());
                 line->atomicEnd();
                 if (is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
@@ -840,7 +840,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool inMSHR) {
     stat_eventState[(int)Command::GetSResp][state]->addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
 
     if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), req->getThreadID(), Command::GetSResp, (localPrefetch ? "-pref" : ""), addr, state);
@@ -848,7 +848,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool inMSHR) {
     req->setMemFlags(event->getMemFlags()); // Copy MemFlags through
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getSharedPayload(), 0);
     line->setState(S);
     if (is_debug_addr(addr))
         printDataValue(addr, line->getData(), false);
@@ -891,7 +891,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
     stat_eventState[(int)Command::GetXResp][state]->addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
 
     if (is_debug_addr(addr)) {
         std::string mod = localPrefetch ? "-pref" : (req->isLoadLink() ? "-LL" : (req->isStoreConditional() ? "-SC" : ""));
@@ -906,7 +906,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
     switch (state) {
         case IS:
             {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getSharedPayload(), 0);
                 if (is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
 
@@ -927,7 +927,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
                 break;
             }
         case IM:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getSharedPayload(), 0);
             if (is_debug_addr(addr))
                 printDataValue(addr, line->getData(), true);
         case SM:
@@ -936,7 +936,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
 
                 if (req->getCmd() == Command::Write || req->getCmd() == Command::GetX) {
                     if (!req->isStoreConditional() || line->isAtomic(req->getThreadID())) { // Normal or successful store-conditional
-                        line->setData(req->getPayload(), offset);
+                        line->setData(req->getSharedPayload(), offset);
 
                         if (is_debug_addr(addr))
                             printDataValue(addr, line->getData(), true);
@@ -1106,6 +1106,67 @@ bool MESIL1::handleNACK(MemEvent* event, bool inMSHR) {
 }
 
 
+/***********************************************************************************************************
+ * Functional warmup
+ ***********************************************************************************************************/
+
+/* Apply a load (GetS) or store (GetX) from the trace, requesting the block from below on a miss or upgrade */
+State MESIL1::warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data) {
+    L1CacheLine * line = cacheArray_->lookup(addr, true);
+    State state = line ? line->getState() : I;
+
+    if (state == I) {
+        if (!line)
+            line = warmAllocate(addr);
+        Payload fill(lineSize_);
+        State granted = getWarmupTargetDown(addr)->warmRequest(addr, cmd, cachename_, fill);
+        line->setData(fill, 0);
+        if (cmd == Command::GetX)
+            state = M;
+        else
+            state = (granted == S) ? S : protocolReadState_;
+    } else if (cmd == Command::GetX) {
+        if (state == S) {
+            Payload fill(lineSize_);
+            getWarmupTargetDown(addr)->warmRequest(addr, cmd, cachename_, fill);
+        }
+        state = M;
+    }
+
+    line->setState(state);
+    data.write(*line->getData(), 0);
+    return state;
+}
+
+/* Inv/FetchInv invalidate, FetchInvX downgrades to S */
+bool MESIL1::warmInvalidate(Addr addr, Command cmd) {
+    L1CacheLine * line = cacheArray_->lookup(addr, false);
+    State state = line ? line->getState() : I;
+    if (state == I)
+        return false;
+
+    line->setState(cmd == Command::FetchInvX ? S : I);
+    return state == M;
+}
+
+/* Evict the replacement candidate for addr, if any, and allocate a line for addr */
+L1CacheLine* MESIL1::warmAllocate(Addr addr) {
+    L1CacheLine * line = cacheArray_->findReplacementCandidate(addr);
+    State state = line->getState();
+
+    if (state != I) {
+        Addr victim = line->getAddr();
+        line->setState(I);
+        if (state == M || !silentEvictClean_) {
+            Command cmd = (state == M) ? Command::PutM : (state == E ? Command::PutE : Command::PutS);
+            getWarmupTargetDown(victim)->warmWriteback(victim, cmd, cachename_);
+        }
+    }
+    cacheArray_->replace(addr, line);
+    return line;
+}
+
+
 /***********************************************************************************************************
  * MSHR and CacheArray management
  ***********************************************************************************************************/
@@ -1273,7 +1334,7 @@ void MESIL1::cleanUpAfterRequest(MemEvent * event, bool inMSHR) {
     
     /* Remove from MSHR */
     if (inMSHR) {
-        if (event->isPrefetch() && event->getRqstr() == cachename_) outstandingPrefetches_--;
+        if (event->isPrefetch() && event->getRqstrID() == cachenameID_) outstandingPrefetches_--;
         mshr_->removeFront(addr);
     }
 
@@ -1310,7 +1371,7 @@ void MESIL1::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
     mshr_->removeFront(addr); // delete req after this since debug might print the event it's removing
     delete event;
     if (req) {
-        if (req->isPrefetch() && req->getRqstr() == cachename_) outstandingPrefetches_--;
+        if (req->isPrefetch() && req->getRqstrID() == cachenameID_) outstandingPrefetches_--;
         delete req;
     }
 
@@ -1483,7 +1544,7 @@ void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty) {
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > line->getTimestamp()) ? timestamp_ : line->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -383,6 +383,10 @@ public:
     bool handleNULLCMD(MemEvent * event, bool inMSHR);
     bool handleNACK(MemEvent * event, bool inMSHR);
 
+    /** Functional warmup */
+    State warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data);
+    bool warmInvalidate(Addr addr, Command cmd);
+
     /** Configuration */
     MemEventInitCoherence* getInitCoherenceEvent();
     virtual std::set<Command> getValidReceiveEvents();
@@ -411,6 +415,7 @@ private:
     MemEventStatus checkMSHRCollision(MemEvent* event, bool inMSHR);
     L1CacheLine* allocateLine(MemEvent * event, L1CacheLine * line);
     bool handleEviction(Addr addr, L1CacheLine *& line);
+    L1CacheLine* warmAllocate(Addr addr);
     void cleanUpAfterRequest(MemEvent * event, bool inMSHR);
     void cleanUpAfterResponse(MemEvent * event, bool inMSHR);
     void retry(Addr addr);
@@ -490,20 +490,20 @@ private:
     void retry(Addr addr);
 
     /** Forward a flush line request, with or without data */
-    uint64_t forwardFlush(MemEvent* event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time);
+    uint64_t forwardFlush(MemEvent* event, bool evict, const Payload* data, bool dirty, uint64_t time);
 
     /** Forward a request */
     uint64_t sendFwdRequest(MemEvent * event, Command cmd, std::string dst, uint32_t size, uint64_t startTime, bool inMSHR);
 
     /** Send response up (to processor) */
-    uint64_t sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t baseTime, Command cmd = Command::GetSResp, bool success = true);
-    uint64_t sendExclusiveResponse(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t baseTime, bool dirty);
+    uint64_t sendResponseUp(MemEvent * event, const Payload* data, bool inMSHR, uint64_t baseTime, Command cmd = Command::GetSResp, bool success = true);
+    uint64_t sendExclusiveResponse(MemEvent * event, const Payload* data, bool inMSHR, uint64_t baseTime, bool dirty);
 
     /** Send response down (towards memory) */
-    void sendResponseDown(MemEvent * event, uint32_t size, vector<uint8_t>* data, bool dirty);
+    void sendResponseDown(MemEvent * event, uint32_t size, const Payload* data, bool dirty);
 
     /** Send writeback request to lower level caches */
-    uint64_t sendWriteback(Addr addr, uint32_t size, Command cmd, std::vector<uint8_t>* data, bool dirty, uint64_t time = 0);
+    uint64_t sendWriteback(Addr addr, uint32_t size, Command cmd, const Payload* data, bool dirty, uint64_t time = 0);
 
     void sendWritebackAck(MemEvent * event);
 
@@ -38,7 +38,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
     DataLine * data = (tag) ? dataArray_->lookup(addr, true) : nullptr;
     if (data && data->getTag() != tag) data = nullptr;
 
-    bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
+    bool localPrefetch = event->isPrefetch() && (event->getRqstrID() == cachenameID_);
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
     Command respcmd;
@@ -496,7 +496,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
 
-    vector<uint8_t>* datavec = nullptr;
+    const Payload* datavec = nullptr;
     recordLatencyType(event->getID(), LatType::HIT);
 
     switch (state) {
@@ -655,9 +655,9 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                     break;
                 }
                 data = dataArray_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getSharedPayload(), 0);
                 if (is_debug_addr(addr))
-                    printDataValue(addr, &(event->getPayload()), true);
+                    printDataValue(addr, &(event->getSharedPayload()), true);
                 inMSHR = true;
             }
             if (!inMSHR || !mshr_->getProfiled(addr)) {
@@ -701,7 +701,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
             if (event->getSrc() == *(tag->getSharers()->begin())) { // Sent fetch to this requestor
                 // Retry the pending fetch
                 mshr_->decrementAcksNeeded(addr);
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getSharedPayload());
                 responses.find(addr)->second.erase(event->getSrc());
                 if (responses.find(addr)->second.empty())
                     responses.erase(addr);
@@ -784,9 +784,9 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
                     break;
                 }
                 data = dataArray_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getSharedPayload(), 0);
                 if (is_debug_addr(addr))
-                    printDataValue(addr, &(event->getPayload()), true);
+                    printDataValue(addr, &(event->getSharedPayload()), true);
                 inMSHR = true;
             }
             tag->removeOwner();
@@ -801,7 +801,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getSharedPayload());
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
@@ -831,7 +831,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getSharedPayload());
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
@@ -890,9 +890,9 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                     break;
                 }
                 data = dataArray_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getSharedPayload(), 0);
                 if (is_debug_addr(addr))
-                    printDataValue(addr, &(event->getPayload()), true);
+                    printDataValue(addr, &(event->getSharedPayload()), true);
                 inMSHR = true;
             } else if (!inMSHR || !mshr_->getProfiled(addr)) {
                 stat_eventState[(int)Command::PutM][state]->addData(1);
@@ -919,15 +919,15 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     stat_eventState[(int)Command::PutM][state]->addData(1);
                 }
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getSharedPayload(), 0);
                 if (is_debug_addr(addr))
-                    printDataValue(addr, &(event->getPayload()), true);
+                    printDataValue(addr, &(event->getSharedPayload()), true);
                 sendWritebackAck(event);
                 cleanUpEvent(event, inMSHR);
             } else {
                 tag->addSharer(event->getSrc());
                 event->setCmd(Command::PutS);
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getSharedPayload());
                 if (inMSHR)
                     mshr_->removeFront(addr); // Need to reinsert after the conflicting request
                 MemEventBase* entry = mshr_->getEntryEvent(addr, 1);
@@ -948,7 +948,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getSharedPayload());
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
@@ -1002,9 +1002,9 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
                 tag->setState(M);
 
             if (data) {
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getSharedPayload(), 0);
                 if (is_debug_addr(addr))
-                    printDataValue(addr, &(event->getPayload()), true);
+                    printDataValue(addr, &(event->getSharedPayload()), true);
             }
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -1016,12 +1016,12 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
                 tag->setState(E);
 
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getSharedPayload(), 0);
             else
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getSharedPayload());
             
             if (is_debug_addr(addr))
-                printDataValue(addr, &(event->getPayload()), true);
+                printDataValue(addr, &(event->getSharedPayload()), true);
 
             mshr_->decrementAcksNeeded(addr);
 
@@ -1033,12 +1033,12 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
                 tag->setState(M_Inv);
 
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getSharedPayload(), 0);
             else
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getSharedPayload());
             
             if (is_debug_addr(addr))
-                printDataValue(addr, &(event->getPayload()), true);
+                printDataValue(addr, &(event->getSharedPayload()), true);
 
             cleanUpEvent(event, inMSHR);
             break;
@@ -1105,7 +1105,7 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
         case SA:
             //Look for a PutS in the MSHR
             put = static_cast<MemEvent*>(mshr_->getFirstEventEntry(addr, Command::PutS));
-            sendResponseDown(event, &(put->getPayload()), false, false);
+            sendResponseDown(event, &(put->getSharedPayload()), false, false);
             stat_eventState[(int)Command::Fetch][state]->addData(1);
             cleanUpEvent(event, inMSHR);
             break;
@@ -1636,7 +1636,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
             // TODO make sure the pending eviction won't mess anything up when it tries to replay
             put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
             sendWritebackAck(put);
-            sendResponseDown(event, &(put->getPayload()), state == MA, true);
+            sendResponseDown(event, &(put->getSharedPayload()), state == MA, true);
             dirArray_->deallocate(tag);
             if (mshr_->hasData(addr))
                 mshr_->clearData(addr);
@@ -1798,7 +1798,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                 stat_eventState[(int)Command::FetchInvX][state]->addData(1);
             }
             req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-            sendResponseDown(event, &(req->getPayload()), state == M, true); // TODO Double check that a downgrade counts as an evict
+            sendResponseDown(event, &(req->getSharedPayload()), state == M, true); // TODO Double check that a downgrade counts as an evict
             // Clean up so that when we replay the replacement we get the right downgraded state
             req->setCmd(Command::PutS);
             tag->removeOwner();
@@ -1843,7 +1843,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     // Find matching request in MSHR
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
     req->setFlags(event->getMemFlags());
 
     if (is_debug_event(event))
@@ -1853,9 +1853,9 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
 
     tag->setState(S);
     if (data) {
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getSharedPayload(), 0);
         if (is_debug_addr(addr))
-            printDataValue(addr, &(event->getPayload()), true);
+            printDataValue(addr, &(event->getSharedPayload()), true);
     }
 
     if (localPrefetch) {
@@ -1864,7 +1864,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
             eventDI.action = "Done";
     } else {
         tag->addSharer(req->getSrc());
-        uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetSResp);
+        uint64_t sendTime = sendResponseUp(req, &(event->getSharedPayload()), true, tag->getTimestamp(), Command::GetSResp);
         tag->setTimestamp(sendTime-1);
     }
 
@@ -1891,16 +1891,16 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     // Get matching request
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
 
-    bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
+    bool localPrefetch = req->isPrefetch() && (req->getRqstrID() == cachenameID_);
     req->setFlags(event->getMemFlags());
 
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetXResp, (localPrefetch ? "-pref" : ""), addr, state);
 
     if (data) {
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getSharedPayload(), 0);
         if (is_debug_addr(addr))
-            printDataValue(addr, &(event->getPayload()), true);
+            printDataValue(addr, &(event->getSharedPayload()), true);
     }
 
     stat_eventState[(int)Command::GetXResp][state]->addData(1);
@@ -1921,11 +1921,11 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             } else {
                 if (tag->getState() == S || !protocol_ || mshr_->getSize(addr) > 1) {
                     tag->addSharer(req->getSrc());
-                    uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetSResp);
+                    uint64_t sendTime = sendResponseUp(req, &(event->getSharedPayload()), true, tag->getTimestamp(), Command::GetSResp);
                     tag->setTimestamp(sendTime - 1);
                 } else {
                     tag->setOwner(req->getSrc());
-                    uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetXResp);
+                    uint64_t sendTime = sendResponseUp(req, &(event->getSharedPayload()), true, tag->getTimestamp(), Command::GetXResp);
                     tag->setTimestamp(sendTime - 1);
                 }
             }
@@ -1943,7 +1943,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
                 tag->removeSharer(req->getSrc());
                 sendTime = sendResponseUp(req, nullptr, true, tag->getTimestamp(), Command::GetXResp);
             } else if (event->getPayloadSize() != 0) {
-                sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetXResp);
+                sendTime = sendResponseUp(req, &(event->getSharedPayload()), true, tag->getTimestamp(), Command::GetXResp);
             } else {
                 sendTime = sendResponseUp(req, &(mshr_->getData(addr)), true, tag->getTimestamp(), Command::GetXResp);
             }
@@ -1959,7 +1959,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             tag->setState(M_Inv);
             mshr_->setInProgress(addr, false);
             if (!data && event->getPayloadSize() != 0)
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getSharedPayload());
             if (is_debug_event(event)) {
                 eventDI.action = "Stall";
                 eventDI.reason = "Acks needed";
@@ -2046,12 +2046,12 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
         responses.erase(addr);
 
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getSharedPayload(), 0);
     else
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getSharedPayload());
     
     if (is_debug_addr(addr))
-        printDataValue(addr, &(event->getPayload()), true);
+        printDataValue(addr, &(event->getSharedPayload()), true);
 
     stat_eventState[(int)Command::FetchResp][state]->addData(1);
 
@@ -2150,12 +2150,12 @@ bool MESISharNoninclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
 
     // Save data
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getSharedPayload(), 0);
     else
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getSharedPayload());
     
     if (is_debug_addr(addr))
-        printDataValue(addr, &(event->getPayload()), true);
+        printDataValue(addr, &(event->getSharedPayload()), true);
 
     // Clean up and retry
     retry(addr);
@@ -2687,7 +2687,7 @@ void MESISharNoninclusive::cleanUpEvent(MemEvent* event, bool inMSHR) {
 
     /* Remove from MSHR */
     if (inMSHR) {
-        if (event->isPrefetch() && event->getRqstr() == cachename_) outstandingPrefetches_--;
+        if (event->isPrefetch() && event->getRqstrID() == cachenameID_) outstandingPrefetches_--;
         mshr_->removeFront(addr);
     }
 
@@ -2734,7 +2734,7 @@ void MESISharNoninclusive::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
     delete event;
 
     if (req) {
-        if (req->isPrefetch() && req->getRqstr() == cachename_) outstandingPrefetches_--;
+        if (req->isPrefetch() && req->getRqstrID() == cachenameID_) outstandingPrefetches_--;
         delete req;
     }
 
@@ -2789,7 +2789,7 @@ void MESISharNoninclusive::retry(Addr addr) {
  * Protocol helper functions
  ***********************************************************************************************************/
 
-uint64_t MESISharNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t> * data, bool inMSHR, uint64_t time, Command cmd, bool success) {
+uint64_t MESISharNoninclusive::sendResponseUp(MemEvent * event, const Payload* data, bool inMSHR, uint64_t time, Command cmd, bool success) {
     MemEvent * responseEvent = event->makeResponse();
     if (cmd != Command::NULLCMD)
         responseEvent->setCmd(cmd);
@@ -2817,7 +2817,7 @@ uint64_t MESISharNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t>
     return deliveryTime;
 }
 
-void MESISharNoninclusive::sendResponseDown(MemEvent * event, std::vector<uint8_t> * data, bool dirty, bool evict) {
+void MESISharNoninclusive::sendResponseDown(MemEvent * event, const Payload* data, bool dirty, bool evict) {
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
@@ -2837,7 +2837,7 @@ void MESISharNoninclusive::sendResponseDown(MemEvent * event, std::vector<uint8_
 }
 
 
-uint64_t MESISharNoninclusive::forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time) {
+uint64_t MESISharNoninclusive::forwardFlush(MemEvent * event, bool evict, const Payload* data, bool dirty, uint64_t time) {
     MemEvent * flush = new MemEvent(*event);
 
     uint64_t latency = tagLatency_;
@@ -2891,7 +2891,7 @@ void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* ta
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > tag->getTimestamp()) ? timestamp_ : tag->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -2918,7 +2918,7 @@ void MESISharNoninclusive::sendWritebackFromMSHR(Command cmd, DirectoryLine* tag
         latency = accessLatency_;
     }
 
-    writeback->setRqstr(cachename_);
+    writeback->setRqstrID(cachenameID_);
 
     uint64_t baseTime = (timestamp_ > tag->getTimestamp()) ? timestamp_ : tag->getTimestamp();
     uint64_t deliveryTime = baseTime + latency;
@@ -3031,7 +3031,7 @@ uint64_t MESISharNoninclusive::invalidateSharer(std::string shr, MemEvent * even
         if (event) {
             inv->copyMetadata(event);
         } else {
-            inv->setRqstr(cachename_);
+            inv->setRqstrID(cachenameID_);
         }
         inv->setDst(shr);
         inv->setSize(lineSize_);
@@ -3074,7 +3074,7 @@ bool MESISharNoninclusive::invalidateOwner(MemEvent * metaEvent, DirectoryLine *
     if (metaEvent) {
         inv->copyMetadata(metaEvent);
     } else {
-        inv->setRqstr(cachename_);
+        inv->setRqstrID(cachenameID_);
     }
     inv->setDst(tag->getOwner());
     inv->setSize(lineSize_);
@@ -3143,7 +3143,7 @@ void MESISharNoninclusive::removeSharerViaInv(MemEvent * event, DirectoryLine *
     Addr addr = event->getBaseAddr();
     tag->removeSharer(event->getSrc());
     if (!data && !mshr_->hasData(addr))
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getSharedPayload());
 
     if (remove) {
         responses.find(addr)->second.erase(event->getSrc());
@@ -3156,12 +3156,12 @@ void MESISharNoninclusive::removeOwnerViaInv(MemEvent * event, DirectoryLine * t
     Addr addr = event->getBaseAddr();
     tag->removeOwner();
     if (data) 
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getSharedPayload(), 0);
     else
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getSharedPayload());
     
     if (is_debug_addr(addr))
-        printDataValue(addr, &(event->getPayload()), true);
+        printDataValue(addr, &(event->getSharedPayload()), true);
 
     if (event->getDirty()) {
         if (tag->getState() == E)
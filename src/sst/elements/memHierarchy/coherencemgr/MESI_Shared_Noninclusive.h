@@ -594,13 +594,13 @@ private:
     bool invalidateOwner(MemEvent * event, DirectoryLine * line, bool inMSHR, Command cmd = Command::FetchInv);
 
     /** Forward a flush line request, with or without data */
-    uint64_t forwardFlush(MemEvent* event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time);
+    uint64_t forwardFlush(MemEvent* event, bool evict, const Payload* data, bool dirty, uint64_t time);
 
     /** Send response up (to processor) */
-    uint64_t sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t baseTime, Command cmd = Command::NULLCMD, bool success = true);
+    uint64_t sendResponseUp(MemEvent * event, const Payload* data, bool inMSHR, uint64_t baseTime, Command cmd = Command::NULLCMD, bool success = true);
 
     /** Send response down (towards memory) */
-    void sendResponseDown(MemEvent* event, std::vector<uint8_t>* data, bool dirty, bool evict);
+    void sendResponseDown(MemEvent* event, const Payload* data, bool dirty, bool evict);
 
     /** Send writeback request to lower level caches */
     void sendWritebackFromCache(Command cmd, DirectoryLine* tag, DataLine* data, bool dirty);
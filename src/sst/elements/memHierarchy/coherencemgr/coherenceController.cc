@@ -85,6 +85,7 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
 
     // Get parent component's name
     cachename_ = getParentComponentName();
+    cachenameID_ = EndpointRegistry::intern(cachename_);
 
     // Register statistics - only those that are common across all coherence managers
     // Give  all array entries a default statistic so we don't end up with segfaults during execution
@@ -323,6 +324,45 @@ bool CoherenceController::handleNACK(MemEvent* event, bool inMSHR) {
 }
 
 
+/*******************************************************************************
+ * Functional warmup
+ *******************************************************************************/
+
+State CoherenceController::warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data) {
+    debug->fatal(CALL_INFO, -1, "%s, Error: Functional warmup is not supported by this coherence manager. Addr: 0x%" PRIx64 ", Cmd: %s, Src: %s.\n",
+            getName().c_str(), addr, CommandString[(int)cmd], src.c_str());
+    return I;
+}
+
+void CoherenceController::warmWriteback(Addr addr, Command cmd, const std::string &src) {
+    debug->fatal(CALL_INFO, -1, "%s, Error: Functional warmup is not supported by this coherence manager. Addr: 0x%" PRIx64 ", Cmd: %s, Src: %s.\n",
+            getName().c_str(), addr, CommandString[(int)cmd], src.c_str());
+}
+
+bool CoherenceController::warmInvalidate(Addr addr, Command cmd) {
+    debug->fatal(CALL_INFO, -1, "%s, Error: Functional warmup is not supported by this coherence manager. Addr: 0x%" PRIx64 ", Cmd: %s.\n",
+            getName().c_str(), addr, CommandString[(int)cmd]);
+    return false;
+}
+
+WarmupTarget* CoherenceController::getWarmupTargetDown(Addr addr) {
+    const std::string &dst = EndpointRegistry::name(linkDown_->findTargetDestination(addr));
+    WarmupTarget* target = WarmupRegistry::findTarget(dst);
+    if (!target)
+        debug->fatal(CALL_INFO, -1, "%s, Error: Functional warmup cannot reach '%s' for address 0x%" PRIx64 ". Warmup is supported through caches, directories, and memory controllers.\n",
+                getName().c_str(), dst.c_str(), addr);
+    return target;
+}
+
+WarmupTarget* CoherenceController::getWarmupTargetUp(const std::string &name) {
+    WarmupTarget* target = WarmupRegistry::findTarget(name);
+    if (!target)
+        debug->fatal(CALL_INFO, -1, "%s, Error: Functional warmup cannot reach '%s'. Warmup is supported through caches, directories, and memory controllers.\n",
+                getName().c_str(), name.c_str());
+    return target;
+}
+
+
 /*******************************************************************************
  * Send events
  *******************************************************************************/
@@ -401,16 +441,16 @@ void CoherenceController::forwardByAddress(MemEventBase * event) {
 }
 
 void CoherenceController::forwardByAddress(MemEventBase * event, Cycle_t ts) {
-    event->setSrc(cachename_);
-    std::string dst = linkDown_->findTargetDestination(event->getRoutingAddress());
-    if (dst != "") { /* Common case */
-        event->setDst(dst);
+    event->setSrcID(cachenameID_);
+    uint32_t dst = linkDown_->findTargetDestination(event->getRoutingAddress());
+    if (dst != EndpointRegistry::NO_ENDPOINT) { /* Common case */
+        event->setDstID(dst);
         Response fwdReq = {event, ts, packetHeaderBytes + event->getPayloadSize()};
         addToOutgoingQueue(fwdReq);
     } else {
         dst = linkUp_->findTargetDestination(event->getRoutingAddress());
-        if (dst != "") {
-            event->setDst(dst);
+        if (dst != EndpointRegistry::NO_ENDPOINT) {
+            event->setDstID(dst);
             Response fwdReq = {event, ts, packetHeaderBytes + event->getPayloadSize()};
             addToOutgoingQueueUp(fwdReq);
         } else {
@@ -430,12 +470,12 @@ void CoherenceController::forwardByDestination(MemEventBase * event) {
 
 /* Forward an event to a specific destination */
 void CoherenceController::forwardByDestination(MemEventBase * event, Cycle_t ts) {
-    event->setSrc(cachename_);
+    event->setSrcID(cachenameID_);
     Response fwdReq = {event, ts, packetHeaderBytes + event->getPayloadSize()};
     
-    if (linkUp_->isReachable(event->getDst())) {
+    if (linkUp_->isReachable(event->getDstID())) {
         addToOutgoingQueueUp(fwdReq);
-    } else if (linkDown_->isReachable(event->getDst())) {
+    } else if (linkDown_->isReachable(event->getDstID())) {
         addToOutgoingQueue(fwdReq);
     } else {
         output->fatal(CALL_INFO, -1, "%s, Error: Destination %s appears unreachable on both links. Event: %s\n",
@@ -515,7 +555,7 @@ void CoherenceController::notifyListenerOfEvict(Addr addr, uint32_t size, Addr i
 
 
 /* Forward a message to a lower level (towards memory) in the hierarchy */
-uint64_t CoherenceController::forwardMessage(MemEvent * event, unsigned int requestSize, uint64_t baseTime, vector<uint8_t>* data, Command fwdCmd) {
+uint64_t CoherenceController::forwardMessage(MemEvent * event, unsigned int requestSize, uint64_t baseTime, const Payload* data, Command fwdCmd) {
     /* Create event to be forwarded */
     MemEvent* forwardEvent;
     forwardEvent = new MemEvent(*event);
@@ -577,19 +617,19 @@ void CoherenceController::resendEvent(MemEvent * event, bool towardsCPU) {
 
 
 /* Send response up (towards CPU). L1s need to implement their own to split out the requested block */
-uint64_t CoherenceController::sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool replay, uint64_t baseTime, bool success) {
+uint64_t CoherenceController::sendResponseUp(MemEvent * event, const Payload* data, bool replay, uint64_t baseTime, bool success) {
     return sendResponseUp(event, CommandResponse[(int)event->getCmd()], data, false, replay, baseTime, success);
 }
 
 
 /* Send response up (towards CPU). L1s need to implement their own to split out the requested block */
-uint64_t CoherenceController::sendResponseUp(MemEvent * event, Command cmd, vector<uint8_t>* data, bool replay, uint64_t baseTime, bool success) {
+uint64_t CoherenceController::sendResponseUp(MemEvent * event, Command cmd, const Payload* data, bool replay, uint64_t baseTime, bool success) {
     return sendResponseUp(event, cmd, data, false, replay, baseTime, success);
 }
 
 
 /* Send response towards the CPU. L1s need to implement their own to split out the requested block */
-uint64_t CoherenceController::sendResponseUp(MemEvent * event, Command cmd, vector<uint8_t>* data, bool dirty, bool replay, uint64_t baseTime, bool success) {
+uint64_t CoherenceController::sendResponseUp(MemEvent * event, Command cmd, const Payload* data, bool dirty, bool replay, uint64_t baseTime, bool success) {
     MemEvent * responseEvent = event->makeResponse(cmd);
     responseEvent->setSize(event->getSize());
     if (data != nullptr) responseEvent->setPayload(*data);
@@ -615,7 +655,7 @@ MemEventStatus CoherenceController::allocateMSHR(MemEvent * event, bool fwdReq,
     // Screen prefetches first to ensure limits are not exceeeded:
     //      - Maximum number of outstanding prefetches
     //      - MSHR too full to accept prefetches
-    if (event->isPrefetch() && event->getRqstr() == cachename_) {
+    if (event->isPrefetch() && event->getRqstrID() == cachenameID_) {
         if (dropPrefetchLevel_ <= mshr_->getSize()) {
             eventDI.action = "Reject";
             eventDI.reason = "Prefetch drop level";
@@ -640,13 +680,13 @@ MemEventStatus CoherenceController::allocateMSHR(MemEvent * event, bool fwdReq,
             eventDI.action = "Stall";
             eventDI.reason = "MSHR conflict";
         }
-        if (event->isPrefetch() && event->getRqstr() == cachename_) {
+        if (event->isPrefetch() && event->getRqstrID() == cachenameID_) {
             outstandingPrefetches_++;
         }
         return MemEventStatus::Stall;
     }
 
-    if (event->isPrefetch() && event->getRqstr() == cachename_) {
+    if (event->isPrefetch() && event->getRqstrID() == cachenameID_) {
         outstandingPrefetches_++;
     }
     return MemEventStatus::OK;
@@ -708,7 +748,7 @@ void CoherenceController::printDebugAlloc(bool alloc, Addr addr, std::string not
         debug->debug(_L5_, "\n");
 }
 
-void CoherenceController::printDataValue(Addr addr, vector<uint8_t> * data, bool set) {
+void CoherenceController::printDataValue(Addr addr, const vector<uint8_t>* data, bool set) {
     if (dlevel < 11)
         return;
 
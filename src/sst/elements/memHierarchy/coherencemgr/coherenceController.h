@@ -32,6 +32,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/hash.h"
+#include "sst/elements/memHierarchy/warmup.h"
 
 namespace SST { namespace MemHierarchy {
 using namespace std;
@@ -40,7 +41,7 @@ namespace LatType {
     enum { HIT, MISS, INV, UPGRADE };
 };
 
-class CoherenceController : public SST::SubComponent {
+class CoherenceController : public SST::SubComponent, public WarmupTarget {
 
 public:
     /* Args: Params& extraParams, bool prefetch */
@@ -80,6 +81,11 @@ public:
     virtual bool handleFetchXResp(MemEvent * event, bool inMSHR);
     virtual bool handleNACK(MemEvent * event, bool inMSHR);
 
+    /* Functional warmup (see warmup.h). Default is unsupported */
+    virtual State warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data);
+    virtual void warmWriteback(Addr addr, Command cmd, const std::string &src);
+    virtual bool warmInvalidate(Addr addr, Command cmd);
+
 
     /*********************************************************************************
      * Send outgoing events
@@ -195,11 +201,15 @@ protected:
     virtual void notifyListenerOfEvict(Addr addr, uint32_t size, uint64_t ip);
 
     /* Forward a message to a lower memory level (towards memory) */
-    uint64_t forwardMessage(MemEvent * event, unsigned int requestSize, uint64_t baseTime, vector<uint8_t>* data, Command fwdCmd = Command::LAST_CMD);
+    uint64_t forwardMessage(MemEvent * event, unsigned int requestSize, uint64_t baseTime, const Payload* data, Command fwdCmd = Command::LAST_CMD);
 
     /* Insert event into MSHR */
     MemEventStatus allocateMSHR(MemEvent * event, bool fwdReq, int pos = -1, bool stallEvict = false);
 
+    /* Functional warmup: locate the next level down (by address) or up (by name) */
+    WarmupTarget* getWarmupTargetDown(Addr addr);
+    WarmupTarget* getWarmupTargetUp(const std::string &name);
+
     /* Statistics */
     virtual void recordLatencyType(SST::Event::id_type id, int latencytype);
     virtual void recordPrefetchLatency(SST::Event::id_type, int latencytype);
@@ -247,7 +257,8 @@ protected:
 
     virtual void printDebugInfo(dbgin * diStruct);
     virtual void printDebugAlloc(bool alloc, Addr addr, std::string note);
-    virtual void printDataValue(Addr addr, vector<uint8_t> * data, bool set);
+    virtual void printDataValue(Addr addr, const vector<uint8_t>* data, bool set);
+    void printDataValue(Addr addr, const Payload* data, bool set) { printDataValue(addr, &(data->data()), set); }
 
     /* Initialization */
     ReplacementPolicy * createReplacementPolicy(uint64_t lines, uint64_t assoc, Params& params, bool L1, int slotnum = 0);
@@ -268,6 +279,7 @@ protected:
 
     /* Cache name - used for identifying where events came from/are going to */
     std::string cachename_;
+    uint32_t cachenameID_;  // cachename_'s endpoint id, for compares against event src/dst/rqstr
 
     /* Output & debug */
     Output* output; // Output stream for warnings, notices, fatal, etc.
@@ -322,9 +334,9 @@ protected:
     /* Add a new event to the outgoing command queue towards the CPU */
     virtual void addToOutgoingQueueUp(Response& resp);
 
-    virtual uint64_t sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool replay, uint64_t baseTime, bool success = true);
-    virtual uint64_t sendResponseUp(MemEvent * event, Command cmd, vector<uint8_t>* data, bool replay, uint64_t baseTime, bool success = true);
-    virtual uint64_t sendResponseUp(MemEvent * event, Command cmd, vector<uint8_t>* data, bool dirty, bool replay, uint64_t baseTime, bool success = true);
+    virtual uint64_t sendResponseUp(MemEvent * event, const Payload* data, bool replay, uint64_t baseTime, bool success = true);
+    virtual uint64_t sendResponseUp(MemEvent * event, Command cmd, const Payload* data, bool replay, uint64_t baseTime, bool success = true);
+    virtual uint64_t sendResponseUp(MemEvent * event, Command cmd, const Payload* data, bool dirty, bool replay, uint64_t baseTime, bool success = true);
 
     std::string getSrc();
 
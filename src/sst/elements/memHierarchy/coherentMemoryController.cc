@@ -120,10 +120,10 @@ bool CoherentMemController::clock(Cycle_t cycle) {
     bool unclockLink = true;
     if (clockLink_)
         unclockLink = link_->clock();   /* OK to unclock link? */
-    bool unclockBack = memBackendConvertor_->clock(cycle); /* OK to unclock backend? */
+    bool unclockBack = clockBackends(cycle); /* OK to unclock backend? */
 
     if (unclockLink && unclockBack && msgQueue_.empty()) {
-        memBackendConvertor_->turnClockOff();
+        turnBackendClocksOff();
         clockOn_ = false;
         return true;
     }
@@ -138,7 +138,7 @@ bool CoherentMemController::clock(Cycle_t cycle) {
 void CoherentMemController::handleEvent(SST::Event* event) {
     if (!clockOn_) {
         Cycle_t cycle = turnClockOn();
-        memBackendConvertor_->turnClockOn(cycle);
+        turnBackendClocksOn(cycle);
     }
 
     MemEventBase * ev = static_cast<MemEventBase*>(event);
@@ -206,7 +206,7 @@ void CoherentMemController::handleRequest(MemEvent * ev) {
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                     ev->getVerboseString().c_str());
         }
-        memBackendConvertor_->handleMemEvent(ev);
+        issueMemEvent(ev);
     } else {
         mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), ev->getCmd()));
     }
@@ -254,7 +254,7 @@ void CoherentMemController::handleReplacement(MemEvent * ev) {
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                     ev->getVerboseString().c_str());
         }
-        memBackendConvertor_->handleMemEvent(ev);
+        issueMemEvent(ev);
     } else {
         /* Search for race with a shootdown where we might receive an Ack but not data */
         std::list<MSHREntry>* entryList = &(mshr_.find(ev->getBaseAddr())->second);
@@ -267,7 +267,7 @@ void CoherentMemController::handleReplacement(MemEvent * ev) {
                                 getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                                 ev->getVerboseString().c_str());
                     }
-                    memBackendConvertor_->handleMemEvent(ev);
+                    issueMemEvent(ev);
                 } else {
                     it = entryList->insert(it, MSHREntry(ev->getID(), ev->getCmd())); /* Process replacement before next shootdown */
                 }
@@ -339,7 +339,7 @@ void CoherentMemController::handleFlush(MemEvent * ev) {
                         getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                         put->getVerboseString().c_str());
             }
-            memBackendConvertor_->handleMemEvent(put);
+            issueMemEvent(put);
         } else {
             mshr_.find(put->getBaseAddr())->second.push_back(MSHREntry(put->getID(), put->getCmd()));
         }
@@ -357,7 +357,7 @@ void CoherentMemController::handleFlush(MemEvent * ev) {
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                     put->getVerboseString().c_str());
         }
-        memBackendConvertor_->handleMemEvent(ev);
+        issueMemEvent(ev);
     } else { // TODO resolve potential race with a not-yet-started shootdown sitting in the MSHR?
         mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), ev->getCmd()));
     }
@@ -388,7 +388,7 @@ void CoherentMemController::handleAckInv(MemEvent * ev) {
     if (entry->writebacks.empty()) {
         if (outEv->decrementCount() == 0) { /* All shootdowns for this event are done */
             Interfaces::StandardMem::CustomData * info = customCommandHandler_->ready(outEv->request);
-            memBackendConvertor_->handleCustomEvent(info, outEv->request->getID(), outEv->request->getRqstr());
+            issueCustomEvent(info, outEv->request->getID(), outEv->request->getRqstr());
         }
     }
 }
@@ -423,7 +423,7 @@ void CoherentMemController::handleFetchResp(MemEvent * ev) {
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                     write->getVerboseString().c_str());
         }
-        memBackendConvertor_->handleMemEvent(write);
+        issueMemEvent(write);
     }
 
     delete ev;
@@ -431,7 +431,7 @@ void CoherentMemController::handleFetchResp(MemEvent * ev) {
     entry->shootdown = false; // Complete
     if (entry->writebacks.empty() && outEv->decrementCount() == 0) {
         Interfaces::StandardMem::CustomData * info = customCommandHandler_->ready(outEv->request);
-        memBackendConvertor_->handleCustomEvent(info, outEv->request->getID(), outEv->request->getRqstr());
+        issueCustomEvent(info, outEv->request->getID(), outEv->request->getRqstr());
     }
 }
 
@@ -498,7 +498,7 @@ void CoherentMemController::handleCustomCmd(MemEventBase * evb) {
     /* If ready to issue, issue */
     if (outEv->getCount() == 0) {
         Interfaces::StandardMem::CustomData * info = customCommandHandler_->ready(evb);
-        memBackendConvertor_->handleCustomEvent(info, evb->getID(), evb->getRqstr());
+        issueCustomEvent(info, evb->getID(), evb->getRqstr());
     }
 }
 
@@ -512,7 +512,7 @@ bool CoherentMemController::doShootdown(Addr addr, MemEventBase * ev) {
         Addr globalAddr = translateToGlobal(addr);
         MemEvent * inv = new MemEvent(getName(), globalAddr, globalAddr, Command::FetchInv, lineSize_);
         inv->copyMetadata(ev);
-        inv->setDst(ev->getSrc());
+        inv->setDstID(ev->getSrcID());
 
         msgQueue_.insert(std::make_pair(timestamp_, inv)); /* Send on next clock. TODO timing needed? */
         return true;
@@ -568,7 +568,7 @@ void CoherentMemController::finishMemReq(SST::Event::id_type id, uint32_t flags)
             if (outstandingEventList_.find(entry->id)->second.decrementCount() == 0) {
                 MemEventBase* req = static_cast<MemEventBase*>(outstandingEventList_.find(entry->id)->second.request);
                 Interfaces::StandardMem::CustomData * info = customCommandHandler_->ready(req);
-                memBackendConvertor_->handleCustomEvent(info, req->getID(), req->getRqstr());
+                issueCustomEvent(info, req->getID(), req->getRqstr());
             }
         }
         return;
@@ -665,7 +665,7 @@ void CoherentMemController::updateMSHR(Addr baseAddr) {
                 entry->shootdown = false;
                 if (entry->writebacks.empty() && outEv->decrementCount() == 0) { /* Command ready to issue */
                     Interfaces::StandardMem::CustomData * info = customCommandHandler_->ready(outEv->request);
-                    memBackendConvertor_->handleCustomEvent(info, outEv->request->getID(), outEv->request->getRqstr());
+                    issueCustomEvent(info, outEv->request->getID(), outEv->request->getRqstr());
                 }
             }
         } else { /* MemEvent */
@@ -689,17 +689,17 @@ void CoherentMemController::replayMemEvent(MemEvent * ev) {
             if (!ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
                 cacheStatus_.at(ev->getBaseAddr()/lineSize_) = true;
             }
-            memBackendConvertor_->handleMemEvent(ev);
+            issueMemEvent(ev);
             break;
         case Command::PutM:
             cacheStatus_.at(ev->getBaseAddr()/lineSize_) = directory_;
-            memBackendConvertor_->handleMemEvent(ev);
+            issueMemEvent(ev);
             break;
         case Command::FlushLineInv:
             cacheStatus_.at(ev->getBaseAddr()/lineSize_) = false;
             ev->setCmd(Command::FlushLine);
         case Command::FlushLine:
-            memBackendConvertor_->handleMemEvent(ev);
+            issueMemEvent(ev);
             break;
         default:
             dbg.fatal(CALL_INFO, -1, "%s, Error: Attempt to replay unknown event: %s. Time = %" PRIu64 "ns.\n",
@@ -47,6 +47,8 @@ public:
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( MEMCONTROLLER_ELI_SUBCOMPONENTSLOTS )
 
+    SST_ELI_DOCUMENT_STATISTICS( MEMCONTROLLER_ELI_STATS )
+
 /* Begin class definition */
     typedef uint64_t ReqId;
 
@@ -44,6 +44,8 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
     dbg.init("", debugLevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
 
+    endpointID = EndpointRegistry::intern(getName());
+
     // Detect deprecated parameters and warn/fatal
     // Currently deprecated - network_num_vc
     bool found;
@@ -316,11 +318,14 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     /* Get latencies */
     accessLatency   = params.find<uint64_t>("access_latency_cycles", 0);
     mshrLatency     = params.find<uint64_t>("mshr_latency_cycles", 0);
+
+    WarmupRegistry::addTarget(getName(), this);
 }
 
 
 
 DirectoryController::~DirectoryController(){
+    WarmupRegistry::removeTarget(getName(), this);
     for(std::unordered_map<Addr, DirEntry*>::iterator i = directory.begin(); i != directory.end() ; ++i){
         delete i->second;
     }
@@ -552,11 +557,11 @@ bool DirectoryController::arbitrateAccess(Addr addr) {
 
 void DirectoryController::handleNoncacheableRequest(MemEventBase * ev) {
     if (!(ev->queryFlag(MemEventBase::F_NORESPONSE))) {
-        noncacheMemReqs[ev->getID()] = ev->getSrc();
+        noncacheMemReqs[ev->getID()] = ev->getSrcID();
     }
     stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
 
-    ev->setSrc(getName());
+    ev->setSrcID(endpointID);
     forwardByAddress(ev, timestamp + 1);
 }
 
@@ -566,8 +571,8 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
         dbg.fatal(CALL_INFO, -1, "%s, Error: Received a noncacheable response that does not match a pending request. Event: %s\n. Time: %" PRIu64 "ns\n",
                 getName().c_str(), ev->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
     }
-    ev->setDst(noncacheMemReqs[ev->getID()]);
-    ev->setSrc(getName());
+    ev->setDstID(noncacheMemReqs[ev->getID()]);
+    ev->setSrcID(endpointID);
 
     stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
 
@@ -1091,7 +1096,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
                 if (event->getEvict()) {
                     entry->removeOwner();
                     entry->addSharer(event->getSrc());
-                    mshr->setData(addr, event->getPayload(), event->getDirty());
+                    mshr->setData(addr, event->getSharedPayload(), event->getDirty());
                     event->setEvict(false);
                 } else if (entry->hasOwner()) {
                     issueFetch(event, entry, Command::FetchInvX);
@@ -1106,7 +1111,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (event->getEvict()) {
                 entry->removeOwner();
                 entry->addSharer(event->getSrc());
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getSharedPayload(), event->getDirty());
                 event->setEvict(false);
                 entry->setState(S_Inv);
             }
@@ -1115,7 +1120,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (event->getEvict()) {
                 entry->removeOwner();
                 entry->addSharer(event->getSrc());
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getSharedPayload(), event->getDirty());
                 entry->setState(S);
                 mshr->decrementAcksNeeded(addr);
                 responses.find(addr)->second.erase(event->getSrc());
@@ -1188,7 +1193,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
                     entry->removeOwner();
-                    mshr->setData(addr, event->getPayload(), event->getDirty());
+                    mshr->setData(addr, event->getSharedPayload(), event->getDirty());
                     event->setEvict(false);
                 }
 
@@ -1220,7 +1225,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case M_InvX:
             if (event->getEvict()) {
                 entry->removeOwner();
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getSharedPayload(), event->getDirty());
                 event->setEvict(false);
                 responses.find(addr)->second.erase(event->getSrc());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
@@ -1412,14 +1417,14 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
             update = true;
             break;
         case M_Inv:
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getSharedPayload(), event->getDirty());
             entry->setState(S_Inv);
             break;
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getSharedPayload(), event->getDirty());
             entry->setState(S);
             break;
         default:
@@ -1474,7 +1479,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getSharedPayload(), event->getDirty());
             entry->setState(I);
             break;
         default:
@@ -1530,7 +1535,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getSharedPayload(), event->getDirty());
             entry->setState(I);
             break;
         default:
@@ -1795,8 +1800,8 @@ bool DirectoryController::handleGetSResp(MemEvent * event, bool inMSHR) {
         entry->setState(S);
     }
 
-    sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
-    mshr->setData(addr, event->getPayload(), false); // Save data for a subsequent GetS
+    sendDataResponse(reqEv, entry, event->getSharedPayload(), Command::GetSResp);
+    mshr->setData(addr, event->getSharedPayload(), false); // Save data for a subsequent GetS
     cleanUpAfterResponse(event, inMSHR);
 
     if (is_debug_addr(addr)) {
@@ -1821,12 +1826,12 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
         case IS:
             if (incoherentSrc.find(reqEv->getSrc()) != incoherentSrc.end()) {
                 entry->setState(I);
-                sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
+                sendDataResponse(reqEv, entry, event->getSharedPayload(), Command::GetSResp);
                 break;
             } else if (protocol == CoherenceProtocol::MESI) {
                 entry->setState(M);
                 entry->setOwner(reqEv->getSrc());
-                sendDataResponse(reqEv, entry, event->getPayload(), Command::GetXResp);
+                sendDataResponse(reqEv, entry, event->getSharedPayload(), Command::GetXResp);
                 break;
             }
         case S_D:
@@ -1834,8 +1839,8 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
             if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
                 entry->addSharer(reqEv->getSrc());
             }
-            sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
-            mshr->setData(addr, event->getPayload(), false); // So subsequent GetS can get data
+            sendDataResponse(reqEv, entry, event->getSharedPayload(), Command::GetSResp);
+            mshr->setData(addr, event->getSharedPayload(), false); // So subsequent GetS can get data
             break;
         case IM:
             if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
@@ -1844,11 +1849,11 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
             } else {
                 entry->setState(I);
             }
-            sendDataResponse(reqEv, entry, event->getPayload(), Command::GetXResp);
+            sendDataResponse(reqEv, entry, event->getSharedPayload(), Command::GetXResp);
             break;
         case SM_Inv:
             entry->setState(S_Inv);
-            mshr->setData(addr, event->getPayload(), false); // Save data for when the invalidations finish
+            mshr->setData(addr, event->getSharedPayload(), false); // Save data for when the invalidations finish
             if (is_debug_addr(addr)) {
                 eventDI.newst = entry->getState();
                 eventDI.verboseline = entry->getString();
@@ -2022,7 +2027,7 @@ bool DirectoryController::handleFetchXResp(MemEvent* event, bool inMSHR) {
     responses.find(addr)->second.erase(event->getSrc());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
-    mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
+    mshr->setData(addr, event->getSharedPayload(), event->getDirty());       // Save data for retry
 
     entry->removeOwner();
     entry->addSharer(event->getSrc());
@@ -2057,7 +2062,7 @@ bool DirectoryController::handleFetchResp(MemEvent* event, bool inMSHR) {
     responses.find(addr)->second.erase(event->getSrc());
     if (responses.find(addr)->second.empty())
         responses.erase(addr);
-    mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
+    mshr->setData(addr, event->getSharedPayload(), event->getDirty());       // Save data for retry
 
     entry->setState(I);
 
@@ -2161,6 +2166,91 @@ bool DirectoryController::handleDirEntryResponse(MemEvent* event) {
 }
 
 
+/****************************
+ * Functional warmup
+ ****************************/
+
+/* Apply a GetS/GetX from 'src', mirroring handleGetS/handleGetX and their responses. Data comes from memory */
+State DirectoryController::warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data) {
+    getWarmupTarget(EndpointRegistry::name(memLink->findTargetDestination(addr)), addr)->warmRequest(addr, Command::GetS, getName(), data);
+
+    if (incoherentSrc.find(src) != incoherentSrc.end())
+        return S;
+
+    DirEntry * entry = getDirEntry(addr);
+    entry->setCached(true);
+    State state = entry->getState();
+    State granted;
+
+    if (cmd == Command::GetS) {
+        if (state == M) { // FetchInvX the owner, it becomes a sharer
+            std::string owner = entry->getOwner();
+            getWarmupTarget(owner, addr)->warmInvalidate(addr, Command::FetchInvX);
+            entry->removeOwner();
+            entry->addSharer(owner);
+            state = S;
+        }
+        if (state == I && protocol == CoherenceProtocol::MESI) {
+            entry->setOwner(src);
+            state = M;
+            granted = E;
+        } else {
+            entry->addSharer(src);
+            state = S;
+            granted = S;
+        }
+    } else {
+        std::set<std::string> sharers = *(entry->getSharers());
+        for (std::set<std::string>::iterator it = sharers.begin(); it != sharers.end(); it++) {
+            if (*it != src)
+                getWarmupTarget(*it, addr)->warmInvalidate(addr, Command::Inv);
+        }
+        entry->clearSharers();
+        if (entry->hasOwner() && entry->getOwner() != src)
+            getWarmupTarget(entry->getOwner(), addr)->warmInvalidate(addr, Command::FetchInv);
+        entry->setOwner(src);
+        state = M;
+        granted = M;
+    }
+
+    entry->setState(state);
+    warmUpdateCache(entry);
+    return granted;
+}
+
+/* Apply a PutS/PutE/PutM from 'src' */
+void DirectoryController::warmWriteback(Addr addr, Command cmd, const std::string &src) {
+    DirEntry * entry = getDirEntry(addr);
+    entry->setCached(true);
+
+    if (entry->getOwner() == src)
+        entry->removeOwner();
+    else
+        entry->removeSharer(src);
+
+    if (entry->hasOwner())
+        entry->setState(M);
+    else if (entry->hasSharers())
+        entry->setState(S);
+    else
+        entry->setState(I);
+    warmUpdateCache(entry);
+}
+
+/* Nothing below a directory invalidates it */
+bool DirectoryController::warmInvalidate(Addr addr, Command cmd) {
+    return false;
+}
+
+WarmupTarget* DirectoryController::getWarmupTarget(const std::string &name, Addr addr) {
+    WarmupTarget* target = WarmupRegistry::findTarget(name);
+    if (!target)
+        dbg.fatal(CALL_INFO, -1, "%s, Error: Functional warmup cannot reach '%s' for address 0x%" PRIx64 ". Warmup is supported through caches, directories, and memory controllers.\n",
+                getName().c_str(), name.c_str(), addr);
+    return target;
+}
+
+
 /****************************
  * Manage data structures
  ****************************/
@@ -2308,6 +2398,36 @@ void DirectoryController::updateCache(DirEntry * entry) { // TODO replace with a
     }
 }
 
+/* updateCache() for functional warmup: entries that fall out of the entry cache are left in memory without sending them there */
+void DirectoryController::warmUpdateCache(DirEntry * entry) {
+    if (0 == entryCacheMaxSize)
+        return;
+
+    if (entry->cacheIter != entryCache.end()) {
+        entryCache.erase(entry->cacheIter);
+        --entryCacheSize;
+        entry->cacheIter = entryCache.end();
+    }
+
+    if (entry->getState() == I) {
+        directory.erase(entry->getBaseAddr());
+        delete entry;
+        return;
+    }
+
+    entryCache.push_front(entry);
+    entry->cacheIter = entryCache.begin();
+    ++entryCacheSize;
+
+    while (entryCacheSize > entryCacheMaxSize) {
+        DirEntry * oldEntry = entryCache.back();
+        entryCache.pop_back();
+        --entryCacheSize;
+        oldEntry->cacheIter = entryCache.end();
+        oldEntry->setCached(false);
+    }
+}
+
 void DirectoryController::sendEntryToMemory(DirEntry *entry) {
     Addr entryAddr = 0;
     MemEvent * me = new MemEvent(getName(), entryAddr, entryAddr, Command::PutE, lineSize);
@@ -2315,7 +2435,7 @@ void DirectoryController::sendEntryToMemory(DirEntry *entry) {
     me->setFlag(MemEventBase::F_NORESPONSE);
 
     uint64_t deliveryTime = timestamp + accessLatency;
-    me->setDst(memLink->getTargetDestination(0));
+    me->setDstID(memLink->getTargetDestination(0));
     memMsgQueue.insert(std::make_pair(deliveryTime, MemMsg(me, true)));
 }
 
@@ -2325,7 +2445,7 @@ void DirectoryController::sendEntryToMemory(DirEntry *entry) {
 
 void DirectoryController::issueMemoryRequest(MemEvent* event, DirEntry* entry, bool lineGranularity) {
     MemEvent* reqEvent = new MemEvent(*event);
-    reqEvent->setSrc(getName());
+    reqEvent->setSrcID(endpointID);
     if (lineGranularity)
         reqEvent->setSize(lineSize);
     uint64_t deliveryTime = timestamp + accessLatency;
@@ -2338,7 +2458,7 @@ void DirectoryController::issueMemoryRequest(MemEvent* event, DirEntry* entry, b
 void DirectoryController::issueFlush(MemEvent* event) {
     Addr addr = event->getBaseAddr();
     MemEvent * flush = new MemEvent(*event);
-    flush->setSrc(getName());
+    flush->setSrcID(endpointID);
 
     if (mshr->hasData(addr) && mshr->getDataDirty(addr)) { // also writeback dirty data
         flush->setEvict(true);
@@ -2406,7 +2526,7 @@ void DirectoryController::issueInvalidation(std::string dst, MemEvent* event, Di
     forwardByDestination(inv, deliveryTime);
 }
 
-void DirectoryController::sendDataResponse(MemEvent* event, DirEntry* entry, std::vector<uint8_t>& data, Command cmd, uint32_t flags) {
+void DirectoryController::sendDataResponse(MemEvent* event, DirEntry* entry, const Payload& data, Command cmd, uint32_t flags) {
     MemEvent * respEv = event->makeResponse(cmd);
     respEv->setSize(lineSize);
     respEv->setPayload(data);
@@ -2425,7 +2545,7 @@ void DirectoryController::sendResponse(MemEvent* event, uint32_t flags, uint32_t
 void DirectoryController::writebackData(MemEvent* event) {
     MemEvent * wb = new MemEvent(getName(), event->getBaseAddr(), event->getBaseAddr(), Command::PutM, lineSize);
     wb->copyMetadata(event);
-    wb->setPayload(event->getPayload());
+    wb->setPayload(event->getSharedPayload());
     wb->setDirty(event->getDirty());
 
     if (waitWBAck)
@@ -2535,14 +2655,14 @@ void DirectoryController::sendOutgoingEvents() {
  * dirAccess has default value of false
  */
 void DirectoryController::forwardByAddress(MemEventBase * ev, Cycle_t ts, bool dirAccess) {
-    std::string dst = memLink->findTargetDestination(ev->getRoutingAddress());
-    if (dst != "") { /* Common case */
-        ev->setDst(dst);
+    uint32_t dst = memLink->findTargetDestination(ev->getRoutingAddress());
+    if (dst != EndpointRegistry::NO_ENDPOINT) { /* Common case */
+        ev->setDstID(dst);
         memMsgQueue.insert(std::make_pair(ts, MemMsg(ev, dirAccess)));
     } else {
         dst = cpuLink->findTargetDestination(ev->getRoutingAddress());
-        if (dst != "") {
-            ev->setDst(dst);
+        if (dst != EndpointRegistry::NO_ENDPOINT) {
+            ev->setDstID(dst);
             cpuMsgQueue.insert(std::make_pair(ts, ev));
         } else {
             std::string availableDests = "cpulink:\n" + cpuLink->getAvailableDestinationsAsString();
@@ -2557,9 +2677,9 @@ void DirectoryController::forwardByAddress(MemEventBase * ev, Cycle_t ts, bool d
  * dirAccess has default value of false
  */
 void DirectoryController::forwardByDestination(MemEventBase* ev, Cycle_t ts, bool dirAccess) {
-    if (cpuLink->isReachable(ev->getDst())) {
+    if (cpuLink->isReachable(ev->getDstID())) {
         cpuMsgQueue.insert(std::make_pair(ts, ev));
-    } else if (memLink->isReachable(ev->getDst())) {
+    } else if (memLink->isReachable(ev->getDstID())) {
         memMsgQueue.insert(std::make_pair(ts, MemMsg(ev, dirAccess)));
     } else {
         out.fatal(CALL_INFO, -1, "%s, Error: Destination %s appears unreachable on both links. Event: %s\n",
@@ -37,12 +37,13 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/warmup.h"
 
 using namespace std;
 
 namespace SST { namespace MemHierarchy {
 
-class DirectoryController : public Component {
+class DirectoryController : public Component, public WarmupTarget {
 public:
 /* Element Library Info */
     SST_ELI_REGISTER_COMPONENT(DirectoryController, "memHierarchy", "DirectoryController", SST_ELI_ELEMENT_VERSION(1,0,0),
@@ -187,7 +188,8 @@ private:
     /* Queue of packets to work on */
     std::list<MemEvent*> eventBuffer;
     std::list<MemEvent*> retryBuffer;
-    std::map<MemEvent::id_type, std::string> noncacheMemReqs;
+    std::map<MemEvent::id_type, uint32_t> noncacheMemReqs;     // Request ID -> requestor's endpoint id
+    uint32_t endpointID;    // Endpoint id of this directory's name (see EndpointRegistry)
 
     std::set<Addr> addrsThisCycle;
 
@@ -259,6 +261,11 @@ public:
     
     bool handleDirEntryResponse(MemEvent* event);
 
+    /* Functional warmup */
+    State warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data);
+    void warmWriteback(Addr addr, Command cmd, const std::string &src);
+    bool warmInvalidate(Addr addr, Command cmd);
+
     void sendOutgoingEvents();
 
 private:
@@ -374,14 +381,16 @@ private:
     void cleanUpAfterResponse(MemEvent* event, bool inMSHR);
 
     void updateCache(DirEntry * entry);
+    void warmUpdateCache(DirEntry * entry);
     void sendEntryToMemory(DirEntry* entry);
+    WarmupTarget* getWarmupTarget(const std::string &name, Addr addr);
 
     void issueMemoryRequest(MemEvent* event, DirEntry* entry, bool lineGranularity);
     void issueFlush(MemEvent* event);
     void issueFetch(MemEvent* event, DirEntry* entry, Command cmd);
     void issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd);
     void issueInvalidation(std::string dst, MemEvent* event, DirEntry* entry, Command cmd);
-    void sendDataResponse(MemEvent* event, DirEntry* entry, std::vector<uint8_t>& data, Command cmd, uint32_t flags = 0);
+    void sendDataResponse(MemEvent* event, DirEntry* entry, const Payload& data, Command cmd, uint32_t flags = 0);
     void sendResponse(MemEvent* event, uint32_t flags = 0, uint32_t memflags = 0);
     void writebackData(MemEvent* event);
     void writebackDataFromMSHR(Addr addr);
@@ -0,0 +1,192 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_ENDPOINTREGISTRY_H
+#define MEMHIERARCHY_ENDPOINTREGISTRY_H
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include <sst/core/output.h>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Process-wide table of endpoint names so that events can carry a 32-bit
+ * id for their source, destination and requestor instead of a string.
+ *
+ * An id is a hash of the name, so every rank computes the same id for a
+ * name without exchanging tables and ids can be serialized as is. Names
+ * are added as components create events during construction and init,
+ * and as init events arrive from other ranks. Two names with the same
+ * hash are a fatal error.
+ *
+ * An id that arrives before its name (say, the requestor of an event
+ * from another rank) resolves to a placeholder name until the real name
+ * is learned. Interning a placeholder name gives back the id it stands
+ * for, so a name copied out of an event and back in keeps its id.
+ * Events should still be routed by id; names are for debug output.
+ *
+ * Lookups don't lock: a slot's name is published before its id, and
+ * slots are never removed.
+ */
+class EndpointRegistry {
+public:
+    /* Never assigned to a name, used for "no endpoint" */
+    static const uint32_t NO_ENDPOINT = 0;
+
+    static uint32_t intern(const std::string &name) {
+        uint32_t id = hash(name);
+        Table &table = getTable();
+        uint32_t slot = id & MASK;
+        while (true) {
+            uint32_t found = table.ids[slot].load(std::memory_order_acquire);
+            if (found == id) {
+                if (*(table.names[slot].load(std::memory_order_relaxed)) == name) return id;
+                break;
+            }
+            if (found == 0) break;
+            slot = (slot + 1) & MASK;
+        }
+        uint32_t placeholderID;
+        if (parsePlaceholder(name, placeholderID) && hadPlaceholder(table, placeholderID)) return placeholderID;
+        return insert(table, id, name, false);
+    }
+
+    /* Record the name of an id received from another rank. Placeholder
+     * names (which don't hash to the id) are ignored. */
+    static void learn(uint32_t id, const std::string &name) {
+        if (id != NO_ENDPOINT && hash(name) == id) insert(getTable(), id, name, false);
+    }
+
+    static const std::string& name(uint32_t id) {
+        Table &table = getTable();
+        uint32_t slot = id & MASK;
+        while (true) {
+            uint32_t found = table.ids[slot].load(std::memory_order_acquire);
+            if (found == id) return *(table.names[slot].load(std::memory_order_relaxed));
+            if (found == 0) break;
+            slot = (slot + 1) & MASK;
+        }
+        std::ostringstream placeholder;
+        placeholder << PLACEHOLDER_PREFIX << std::hex << id;
+        insert(table, id, placeholder.str(), true);
+        return name(id);
+    }
+
+    static size_t size() { return getTable().count; }
+
+private:
+    static const uint32_t CAPACITY = 1 << 16;
+    static const uint32_t MASK = CAPACITY - 1;
+    static constexpr const char* PLACEHOLDER_PREFIX = "endpoint-";
+
+    struct Table {
+        Table() : count(0) {
+            for (uint32_t i = 0; i < CAPACITY; i++) {
+                ids[i].store(0, std::memory_order_relaxed);
+                names[i].store(nullptr, std::memory_order_relaxed);
+                placeholder[i] = false;
+                hadPlaceholder[i] = false;
+            }
+        }
+        std::atomic<uint32_t> ids[CAPACITY];
+        std::atomic<const std::string*> names[CAPACITY];
+        bool placeholder[CAPACITY];     // Only accessed with lock held
+        bool hadPlaceholder[CAPACITY];  // Only accessed with lock held
+        size_t count;
+        std::mutex lock;
+    };
+
+    static Table& getTable() {
+        static Table table;
+        return table;
+    }
+
+    // FNV-1a, 0 marks an empty slot
+    static uint32_t hash(const std::string &name) {
+        uint32_t h = 2166136261u;
+        for (char c : name) {
+            h ^= (uint8_t)c;
+            h *= 16777619u;
+        }
+        return h == 0 ? 1 : h;
+    }
+
+    static bool parsePlaceholder(const std::string &name, uint32_t &id) {
+        size_t prefix = strlen(PLACEHOLDER_PREFIX);
+        if (name.size() <= prefix || name.size() > prefix + 8 || name.compare(0, prefix, PLACEHOLDER_PREFIX) != 0) return false;
+        char* end;
+        unsigned long val = strtoul(name.c_str() + prefix, &end, 16);
+        if (*end != '\0') return false;
+        id = (uint32_t)val;
+        return true;
+    }
+
+    /* Placeholder names stay valid after the real name is learned */
+    static bool hadPlaceholder(Table &table, uint32_t id) {
+        std::lock_guard<std::mutex> guard(table.lock);
+        uint32_t slot = id & MASK;
+        while (true) {
+            uint32_t found = table.ids[slot].load(std::memory_order_acquire);
+            if (found == 0) return false;
+            if (found == id) return table.hadPlaceholder[slot];
+            slot = (slot + 1) & MASK;
+        }
+    }
+
+    static uint32_t insert(Table &table, uint32_t id, const std::string &name, bool placeholder) {
+        std::lock_guard<std::mutex> guard(table.lock);
+        uint32_t slot = id & MASK;
+        while (true) {
+            uint32_t found = table.ids[slot].load(std::memory_order_acquire);
+            if (found == 0) break;
+            if (found == id) {
+                const std::string* known = table.names[slot].load(std::memory_order_relaxed);
+                if (*known == name || placeholder) return id;
+                if (table.placeholder[slot]) {
+                    // The old string is not freed, callers may hold references to it
+                    table.names[slot].store(new std::string(name), std::memory_order_release);
+                    table.placeholder[slot] = false;
+                    return id;
+                }
+                collision(name, *known);
+            }
+            slot = (slot + 1) & MASK;
+        }
+        if (table.count >= CAPACITY - CAPACITY / 4) {
+            Output::getDefaultObject().fatal(CALL_INFO, -1, "MemHierarchy EndpointRegistry: too many endpoint names (%zu)\n", table.count);
+        }
+        table.names[slot].store(new std::string(name), std::memory_order_relaxed);
+        table.placeholder[slot] = placeholder;
+        table.hadPlaceholder[slot] = placeholder;
+        table.ids[slot].store(id, std::memory_order_release);
+        table.count++;
+        return id;
+    }
+
+    static void collision(const std::string &name, const std::string &known) {
+        Output::getDefaultObject().fatal(CALL_INFO, -1, "MemHierarchy EndpointRegistry: endpoint names '%s' and '%s' hash to the same id. Rename one of the components.\n",
+                name.c_str(), known.c_str());
+    }
+};
+
+}}
+
+#endif
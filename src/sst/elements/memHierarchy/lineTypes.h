@@ -21,6 +21,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/payload.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 
@@ -134,12 +135,11 @@ class DataLine {
     private:
         const unsigned int index_;
         Addr addr_;
-        vector<uint8_t> data_;
+        Payload data_;
         DirectoryLine* tag_;
         CoherenceReplacementInfo* info_;
     public:
-        DataLine(uint8_t size, unsigned int index) : index_(index), addr_(0), tag_(nullptr) {
-            data_.resize(size);
+        DataLine(uint8_t size, unsigned int index) : index_(index), addr_(0), data_(size), tag_(nullptr) {
             info_ = new CoherenceReplacementInfo(index, I, false, false);
         }
         virtual ~DataLine() { }
@@ -163,10 +163,9 @@ class DataLine {
         DirectoryLine* getTag() { return tag_; }
 
         // Data
-        vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> data, uint32_t offset) {
-            std::copy(data.begin(), data.end(), data_.begin() + offset);
-        }
+        const Payload* getData() { return &data_; }
+        void setData(const Payload& data, uint32_t offset) { data_.write(data, offset); }
+        void setData(const vector<uint8_t>& data, uint32_t offset) { data_.write(data, offset); }
 
         // Replacement
         ReplacementInfo* getReplacementInfo() { return tag_ ? tag_->getReplacementInfo() : info_; }
@@ -183,7 +182,7 @@ class CacheLine {
         const unsigned int index_;
         Addr addr_;
         State state_;
-        vector<uint8_t> data_;
+        Payload data_;
 
         // Timing
         uint64_t lastSendTimestamp_;
@@ -193,9 +192,7 @@ class CacheLine {
 
         virtual void updateReplacement() = 0;
     public:
-        CacheLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), lastSendTimestamp_(0), wasPrefetch_(false) {
-            data_.resize(size);
-        }
+        CacheLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), data_(size), lastSendTimestamp_(0), wasPrefetch_(false) { }
         virtual ~CacheLine() { }
 
         void reset() {
@@ -216,10 +213,9 @@ class CacheLine {
         void setState(State state) { state_ = state; updateReplacement(); }
 
         // Data
-        vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> in, uint32_t offset) {
-            std::copy(in.begin(), in.end(), std::next(data_.begin(), offset));
-        }
+        const Payload* getData() { return &data_; }
+        void setData(const Payload& in, uint32_t offset) { data_.write(in, offset); }
+        void setData(const vector<uint8_t>& in, uint32_t offset) { data_.write(in, offset); }
 
         // Timestamp
         uint64_t getTimestamp() { return lastSendTimestamp_; }
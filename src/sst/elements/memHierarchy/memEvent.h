@@ -24,6 +24,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/payload.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -83,6 +84,12 @@ public:
         baseAddr_ = baseAddr;
         setPayload(data);
     }
+    MemEvent(std::string src, Addr addr, Addr baseAddr, Command cmd, const Payload& data) : MemEventBase(src, cmd) {
+        initialize();
+        addr_ = addr;
+        baseAddr_ = baseAddr;
+        setPayload(data);
+    }
 
 
 
@@ -194,18 +201,31 @@ public:
     void setSuccess(bool b) { b ? clearFlag(MemEventBase::F_FAIL) : setFlag(MemEventBase::F_FAIL); }
     bool success() { return !queryFlag(MemEventBase::F_FAIL); }
 
-    /** @return  the data payload. */
+    /** @return  the data payload. Copies the data first if it is shared with another event or a cache line. */
     dataVec& getPayload(void) {
         /* Lazily allocate space for payload */
         if ( payload_.size() < size_ )  payload_.resize(size_);
-        return payload_;
+        return payload_.mutableData();
     }
 
+    /** @return  the data payload without copying it. Use to read the data or to pass it on. */
+    const Payload& getSharedPayload(void) {
+        if ( payload_.size() < size_ )  payload_.resize(size_);
+        return payload_;
+    }
 
     /** Sets the data payload and payload size.
      * @param[in] data  Vector from which to copy data
      */
     void setPayload(std::vector<uint8_t>& data) {
+        setSize(data.size());
+        payload_.assign(data);
+    }
+
+    /** Sets the data payload and payload size.
+     * @param[in] data  Payload to share; data is copied only if one of the holders modifies it
+     */
+    void setPayload(const Payload& data) {
         setSize(data.size());
         payload_ = data;
     }
@@ -216,16 +236,15 @@ public:
      */
     void setPayload(uint32_t size, uint8_t* data) {
         setSize(size);
-        payload_.resize(size);
-        for ( uint32_t i = 0 ; i < size ; i++ ) {
-            payload_[i] = data[i];
-        }
+        if (size == 0)
+            payload_.clear();
+        else
+            payload_.assign(data, size);
     }
 
     void setZeroPayload(uint32_t size) {
         setSize(size);
-        payload_.clear();
-        payload_.resize(size, 0);
+        payload_ = Payload(size);
     }
 
     size_t getPayloadSize() override {
@@ -316,7 +335,7 @@ private:
     bool            addrGlobal_;        // Whether address is a local or global address
     MemEvent*       NACKedEvent_;       // For a NACK, pointer to the NACKed event
     int             retries_;           // For NACKed events, how many times a retry has been sent
-    dataVec         payload_;           // Data
+    Payload         payload_;           // Data, shared copy-on-write
     bool            prefetch_;          // Whether this request came from a prefetcher
     bool            dirty_;             // For a replacement, whether the data is dirty or not
     bool            isEvict_;           // Whether an event is an eviction
@@ -334,7 +353,7 @@ public:
         ser & addrGlobal_;
         ser & NACKedEvent_;
         ser & retries_;
-        ser & payload_;
+        payload_.serialize(ser);
         ser & prefetch_;
         ser & dirty_;
         ser & isEvict_;
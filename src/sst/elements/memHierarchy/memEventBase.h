@@ -22,6 +22,7 @@
 
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/endpointRegistry.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -48,15 +49,15 @@ public:
     MemEventBase(std::string src, Command cmd) : SST::Event() {
         setDefaults();
         cmd_ = cmd;
-        src_ = src;
+        src_ = EndpointRegistry::intern(src);
     }
 
     virtual void setDefaults() {
         eventID_        = generateUniqueId();  // Defined in SST::Event
         responseToID_   = NO_ID;
-        dst_            = NONE;
-        src_            = NONE;
-        rqstr_          = NONE;
+        dst_            = noneID();
+        src_            = noneID();
+        rqstr_          = noneID();
         cmd_            = Command::NULLCMD;
         flags_          = 0;
         memFlags_       = 0;
@@ -98,19 +99,29 @@ public:
     void setCmd(Command newcmd) { cmd_ = newcmd; }
 
     /** @return the source string - who sent this MemEvent */
-    const std::string& getSrc(void) const { return src_; }
+    const std::string& getSrc(void) const { return EndpointRegistry::name(src_); }
     /** Sets the source string - who sent this MemEvent */
-    void setSrc(const std::string& src) { src_ = src; }
+    void setSrc(const std::string& src) { src_ = EndpointRegistry::intern(src); }
 
     /** @return the destination string - who receives this MemEvent */
-    const std::string& getDst(void) const { return dst_; }
+    const std::string& getDst(void) const { return EndpointRegistry::name(dst_); }
     /** Sets the destination string - who received this MemEvent */
-    void setDst(const std::string& dst) { dst_ = dst; }
+    void setDst(const std::string& dst) { dst_ = EndpointRegistry::intern(dst); }
 
     /** @return the requestor string - whose original request caused this MemEvent */
-    const std::string& getRqstr(void) const { return rqstr_; }
+    const std::string& getRqstr(void) const { return EndpointRegistry::name(rqstr_); }
     /** Sets the requestor string - whose original request caused this MemEvent */
-    void setRqstr(const std::string& rqstr) { rqstr_ = rqstr; }
+    void setRqstr(const std::string& rqstr) { rqstr_ = EndpointRegistry::intern(rqstr); }
+
+    /** Endpoint ids (see EndpointRegistry) for routing without string compares.
+     *  Events are routed by id; the string forms above hash the name on every
+     *  set and are meant for setup and debug output */
+    uint32_t getSrcID(void) const { return src_; }
+    void setSrcID(uint32_t src) { src_ = src; }
+    uint32_t getDstID(void) const { return dst_; }
+    void setDstID(uint32_t dst) { dst_ = dst; }
+    uint32_t getRqstrID(void) const { return rqstr_; }
+    void setRqstrID(uint32_t rqstr) { rqstr_ = rqstr; }
 
     /** @return the thread ID that originated the original request */
     [[deprecated("Use getThreadID() instead (with capital 'D')")]]
@@ -182,7 +193,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream str;
         str << " Flags: " << getFlagString();
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Rq: " + rqstr_ + " Tid: " + std::to_string(tid_) + str.str();
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Rq: " + getRqstr() + " Tid: " + std::to_string(tid_) + str.str();
     }
 
     /** Get brief print of the event */
@@ -190,7 +201,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Tid: " + std::to_string(tid_);
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Tid: " + std::to_string(tid_);
     }
     
     /** Get brief print of the event */
@@ -198,7 +209,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Tid: " + std::to_string(tid_);
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Tid: " + std::to_string(tid_);
     }
 
     virtual bool doDebug(std::set<Addr> &UNUSED(addr)) {
@@ -220,9 +231,9 @@ public:
 protected:
     id_type         eventID_;           // Unique ID for this event
     id_type         responseToID_;      // For responses, holds the ID to which this event matches
-    string          src_;               // Source ID
-    string          dst_;               // Destination ID
-    string          rqstr_;             // Cache that originated this request
+    uint32_t        src_;               // Source ID
+    uint32_t        dst_;               // Destination ID
+    uint32_t        rqstr_;             // Cache that originated this request
     uint32_t        tid_;               // Thread ID that originated this request
     Command         cmd_;               // Command
     uint32_t        flags_;
@@ -230,6 +241,11 @@ protected:
 
     MemEventBase() {} // For serialization only
 
+    static uint32_t noneID() {
+        static const uint32_t id = EndpointRegistry::intern(NONE);
+        return id;
+    }
+
 public:
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         Event::serialize_order(ser);
@@ -318,6 +334,25 @@ public:
         ser & initCmd_;
         ser & addr_;
         ser & payload_;
+
+        // Init events carry names too so that a rank learns the names of
+        // endpoints on other ranks before it sees their ids in events.
+        // The ids serialized above stay authoritative, a name this rank
+        // only knows as a placeholder is not learned by the receiver.
+        std::string src, dst, rqstr;
+        if (ser.mode() != SST::Core::Serialization::serializer::UNPACK) {
+            src = getSrc();
+            dst = getDst();
+            rqstr = getRqstr();
+        }
+        ser & src;
+        ser & dst;
+        ser & rqstr;
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            EndpointRegistry::learn(src_, src);
+            EndpointRegistry::learn(dst_, dst);
+            EndpointRegistry::learn(rqstr_, rqstr);
+        }
     }
 
     ImplementSerializable(SST::MemHierarchy::MemEventInit);
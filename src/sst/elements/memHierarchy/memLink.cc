@@ -89,10 +89,10 @@ void MemLink::init(unsigned int phase) {
     
     // Attempt to drain send Q
     for (auto it = initSendQ.begin(); it != initSendQ.end(); ) {
-        std::string dst = findTargetDestination((*it)->getRoutingAddress());
-        if (dst != "") {
+        uint32_t dst = findTargetDestination((*it)->getRoutingAddress());
+        if (dst != EndpointRegistry::NO_ENDPOINT) {
             dbg.debug(_L10_, "%s sending init message: %s\n", getName().c_str(), (*it)->getVerboseString().c_str());
-            (*it)->setDst(dst);
+            (*it)->setDstID(dst);
             link->sendUntimedData(*it);
             it = initSendQ.erase(it);
         } else {
@@ -124,13 +124,13 @@ void MemLink::setup() {
  */
 void MemLink::sendInitData(MemEventInit * event, bool broadcast) {
     if (!broadcast) {
-        std::string dst = findTargetDestination(event->getRoutingAddress());
-        if (dst == "") {
+        uint32_t dst = findTargetDestination(event->getRoutingAddress());
+        if (dst == EndpointRegistry::NO_ENDPOINT) {
             /* Stall this until address is known */
             initSendQ.insert(event);
             return;
         }
-        event->setDst(dst);
+        event->setDstID(dst);
     }
     dbg.debug(_L10_, "%s sending init message: %s\n", getName().c_str(), event->getVerboseString().c_str());
     link->sendUntimedData(event);
@@ -150,7 +150,11 @@ MemEventInit * MemLink::recvInitData() {
 
 void MemLink::addRemote(EndpointInfo info) {
     remotes.insert(info);
-    remoteNames.insert(info.name);
+    remoteIDs.insert(EndpointRegistry::intern(info.name));
+    remoteRegions.clear();
+    for (std::set<EndpointInfo>::const_iterator it = remotes.begin(); it != remotes.end(); it++) {
+        remoteRegions.push_back(std::make_pair(it->region, EndpointRegistry::intern(it->name)));
+    }
 }
 
 void MemLink::addEndpoint(EndpointInfo info) {
@@ -193,9 +197,9 @@ MemEventBase * MemLink::recv() {
     return nullptr;
 }
 
-std::string MemLink::getTargetDestination(Addr addr) {
-    std::string dst = findTargetDestination(addr);
-    if ("" != dst) {
+uint32_t MemLink::getTargetDestination(Addr addr) {
+    uint32_t dst = findTargetDestination(addr);
+    if (dst != EndpointRegistry::NO_ENDPOINT) {
         return dst;
     }
     stringstream error;
@@ -205,18 +209,18 @@ std::string MemLink::getTargetDestination(Addr addr) {
         error << it->name << " " << it->region.toString() << endl;
     }
     dbg.fatal(CALL_INFO, -1, "%s", error.str().c_str());
-    return "";
+    return EndpointRegistry::NO_ENDPOINT;
 }
 
-std::string MemLink::findTargetDestination(Addr addr) {
-    for (std::set<EndpointInfo>::const_iterator it = remotes.begin(); it != remotes.end(); it++) {
-        if (it->region.contains(addr)) return it->name;
+uint32_t MemLink::findTargetDestination(Addr addr) {
+    for (std::vector<std::pair<MemRegion,uint32_t>>::const_iterator it = remoteRegions.begin(); it != remoteRegions.end(); it++) {
+        if (it->first.contains(addr)) return it->second;
     }
-    return "";
+    return EndpointRegistry::NO_ENDPOINT;
 }
 
-bool MemLink::isReachable(std::string dst) {
-   return remoteNames.find(dst) != remoteNames.end();
+bool MemLink::isReachable(uint32_t dst) {
+   return remoteIDs.find(dst) != remoteIDs.end();
 }
 
 std::string MemLink::getAvailableDestinationsAsString() {
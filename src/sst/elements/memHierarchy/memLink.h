@@ -101,9 +101,9 @@ public:
     virtual std::set<EndpointInfo>* getDests();
     virtual bool isDest(std::string UNUSED(str));
     virtual bool isSource(std::string UNUSED(str));
-    virtual std::string findTargetDestination(Addr addr);
-    virtual std::string getTargetDestination(Addr addr);
-    virtual bool isReachable(std::string dst);
+    virtual uint32_t findTargetDestination(Addr addr);
+    virtual uint32_t getTargetDestination(Addr addr);
+    virtual bool isReachable(uint32_t dst);
 
     /* Send and receive functions for MemLink */
     virtual void sendInitData(MemEventInit * ev, bool broadcast = true);
@@ -127,7 +127,8 @@ protected:
     // Data structures
     std::set<EndpointInfo> remotes;             // Tracks remotes immediately accessible on the other side of our link
     std::set<EndpointInfo> endpoints;           // Tracks endpoints in the system with info on how to get there
-    std::set<std::string> remoteNames;          // Tracks remote names for faster lookup than iteratinv via remotes
+    std::unordered_set<uint32_t> remoteIDs;     // Tracks remote endpoint ids for faster lookup than iterating via remotes
+    std::vector<std::pair<MemRegion,uint32_t>> remoteRegions;  // Remote regions and endpoint ids, in the same order as remotes
     
     // For events that require destination names during init
     std::set<MemEventInit*> initSendQ;
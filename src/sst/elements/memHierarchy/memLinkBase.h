@@ -171,9 +171,9 @@ public:
     // Link call back for incoming events
     void recvNotify(SST::Event * ev) { (*recvHandler)(ev); }
 
-    /* Functions for managing communication according to address */
-    virtual std::string findTargetDestination(Addr addr) =0;    /* Return destination and return "" if none found */
-    virtual std::string getTargetDestination(Addr addr) =0;     /* Return destination and error if none found */
+    /* Functions for managing communication according to address. Destinations are endpoint ids (see EndpointRegistry) */
+    virtual uint32_t findTargetDestination(Addr addr) =0;    /* Return destination and return EndpointRegistry::NO_ENDPOINT if none found */
+    virtual uint32_t getTargetDestination(Addr addr) =0;     /* Return destination and error if none found */
     
     /* Check if a request address maps to our region */
     virtual bool isRequestAddressValid(Addr addr) { return info.region.contains(addr); }
@@ -187,7 +187,7 @@ public:
 
     virtual bool isDest(std::string UNUSED(str)) =0;    /* Check whether a component is a destination on this link. May be slow (for init() only) */
     virtual bool isSource(std::string UNUSED(str)) =0;  /* Check whether a component is a soruce on this link. May be slow (for init() only) */
-    virtual bool isReachable(std::string dst) =0;       /* Check whether a component is reachable on this link. Should be fast - used during simulation */
+    virtual bool isReachable(uint32_t dst) =0;          /* Check whether an endpoint id is reachable on this link. Should be fast - used during simulation */
 
     MemRegion getRegion() { return info.region; }
     void setRegion(MemRegion region) { info.region = region; }
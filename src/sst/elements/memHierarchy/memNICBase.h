@@ -18,6 +18,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
 
 #include <sst/core/event.h>
@@ -28,6 +29,7 @@
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/routeTable.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -149,13 +151,13 @@ class MemNICBase : public MemLinkBase {
         [[deprecated("sendInitData() has been deprecated and will be removed in SST 14.  Please use sendUntimedData().")]]
         virtual void sendInitData(MemEventInit * ev, bool broadcast = true) {
             if (!broadcast) {
-                std::string dst = findTargetDestination(ev->getRoutingAddress());
-                if (dst == "") {
+                uint32_t dst = findTargetDestination(ev->getRoutingAddress());
+                if (dst == EndpointRegistry::NO_ENDPOINT) {
                     // Hold this request until we know the right address
                     initWaitForDst.insert(ev);
                     return;
                 }
-                ev->setDst(dst);
+                ev->setDstID(dst);
             }
             MemRtrEvent * mre = new MemRtrEvent(ev);
             SST::Interfaces::SimpleNetwork::Request* req = new SST::Interfaces::SimpleNetwork::Request();
@@ -202,16 +204,20 @@ class MemNICBase : public MemLinkBase {
         virtual std::set<EndpointInfo>* getSources() { return &sourceEndpointInfo; }
         virtual std::set<EndpointInfo>* getDests() { return &destEndpointInfo; }
         
-        virtual std::string findTargetDestination(Addr addr) {
+        virtual uint32_t findTargetDestination(Addr addr) {
+            if (routesCompiled) {
+                uint32_t dest = destRoutes.lookup(addr);
+                return dest == RouteTable::NO_ROUTE ? EndpointRegistry::NO_ENDPOINT : destEndpointIDs[dest];
+            }
             for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-                if (it->region.contains(addr)) return it->name;
+                if (it->region.contains(addr)) return EndpointRegistry::intern(it->name);
             }
-            return "";
+            return EndpointRegistry::NO_ENDPOINT;
         }
 
-        virtual std::string getTargetDestination(Addr addr) {
-            std::string dst = findTargetDestination(addr);
-            if (dst != "") {
+        virtual uint32_t getTargetDestination(Addr addr) {
+            uint32_t dst = findTargetDestination(addr);
+            if (dst != EndpointRegistry::NO_ENDPOINT) {
                 return dst;
             }
 
@@ -222,11 +228,11 @@ class MemNICBase : public MemLinkBase {
                 error << it->name << " " << it->region.toString() << endl;
             }
             dbg.fatal(CALL_INFO, -1, "%s", error.str().c_str());
-            return "";
+            return EndpointRegistry::NO_ENDPOINT;
         }
 
-        virtual bool isReachable(std::string dst) {
-            return reachableNames.find(dst) != reachableNames.end();
+        virtual bool isReachable(uint32_t dst) {
+            return reachableIDs.find(dst) != reachableIDs.end();
         }
         
         virtual std::string getAvailableDestinationsAsString() {
@@ -241,11 +247,32 @@ class MemNICBase : public MemLinkBase {
     protected:
         virtual void addSource(EndpointInfo info) { 
             sourceEndpointInfo.insert(info);
-            reachableNames.insert(info.name);
+            reachableIDs.insert(EndpointRegistry::intern(info.name));
         }
         virtual void addDest(EndpointInfo info) { 
             destEndpointInfo.insert(info); 
-            reachableNames.insert(info.name);
+            reachableIDs.insert(EndpointRegistry::intern(info.name));
+            if (routesCompiled) compileRoutes();
+        }
+
+        /* Build the address -> destination table used by findTargetDestination() once destinations are known */
+        void compileRoutes() {
+            destRoutes.clear();
+            destEndpointIDs.clear();
+            std::unordered_map<std::string,uint32_t> destIndex;
+            for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
+                auto index = destIndex.find(it->name);
+                if (index == destIndex.end()) {
+                    index = destIndex.insert(std::make_pair(it->name, (uint32_t)destEndpointIDs.size())).first;
+                    destEndpointIDs.push_back(EndpointRegistry::intern(it->name));
+                }
+                destRoutes.addRegion(it->region, index->second);
+            }
+            bool compiled = destRoutes.compile();
+            dbg.debug(_L10_, "%s (memNICBase) routing table for %zu destinations: %s, %zu intervals, %zu interleave tables\n",
+                    getName().c_str(), destEndpointIDs.size(), compiled ? "compiled" : "linear scan",
+                    destRoutes.getNumIntervals(), destRoutes.getNumPeriodTables());
+            routesCompiled = true;
         }
 
         virtual void addEndpoint(EndpointInfo info) { endpointInfo.insert(info); }
@@ -281,9 +308,9 @@ class MemNICBase : public MemLinkBase {
                 }
 
                 for (auto it = initWaitForDst.begin(); it != initWaitForDst.end();) {
-                    std::string dst = findTargetDestination((*it)->getRoutingAddress());
-                    if (dst != "") {
-                        (*it)->setDst(dst);
+                    uint32_t dst = findTargetDestination((*it)->getRoutingAddress());
+                    if (dst != EndpointRegistry::NO_ENDPOINT) {
+                        (*it)->setDstID(dst);
                         MemRtrEvent * mre = new MemRtrEvent(*it);
                         SST::Interfaces::SimpleNetwork::Request* req = new SST::Interfaces::SimpleNetwork::Request();
                         req->dest = SST::Interfaces::SimpleNetwork::INIT_BROADCAST_ADDR;
@@ -320,6 +347,7 @@ class MemNICBase : public MemLinkBase {
                 if (imre) {
                     // Record name->address map for all other endpoints
                     networkAddressMap.insert(std::make_pair(imre->info.name, imre->info.addr));
+                    networkAddressIDMap.insert(std::make_pair(EndpointRegistry::intern(imre->info.name), imre->info.addr));
                     processInitMemRtrEvent(imre);
                     delete imre;
                 } else {
@@ -359,7 +387,7 @@ class MemNICBase : public MemLinkBase {
                             mre->putEvent(ev); // If we did not delete the Event, give it back to the MemRtrEvent
                             initQueue.push(mre); // Our component will forward on all its other ports
                         }
-                    } else if ((ev->getCmd() == Command::NULLCMD && (isSource(ev->getSrc()) || isDest(ev->getSrc()))) || ev->getDst() == info.name) {
+                    } else if ((ev->getCmd() == Command::NULLCMD && (isSource(ev->getSrc()) || isDest(ev->getSrc()))) || ev->getDstID() == EndpointRegistry::intern(info.name)) {
                         dbg.debug(_L10_, "\tInserting in initQueue\n");
                         mre->putEvent(ev); // If we did not delete the Event, give it back to the MemRtrEvent
                         initQueue.push(mre);
@@ -444,6 +472,8 @@ class MemNICBase : public MemLinkBase {
                 dbg.fatal(CALL_INFO, -1, "%s, Error: Unable to find destination for init event %s\n",
                         getName().c_str(), (*initWaitForDst.begin())->getVerboseString(dlevel).c_str());
             }
+
+            compileRoutes();
         }
 
         // Lookup the network address for a given endpoint
@@ -455,6 +485,15 @@ class MemNICBase : public MemLinkBase {
             return it->second;
         }
 
+        // Lookup the network address for an endpoint id (see EndpointRegistry)
+        uint64_t lookupNetworkAddress(uint32_t dst) const {
+            std::unordered_map<uint32_t,uint64_t>::const_iterator it = networkAddressIDMap.find(dst);
+            if (it == networkAddressIDMap.end()) {
+                dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Network address for destination '%s' not found in networkAddressMap.\n", getName().c_str(), EndpointRegistry::name(dst).c_str());
+            }
+            return it->second;
+        }
+
         /*
          * Some helper functions to avoid needing to repeat code everywhere
          */
@@ -524,10 +563,16 @@ class MemNICBase : public MemLinkBase {
 
         // Data structures
         std::unordered_map<std::string,uint64_t> networkAddressMap; // Map of name -> address for each network endpoint
+        std::unordered_map<uint32_t,uint64_t> networkAddressIDMap;   // Same, keyed by endpoint id
         std::set<EndpointInfo> sourceEndpointInfo;
         std::set<EndpointInfo> destEndpointInfo;
         std::set<EndpointInfo> endpointInfo;
-        std::set<std::string> reachableNames;
+        std::unordered_set<uint32_t> reachableIDs;
+
+        // Compiled from destEndpointInfo at setup()
+        RouteTable destRoutes;
+        std::vector<uint32_t> destEndpointIDs;  // Destination index -> endpoint id
+        bool routesCompiled;
 
         // Init queues
         std::queue<MemRtrEvent*> initQueue; // Queue for received init events
@@ -587,6 +632,7 @@ class MemNICBase : public MemLinkBase {
                     destIDs.insert(info.id + 1);
             }
             initMsgSent = false;
+            routesCompiled = false;
 
             dbg.debug(_L10_, "%s memNICBase info is: Name: %s, group: %" PRIu32 "\n",
                     getName().c_str(), info.name.c_str(), info.id);
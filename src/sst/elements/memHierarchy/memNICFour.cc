@@ -141,7 +141,7 @@ void MemNICFour::send(MemEventBase *ev) {
     SimpleNetwork::Request * req = new SimpleNetwork::Request();
     req->vn = 0;
     req->src = info.addr;
-    req->dest = lookupNetworkAddress(ev->getDst());
+    req->dest = lookupNetworkAddress(ev->getDstID());
 
     unsigned int tag = sendTags[req->dest];
     sendTags[req->dest]++;
@@ -276,6 +276,7 @@ MemNICFour::OrderedMemRtrEvent* MemNICFour::processRecv(SimpleNetwork::Request *
             } 
             if (destIDs.find(imre->info.id) != destIDs.end()) {
                 destEndpointInfo.insert(imre->info);
+                if (routesCompiled) compileRoutes();
             }
             delete imre;
         }
@@ -19,6 +19,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/mman.h>
+#include <algorithm>
+#include <cstring>
 #include "sst/elements/memHierarchy/util.h"
 
 namespace SST {
@@ -31,7 +33,7 @@ public:
     virtual ~Backing() { }
 
     virtual void set( Addr addr, uint8_t value ) = 0;
-    virtual void set( Addr addr, size_t size, std::vector<uint8_t>& data) = 0;
+    virtual void set( Addr addr, size_t size, const std::vector<uint8_t>& data) = 0;
 
     virtual uint8_t get( Addr addr) = 0;
     virtual void get( Addr addr, size_t size, std::vector<uint8_t>& data) = 0;
@@ -68,9 +70,8 @@ public:
         m_buffer[addr - m_offset ] = value;
     }
 
-    void set (Addr addr, size_t size, std::vector<uint8_t> &data) {
-        for (size_t i = 0; i < size; i++)
-            m_buffer[addr + i] = data[i];
+    void set (Addr addr, size_t size, const std::vector<uint8_t> &data) {
+        memcpy(m_buffer + addr, data.data(), size);
     }
 
     uint8_t get( Addr addr ) {
@@ -78,8 +79,7 @@ public:
     }
 
     void get( Addr addr, size_t size, std::vector<uint8_t> &data) {
-        for (size_t i = 0; i < size; i++)
-            data[i] = m_buffer[addr + i];
+        memcpy(data.data(), m_buffer + addr, size);
     }
 
 private:
@@ -151,66 +151,43 @@ public:
         m_buffer[bAddr][offset] = value;
     }
 
-    void set( Addr addr, size_t size, std::vector<uint8_t> &data ) {
+    void set( Addr addr, size_t size, const std::vector<uint8_t> &data ) {
         /* Account for size exceeding alloc unit size */
         Addr bAddr = addr >> m_shift;
         Addr offset = addr - (bAddr << m_shift);
         size_t dataOffset = 0;
 
-        allocIfNeeded(bAddr);
-
 #if CHECKPOINT_DBG 
-        printf("%s() addr=%#lx size=%zu ",__func__,addr,size);
+        printf("%s() addr=%#lx size=%zu\n",__func__,addr,size);
 #endif
         while (dataOffset != size) {
-            m_buffer[bAddr][offset] = data[dataOffset];
-#if CHECKPOINT_DBG 
-            printf("%#x ",data[dataOffset]);
-#endif
-            offset++;
-            dataOffset++;
-
-            if (offset == m_allocUnit) {
-                offset = 0;
-                bAddr++;
-                allocIfNeeded(bAddr);
-            }
+            allocIfNeeded(bAddr);
+            size_t chunk = std::min(size - dataOffset, (size_t)(m_allocUnit - offset));
+            memcpy(m_buffer[bAddr] + offset, data.data() + dataOffset, chunk);
+            dataOffset += chunk;
+            offset = 0;
+            bAddr++;
         }
-#if CHECKPOINT_DBG 
-        printf("\n");
-#endif
     }
 
     void get (Addr addr, size_t size, std::vector<uint8_t> &data) {
 #if CHECKPOINT_DBG 
-        printf("%s() addr=%#lx size=%zu ",__func__,addr,size);
+        printf("%s() addr=%#lx size=%zu\n",__func__,addr,size);
 #endif
         Addr bAddr = addr >> m_shift;
         Addr offset = addr - (bAddr << m_shift);
         size_t dataOffset = 0;
 
-        allocIfNeeded(bAddr);
         assert( data.size() == size );
 
-        assert( m_buffer.find(bAddr) != m_buffer.end() ); 
-        auto buf = m_buffer[bAddr];
         while (dataOffset != size) {
-            
-            data[dataOffset] = buf[offset];
-            offset++;
-            dataOffset++;
-            if (offset == m_allocUnit) {
-                bAddr++;
-                offset = 0;
-                allocIfNeeded(bAddr);
-            }
+            allocIfNeeded(bAddr);
+            size_t chunk = std::min(size - dataOffset, (size_t)(m_allocUnit - offset));
+            memcpy(data.data() + dataOffset, m_buffer[bAddr] + offset, chunk);
+            dataOffset += chunk;
+            offset = 0;
+            bAddr++;
         }
-#if CHECKPOINT_DBG 
-        for ( auto i = 0; i < size; i++ ) {
-            printf("%x ",data[i]);
-        }
-        printf("\n");
-#endif
     }
 
     uint8_t get( Addr addr ) {
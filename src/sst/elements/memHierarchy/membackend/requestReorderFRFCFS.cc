@@ -0,0 +1,279 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include "sst/elements/memHierarchy/util.h"
+#include "membackend/requestReorderFRFCFS.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/*------------------------------- FR-FCFS Backend ------------------------------- */
+RequestReorderFRFCFS::RequestReorderFRFCFS(ComponentId_t id, Params &params) : SimpleMemBackend(id, params) {
+
+    fixupParams( params, "clock", "backend.clock" );
+
+    // Get parameters
+    reqsPerCycle = params.find<int>("max_issue_per_cycle", -1);
+    if (reqsPerCycle <= 0) reqsPerCycle = -1;
+
+    uint64_t bankCount = params.find<uint64_t>("banks", 8);
+    UnitAlgebra rowSize(params.find<std::string>("row_size", "8KiB"));
+    UnitAlgebra lineSize(params.find<std::string>("bank_interleave_granularity", "64B"));
+    bankQueueDepth = params.find<unsigned int>("bank_queue_depth", 16);
+    writeHighWatermark = params.find<unsigned int>("write_high_watermark", 32);
+    writeLowWatermark = params.find<unsigned int>("write_low_watermark", 16);
+    rowHitCap = params.find<unsigned int>("row_hit_cap", 4);
+
+    // Check parameters
+    if (bankCount == 0 || !isPowerOfTwo(bankCount)) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): banks - must be a power of two. You specified %" PRIu64 ".\n", getName().c_str(), bankCount);
+    }
+    if (!(rowSize.hasUnits("B"))) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must have units of 'B' (bytes). You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    if (!isPowerOfTwo(rowSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must be a power of two. You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    if (!(lineSize.hasUnits("B"))) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must have units of 'B' (bytes). You specified '%s'.\n", getName().c_str(), lineSize.toString().c_str());
+    }
+    if (!isPowerOfTwo(lineSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must be a power of two. You specified '%s'.\n", getName().c_str(), lineSize.toString().c_str());
+    }
+    if (bankQueueDepth == 0) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_queue_depth - must be at least 1. You specified '0'.\n", getName().c_str());
+    }
+    if (writeLowWatermark > writeHighWatermark) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): write_low_watermark - must not be larger than write_high_watermark. You specified %u and %u.\n",
+                getName().c_str(), writeLowWatermark, writeHighWatermark);
+    }
+
+    // Create our backend & copy 'mem_size' through for now
+    backend = loadUserSubComponent<SimpleMemBackend>("backend");
+    if (!backend) {
+        std::string backendName = params.find<std::string>("backend", "memHierarchy.simpleDRAM");
+        Params backendParams = params.get_scoped_params("backend");
+        backendParams.insert("mem_size", params.find<std::string>("mem_size"));
+        backend = loadAnonymousSubComponent<SimpleMemBackend>(backendName, "backend", 0, ComponentInfo::INSERT_STATS | ComponentInfo::SHARE_PORTS, backendParams);
+    }
+    using std::placeholders::_1;
+    backend->setResponseHandler( std::bind( &RequestReorderFRFCFS::handleMemResponse, this, _1 )  );
+    m_memSize = backend->getMemSize(); // inherit from backend
+
+    // Precompute the address mapping
+    bankMask = bankCount - 1;
+    lineOffset = log2Of(lineSize.getRoundedValue());
+    rowOffset = log2Of(rowSize.getRoundedValue());
+
+    // Each bank can hold at most bankQueueDepth requests so the pool never grows
+    banks.resize(bankCount);
+    pool.resize(bankCount * bankQueueDepth);
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i].ageNext = i + 1;
+    pool.back().ageNext = NONE;
+    freeList = 0;
+
+    nextBank = 0;
+    readCount = 0;
+    writeCount = 0;
+    draining = false;
+
+    statRowHit = registerStatistic<uint64_t>("row_hits_issued");
+    statRowMiss = registerStatistic<uint64_t>("row_misses_issued");
+    statRowHitCap = registerStatistic<uint64_t>("row_hit_cap_reached");
+    statWriteDrain = registerStatistic<uint64_t>("write_drains");
+    statBankQueueFull = registerStatistic<uint64_t>("bank_queue_full");
+}
+
+bool RequestReorderFRFCFS::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned numBytes ) {
+    Bank &bank = banks[(addr >> lineOffset) & bankMask];
+    if (bank.reads.count + bank.writes.count == bankQueueDepth) {
+        statBankQueueFull->addData(1);
+        return false;
+    }
+
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "Reorderer received request for 0x%" PRIx64 "\n", (Addr)addr);
+#endif
+
+    int32_t slot = freeList;
+    Req &req = pool[slot];
+    freeList = req.ageNext;
+
+    req.id = id;
+    req.addr = addr;
+    req.row = addr >> rowOffset;
+    req.numBytes = numBytes;
+    req.isWrite = isWrite;
+
+    if (isWrite) {
+        enqueue(bank.writes, slot);
+        writeCount++;
+    } else {
+        enqueue(bank.reads, slot);
+        readCount++;
+    }
+    return true;
+}
+
+/*
+ * Each cycle, consider each bank once starting after the last bank to issue,
+ * and issue at most one request per bank up to reqsPerCycle
+ */
+bool RequestReorderFRFCFS::clock(Cycle_t cycle) {
+    updateDrainMode();
+
+    int reqsIssuedThisCycle = 0;
+    unsigned int bankIndex = nextBank;
+    for (unsigned int i = 0; i < banks.size() && reqsIssuedThisCycle != reqsPerCycle; i++, bankIndex = (bankIndex + 1) & bankMask) {
+        Bank &bank = banks[bankIndex];
+
+        /* Writes only go out during a drain, unless the bank has nothing else to do then */
+        Queue* queue = draining ? &bank.writes : &bank.reads;
+        if (queue->count == 0)
+            queue = draining ? &bank.reads : nullptr;
+        if (queue == nullptr || queue->count == 0)
+            continue;
+
+        bool capped;
+        int32_t slot = select(bank, *queue, capped);
+        Req &req = pool[slot];
+        if (!backend->issueRequest(req.id, req.addr, req.isWrite, req.numBytes))
+            continue;   // Bank is busy
+
+        reqsIssuedThisCycle++;
+        nextBank = (bankIndex + 1) & bankMask;
+        if (capped)
+            statRowHitCap->addData(1);
+
+        if (bank.rowOpen && req.row == bank.openRow) {
+            statRowHit->addData(1);
+            bank.hitStreak = (slot == queue->age.head) ? 0 : bank.hitStreak + 1;
+        } else {
+            statRowMiss->addData(1);
+            bank.openRow = req.row;
+            bank.rowOpen = true;
+            bank.hitStreak = 0;
+        }
+
+        if (req.isWrite)
+            writeCount--;
+        else
+            readCount--;
+        dequeue(*queue, slot);
+        req.ageNext = freeList;
+        freeList = slot;
+    }
+
+    bool unclock = backend->clock(cycle);
+    return unclock && readCount == 0 && writeCount == 0;
+}
+
+/* Oldest request to the open row, unless it has passed over the oldest request too often */
+int32_t RequestReorderFRFCFS::select(Bank &bank, Queue &queue, bool &capped) {
+    int32_t oldest = queue.age.head;
+    capped = false;
+    if (!bank.rowOpen || rowHitCap == 0 || pool[oldest].row == bank.openRow)
+        return oldest;
+
+    std::unordered_map<Addr, List>::iterator it = queue.rows.find(bank.openRow);
+    if (it == queue.rows.end())
+        return oldest;
+
+    if (bank.hitStreak >= rowHitCap) {
+        capped = true;
+        return oldest;
+    }
+    return it->second.head;
+}
+
+void RequestReorderFRFCFS::updateDrainMode() {
+    if (!draining) {
+        if (writeCount >= writeHighWatermark && writeCount != 0) {
+            statWriteDrain->addData(1);
+            draining = true;
+        } else if (readCount == 0 && writeCount != 0) {
+            draining = true;
+        }
+    } else if (writeCount == 0 || (readCount != 0 && writeCount <= writeLowWatermark)) {
+        draining = false;
+    }
+}
+
+void RequestReorderFRFCFS::enqueue(Queue &queue, int32_t slot) {
+    Req &req = pool[slot];
+
+    req.agePrev = queue.age.tail;
+    req.ageNext = NONE;
+    if (queue.age.tail == NONE)
+        queue.age.head = slot;
+    else
+        pool[queue.age.tail].ageNext = slot;
+    queue.age.tail = slot;
+
+    List &row = queue.rows[req.row];
+    req.rowPrev = row.tail;
+    req.rowNext = NONE;
+    if (row.tail == NONE)
+        row.head = slot;
+    else
+        pool[row.tail].rowNext = slot;
+    row.tail = slot;
+
+    queue.count++;
+}
+
+void RequestReorderFRFCFS::dequeue(Queue &queue, int32_t slot) {
+    Req &req = pool[slot];
+
+    if (req.agePrev == NONE)
+        queue.age.head = req.ageNext;
+    else
+        pool[req.agePrev].ageNext = req.ageNext;
+    if (req.ageNext == NONE)
+        queue.age.tail = req.agePrev;
+    else
+        pool[req.ageNext].agePrev = req.agePrev;
+
+    if (req.rowPrev != NONE) {
+        pool[req.rowPrev].rowNext = req.rowNext;
+        if (req.rowNext == NONE)
+            queue.rows[req.row].tail = req.rowPrev;
+        else
+            pool[req.rowNext].rowPrev = req.rowPrev;
+    } else if (req.rowNext != NONE) {
+        queue.rows[req.row].head = req.rowNext;
+        pool[req.rowNext].rowPrev = NONE;
+    } else {
+        queue.rows.erase(req.row);
+    }
+
+    queue.count--;
+}
+
+
+/*
+ * Call throughs to our backend
+ */
+
+void RequestReorderFRFCFS::setup() {
+    backend->setup();
+}
+
+void RequestReorderFRFCFS::finish() {
+    backend->finish();
+}
@@ -0,0 +1,156 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_REQUEST_REORDER_FRFCFS_BACKEND
+#define _H_SST_MEMH_REQUEST_REORDER_FRFCFS_BACKEND
+
+#include "sst/elements/memHierarchy/membackend/memBackend.h"
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * FR-FCFS request scheduler. Chain in front of a SimpleMemBackend, typically simpleDRAM, and give it
+ * the same banks/bank_interleave_granularity/row_size as that backend.
+ *
+ * Addresses are mapped to banks and rows the same way simpleDRAM maps them:
+ * bank = (addr / bank_interleave_granularity) % banks and row = addr / row_size.
+ * This is not timingDRAM's address mapper, which also splits addresses across channels and ranks
+ * and can order the bank and row bits differently. In front of timingDRAM, the scheduler's idea of
+ * a bank or an open row is only an approximation.
+ *
+ * Each bank has a bounded queue; when it is full, new requests to the bank are rejected.
+ * Each cycle, each bank issues at most one request: the oldest request to the bank's open row
+ * if there is one, otherwise the oldest request. Once 'row_hit_cap' row hits in a row have bypassed
+ * an older request, the oldest request goes next. Reads are scheduled ahead of writes; writes are
+ * drained once 'write_high_watermark' are queued (or no reads are waiting) until no more than
+ * 'write_low_watermark' remain.
+ *
+ * Requests live in a fixed pool and are linked into per-bank age-ordered lists and per-row lists,
+ * so picking and removing a request is constant time.
+ */
+class RequestReorderFRFCFS : public SimpleMemBackend {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT(RequestReorderFRFCFS, "memHierarchy", "reorderFRFCFS", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Request re-orderer, FR-FCFS with read/write watermarks, a row-hit cap, and bounded per-bank queues", SST::MemHierarchy::SimpleMemBackend)
+
+    SST_ELI_DOCUMENT_PARAMS( MEMBACKEND_ELI_PARAMS,
+            /* Own parameters */
+            {"max_issue_per_cycle",         "(int) Maximum number of requests to issue per cycle. 0 or negative is unlimited.", "-1"},
+            {"banks",                       "(uint) Number of banks. Must be a power of 2. Banks and rows are mapped as in simpleDRAM.", "8"},
+            {"bank_interleave_granularity", "(string) Granularity of interleaving in bytes (B), generally a cache line. Must be a power of 2.", "64B"},
+            {"row_size",                    "(string) Size of a row in bytes (B). Must be a power of 2.", "8KiB"},
+            {"bank_queue_depth",            "(uint) Maximum number of requests queued per bank. Requests to a full bank are rejected.", "16"},
+            {"write_high_watermark",        "(uint) Start draining writes when this many writes are queued.", "32"},
+            {"write_low_watermark",         "(uint) Stop draining writes when no more than this many are queued and reads are waiting.", "16"},
+            {"row_hit_cap",                 "(uint) Maximum number of row hits in a row that may bypass an older request to the same bank. 0 schedules in arrival order.", "4"},
+            {"backend",                     "(string) Backend memory system.", "memHierarchy.simpleDRAM"} )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"row_hits_issued",         "Number of requests issued to their bank's open row", "count", 1},
+            {"row_misses_issued",       "Number of requests issued to a row other than their bank's open row", "count", 1},
+            {"row_hit_cap_reached",     "Number of times the oldest request was issued because the row hit cap was reached", "count", 1},
+            {"write_drains",            "Number of times the write high watermark started a write drain", "count", 1},
+            {"bank_queue_full",         "Number of requests rejected because their bank's queue was full", "count", 1} )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( {"backend", "Backend memory model.", "SST::MemHierarchy::SimpleMemBackend"} )
+
+/* Begin class definition */
+    RequestReorderFRFCFS();
+    RequestReorderFRFCFS(ComponentId_t id, Params &params);
+
+    virtual bool issueRequest( ReqId, Addr, bool isWrite, unsigned numBytes );
+    void setup();
+    void finish();
+    bool clock(Cycle_t cycle);
+
+private:
+
+    static const int32_t NONE = -1;
+
+    struct Req {
+        ReqId id;
+        Addr addr;
+        Addr row;
+        unsigned numBytes;
+        bool isWrite;
+        int32_t agePrev, ageNext;   // Links in the bank queue, oldest first
+        int32_t rowPrev, rowNext;   // Links among the queue's requests to the same row, oldest first
+    };
+
+    struct List {
+        List() : head(NONE), tail(NONE) { }
+        int32_t head;
+        int32_t tail;
+    };
+
+    /* Reads or writes waiting for one bank */
+    struct Queue {
+        Queue() : count(0) { }
+        List age;
+        std::unordered_map<Addr, List> rows;
+        unsigned int count;
+    };
+
+    struct Bank {
+        Bank() : openRow(0), rowOpen(false), hitStreak(0) { }
+        Queue reads;
+        Queue writes;
+        Addr openRow;
+        bool rowOpen;
+        unsigned int hitStreak;     // Row hits issued since the oldest request was passed over
+    };
+
+    void enqueue(Queue &queue, int32_t slot);
+    void dequeue(Queue &queue, int32_t slot);
+    int32_t select(Bank &bank, Queue &queue, bool &capped);
+    void updateDrainMode();
+
+    SimpleMemBackend* backend;
+
+    int reqsPerCycle;               // Number of requests to issue per cycle (max)
+    unsigned int bankQueueDepth;
+    unsigned int writeHighWatermark;
+    unsigned int writeLowWatermark;
+    unsigned int rowHitCap;
+
+    /* Address mapping, matches simpleDRAM (not timingDRAM's address mapper) */
+    uint64_t bankMask;
+    uint64_t lineOffset;
+    uint64_t rowOffset;
+
+    std::vector<Req> pool;
+    int32_t freeList;               // Unused pool entries, linked through ageNext
+    std::vector<Bank> banks;
+    unsigned int nextBank;          // Bank to consider first next cycle
+    unsigned int readCount;
+    unsigned int writeCount;
+    bool draining;
+
+    Statistic<uint64_t>* statRowHit;
+    Statistic<uint64_t>* statRowMiss;
+    Statistic<uint64_t>* statRowHitCap;
+    Statistic<uint64_t>* statWriteDrain;
+    Statistic<uint64_t>* statBankQueueFull;
+};
+
+}
+}
+
+#endif
@@ -441,14 +441,14 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
             remoteWr = new MemEvent(getName(), blockAddr, blockAddr, Command::PutM, lineSize_);
             readData(remoteWr);
             remoteWr->setFlag(MemEvent::F_NORESPONSE); // Don't send a response to this
-            remoteWr->setDst(link_->getTargetDestination(remoteWr->getBaseAddr()));
+            remoteWr->setDstID(link_->getTargetDestination(remoteWr->getBaseAddr()));
             link_->send(remoteWr);
         case AccessStatus::MISS:
             /* Read new data from memory */
             remoteRd = new MemEvent(*ev);
             remoteRd->setCmd(Command::GetS);
             remoteRd->setSrc(getName());
-            remoteRd->setDst(link_->getTargetDestination(remoteRd->getBaseAddr()));
+            remoteRd->setDstID(link_->getTargetDestination(remoteRd->getBaseAddr()));
             if (remoteRd->queryFlag(MemEvent::F_NORESPONSE))
                 remoteRd->clearFlag(MemEvent::F_NORESPONSE);
             it->second.reqev = remoteRd;
@@ -595,7 +595,7 @@ void MemCacheController::writeData(MemEvent* event) {
     if (event->getCmd() == Command::PutM) { /* Write request to memory */
         if (is_debug_event(event)) { Debug(_L4_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); }
 
-        backing_->set(addr, event->getSize(), event->getPayload());
+        backing_->set(addr, event->getSize(), event->getSharedPayload().data());
 
         return;
     }
@@ -603,7 +603,7 @@ void MemCacheController::writeData(MemEvent* event) {
     if (event->getCmd() == Command::Write) {
         if (is_debug_event(event)) { Debug(_L4_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); }
 
-        backing_->set(addr, event->getSize(), event->getPayload());
+        backing_->set(addr, event->getSize(), event->getSharedPayload().data());
 
         return;
     }
@@ -617,11 +617,10 @@ void MemCacheController::readData(MemEvent* event) {
 
     localAddr = toLocalAddr(localAddr);
 
-    vector<uint8_t> payload;
-    payload.resize(event->getSize(), 0);
+    Payload payload(event->getSize());
 
     if (backing_)
-        backing_->get(localAddr, event->getSize(), payload);
+        backing_->get(localAddr, event->getSize(), payload.mutableData());
 
     event->setPayload(payload);
 }
@@ -669,7 +668,7 @@ void MemCacheController::processInitEvent( MemEventInit* me ) {
         if (is_debug_event(me)) { Debug(_L9_,"Memory init %s - Received Write for %" PRIx64 " size %zu\n", getName().c_str(), me->getAddr(),me->getPayload().size()); }
         MemEventInit * mEv = me->clone();
         mEv->setSrc(getName());
-        mEv->setDst(link_->getTargetDestination(mEv->getRoutingAddress()));
+        mEv->setDstID(link_->getTargetDestination(mEv->getRoutingAddress()));
         link_->sendUntimedData(mEv);
     }
     delete me;
@@ -133,40 +133,111 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
      *
      */
 
-    MemBackend * memory = loadUserSubComponent<MemBackend>("backend");
-    if (!memory) {  /* Try to load from our parameters (legacy mode 1) */
-        /* Check if there's an error with the subcomponent the user specified */
-        SubComponentSlotInfo * info = getSubComponentSlotInfo("backend");
-        if (info && info->isPopulated(0)) {
-            out.fatal(CALL_INFO, -1, "%s, ERROR: Unable to load the subcomponent in the 'backend' slot. Check that the requested subcomponent is registered with the SST core.\n", 
-                    getName().c_str());
-        } else {
-            out.output("%s, WARNING: loading backend in legacy mode (from parameter set). Instead, load backend into this controller's 'backend' slot via ctrl.setSubComponent() in configuration.\n", getName().c_str());
+    /* With multiple channels, the controller owns one backend and convertor per channel.
+     * Channel backends come from 'backend' slots 0 to channels-1, or are all loaded from
+     * the legacy parameters.
+     */
+    unsigned int channelCount = params.find<unsigned int>("channels", 1);
+    if (channelCount == 0) {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: channels. Must be at least 1.\n", getName().c_str());
+    }
+
+    uint64_t statFlags = channelCount == 1 ? ComponentInfo::INSERT_STATS : 0; // Channels each keep their own backend statistics
+    SubComponentSlotInfo * backendSlots = getSubComponentSlotInfo("backend");
+
+    for (unsigned int channel = 0; channel < channelCount; channel++) {
+        MemBackend * memory = nullptr;
+        if (channel == 0) {
+            memory = loadUserSubComponent<MemBackend>("backend");
+        } else if (backendSlots && backendSlots->isPopulated(channel)) {
+            memory = backendSlots->create<MemBackend>(channel, ComponentInfo::SHARE_NONE);
         }
-        Params tmpParams = params.get_scoped_params("backendConvertor.backend");
-        std::string name = params.find<std::string>("backendConvertor.backend", "memHierarchy.simpleMem");
-        memory = loadAnonymousSubComponent<MemBackend>(name, "backend", 0, ComponentInfo::INSERT_STATS | ComponentInfo::SHARE_PORTS, tmpParams);
-        if (!memory) {
-            out.fatal(CALL_INFO, -1, "%s, Error: unable to load backend '%s'. Use setSubComponent() on this controller to specify backend in your input configuration; check for valid backend name.\n",
-                    getName().c_str(), name.c_str());
+
+        if (!memory) {  /* Try to load from our parameters (legacy mode 1) */
+            /* Check if there's an error with the subcomponent the user specified */
+            if (backendSlots && backendSlots->isPopulated(channel)) {
+                out.fatal(CALL_INFO, -1, "%s, ERROR: Unable to load the subcomponent in the 'backend' slot. Check that the requested subcomponent is registered with the SST core.\n", 
+                        getName().c_str());
+            } else if (backendSlots && backendSlots->isPopulated(0)) {
+                out.fatal(CALL_INFO, -1, "%s, Error: 'channels' is %u but the 'backend' slot %u is empty. Fill 'backend' slots 0 to %u with one backend per channel.\n",
+                        getName().c_str(), channelCount, channel, channelCount - 1);
+            } else if (channel == 0) {
+                out.output("%s, WARNING: loading backend in legacy mode (from parameter set). Instead, load backend into this controller's 'backend' slot via ctrl.setSubComponent() in configuration.\n", getName().c_str());
+            }
+            Params tmpParams = params.get_scoped_params("backendConvertor.backend");
+            std::string name = params.find<std::string>("backendConvertor.backend", "memHierarchy.simpleMem");
+            memory = loadAnonymousSubComponent<MemBackend>(name, "backend", channel, statFlags | ComponentInfo::SHARE_PORTS, tmpParams);
+            if (!memory) {
+                out.fatal(CALL_INFO, -1, "%s, Error: unable to load backend '%s'. Use setSubComponent() on this controller to specify backend in your input configuration; check for valid backend name.\n",
+                        getName().c_str(), name.c_str());
+            }
         }
-    }
 
-    std::string convertortype = memory->getBackendConvertorType();
-    Params tmpParams = params.get_scoped_params("backendConvertor");
-    memBackendConvertor_ = loadAnonymousSubComponent<MemBackendConvertor>(convertortype, "backendConvertor", 0, ComponentInfo::INSERT_STATS, tmpParams, memory, requestWidth);
+        std::string convertortype = memory->getBackendConvertorType();
+        Params tmpParams = params.get_scoped_params("backendConvertor");
+        MemBackendConvertor * convertor = loadAnonymousSubComponent<MemBackendConvertor>(convertortype, "backendConvertor", channel, statFlags, tmpParams, memory, requestWidth);
 
-    if (memBackendConvertor_ == nullptr) {
-        out.fatal(CALL_INFO, -1, "%s, Error - unable to load MemBackendConvertor.", getName().c_str());
+        if (convertor == nullptr) {
+            out.fatal(CALL_INFO, -1, "%s, Error - unable to load MemBackendConvertor.", getName().c_str());
+        }
+        channels_.push_back(convertor);
     }
+    memBackendConvertor_ = channels_[0];
 
     using std::placeholders::_1;
     using std::placeholders::_2;
-    memBackendConvertor_->setCallbackHandlers(std::bind(&MemController::handleMemResponse, this, _1, _2), std::bind(&MemController::turnClockOn, this));
-    memSize_ = memBackendConvertor_->getMemSize();
+    if (channelCount == 1) {
+        memBackendConvertor_->setCallbackHandlers(std::bind(&MemController::handleMemResponse, this, _1, _2), std::bind(&MemController::turnClockOn, this));
+        memSize_ = memBackendConvertor_->getMemSize();
+    } else {
+        memSize_ = 0;
+        for (unsigned int channel = 0; channel < channelCount; channel++) {
+            channels_[channel]->setCallbackHandlers(std::bind(&MemController::handleChannelResponse, this, _1, _2), std::bind(&MemController::turnChannelClocksOn, this));
+            if (channels_[channel]->getMemSize() != memBackendConvertor_->getMemSize()) {
+                out.fatal(CALL_INFO, -1, "%s, Error - all channels must have the same mem_size. Channel 0 has %zuB, channel %u has %zuB.\n",
+                        getName().c_str(), memBackendConvertor_->getMemSize(), channel, channels_[channel]->getMemSize());
+            }
+            memSize_ += channels_[channel]->getMemSize();
+        }
+    }
     if (memSize_ == 0)
         out.fatal(CALL_INFO, -1, "%s, Error - tried to get memory size from backend but size is 0B. Either backend is missing 'mem_size' parameter or value is invalid.\n", getName().c_str());
 
+    /* Channel interleaving */
+    std::string interleave = params.find<std::string>("channel_interleave", "line");
+    to_lower(interleave);
+    if (interleave != "line" && interleave != "page" && interleave != "xor") {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: channel_interleave. Options are 'line', 'page', and 'xor'. You specified '%s'.\n",
+                getName().c_str(), interleave.c_str());
+    }
+    channelXor_ = (interleave == "xor");
+    channelBits_ = log2Of(channelCount);
+    if (channelXor_ && !isPowerOfTwo(channelCount)) {
+        out.fatal(CALL_INFO, -1, "%s, Error - channel_interleave 'xor' requires channels to be a power of 2. You specified %u channels.\n",
+                getName().c_str(), channelCount);
+    }
+
+    std::string chunkSize = params.find<std::string>("channel_interleave_size", interleave == "page" ? "4KiB" : "64B");
+    fixByteUnits(chunkSize);
+    UnitAlgebra chunk_ua(chunkSize);
+    if (!chunk_ua.hasUnits("B") || chunk_ua.getRoundedValue() == 0) {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: channel_interleave_size. Must have units of bytes (B) and be > 0. SI ok. You specified '%s'.\n",
+                getName().c_str(), chunkSize.c_str());
+    }
+    channelInterleaveSize_ = chunk_ua.getRoundedValue();
+    if (channelCount > 1 && memBackendConvertor_->getMemSize() % channelInterleaveSize_ != 0) {
+        out.fatal(CALL_INFO, -1, "%s, Error - each channel's mem_size (%zuB) must be a multiple of channel_interleave_size (%s).\n",
+                getName().c_str(), memBackendConvertor_->getMemSize(), chunkSize.c_str());
+    }
+
+    if (channelCount > 1) {
+        for (unsigned int channel = 0; channel < channelCount; channel++) {
+            std::string subid = std::to_string(channel);
+            statChannelRequests_.push_back(registerStatistic<uint64_t>("channel_requests", subid));
+            statChannelLatency_.push_back(registerStatistic<uint64_t>("channel_latency", subid));
+        }
+    }
+
     // Load listeners (profilers/tracers/etc.)
     SubComponentSlotInfo* lists = getSubComponentSlotInfo("listener"); // Find all listeners specified in the configuration
     if (lists) {
@@ -296,10 +367,10 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     }
     size_t sizeBytes = size_ua.getRoundedValue();
 
-    if (sizeBytes > memBackendConvertor_->getMemSize()) {
-        sizeBytes = memBackendConvertor_->getMemSize();
-        // Since getMemSize() might not be a power of 2, but malloc store needs it....get a reasonably close power of 2
-        sizeBytes = 1 << log2Of(memBackendConvertor_->getMemSize());
+    if (sizeBytes > memSize_) {
+        sizeBytes = memSize_;
+        // Since memSize_ might not be a power of 2, but malloc store needs it....get a reasonably close power of 2
+        sizeBytes = 1 << log2Of(memSize_);
     }
 
     if (backingType == "mmap") {
@@ -309,7 +380,7 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
             memoryFile.clear();
         }
         try {
-            backing_ = new Backend::BackingMMAP( memoryFile, memBackendConvertor_->getMemSize() );
+            backing_ = new Backend::BackingMMAP( memoryFile, memSize_ );
         }
         catch ( int e) {
             if (e == 1)
@@ -350,12 +421,13 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
                     std::bind(static_cast<void(MemController::*)(Addr,std::vector<uint8_t>*)>(&MemController::writeData), this, _1, _2));
         }
     }
+    WarmupRegistry::addTarget(getName(), this);
 }
 
 void MemController::handleEvent(SST::Event* event) {
     if (!clockOn_) {
         Cycle_t cycle = turnClockOn();
-        memBackendConvertor_->turnClockOn(cycle);
+        turnBackendClocksOn(cycle);
     }
 
     MemEventBase *meb = static_cast<MemEventBase*>(event);
@@ -428,7 +500,7 @@ void MemController::handleEvent(SST::Event* event) {
                         getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                         ev->getVerboseString().c_str());
             }
-            memBackendConvertor_->handleMemEvent( ev );
+            issueMemEvent( ev );
             break;
 
         case Command::FlushLine:
@@ -444,7 +516,7 @@ void MemController::handleEvent(SST::Event* event) {
                                 getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                                 put->getVerboseString().c_str());
                     }
-                    memBackendConvertor_->handleMemEvent( put );
+                    issueMemEvent( put );
                 }
 
                 outstandingEvents_.insert(std::make_pair(ev->getID(), ev));
@@ -454,7 +526,7 @@ void MemController::handleEvent(SST::Event* event) {
                             getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                             ev->getVerboseString().c_str());
                 }
-                memBackendConvertor_->handleMemEvent( ev );
+                issueMemEvent( ev );
 
             }
             break;
@@ -474,10 +546,10 @@ bool MemController::clock(Cycle_t cycle) {
         unclockLink = link_->clock();
     }
 
-    bool unclockBack = memBackendConvertor_->clock( cycle );
+    bool unclockBack = clockBackends( cycle );
 
     if (unclockLink && unclockBack) {
-        memBackendConvertor_->turnClockOff();
+        turnBackendClocksOff();
         clockOn_ = false;
         return true;
     }
@@ -509,7 +581,125 @@ void MemController::handleCustomEvent(MemEventBase * ev) {
                 getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
                 ev->getVerboseString().c_str());
     }
-    memBackendConvertor_->handleCustomEvent(info, ev->getID(), ev->getRqstr());
+    issueCustomEvent(info, ev->getID(), ev->getRqstr());
+}
+
+
+void MemController::issueMemEvent(MemEvent* ev) {
+    if (channels_.size() == 1) {
+        memBackendConvertor_->handleMemEvent(ev);
+        return;
+    }
+
+    Addr baseAddr = ev->getBaseAddr();
+    Addr addr = ev->getAddr();
+    if (ev->getSize() > 0 && baseAddr / channelInterleaveSize_ != (baseAddr + ev->getSize() - 1) / channelInterleaveSize_) {
+        out.fatal(CALL_INFO, -1, "%s, Error: Received an event that spans more than one channel. Increase channel_interleave_size to at least the request size. Event: %s\n",
+                getName().c_str(), ev->getVerboseString(dlevel).c_str());
+    }
+
+    Addr channelAddr;
+    unsigned int channel = getChannel(baseAddr, channelAddr);
+    ev->setBaseAddr(channelAddr);
+    ev->setAddr(channelAddr + (addr - baseAddr));
+
+    ChannelRequest req = { ev, baseAddr, addr, channel, getNextClockCycle(clockTimeBase_) - 1 };
+    channelRequests_.insert(std::make_pair(ev->getID(), req));
+    statChannelRequests_[channel]->addData(1);
+
+    if (is_debug_event(ev)) {
+        Debug(_L10_, "C: %-40" PRIu64 "  %-20s ConvertAddr   Channel %u, 0x%" PRIx64 ", 0x%" PRIx64 "\n",
+                getCurrentSimCycle(), getName().c_str(), channel, baseAddr, channelAddr);
+    }
+
+    channels_[channel]->handleMemEvent(ev);
+}
+
+
+void MemController::issueCustomEvent(Interfaces::StandardMem::CustomData* info, SST::Event::id_type id, std::string rqstr) {
+    if (channels_.size() == 1) {
+        memBackendConvertor_->handleCustomEvent(info, id, rqstr);
+        return;
+    }
+
+    /* Custom data is handed to the backend as is, so only its routing address picks the channel */
+    Addr channelAddr;
+    unsigned int channel = getChannel(translateToLocal(info->getRoutingAddress()), channelAddr);
+
+    ChannelRequest req = { nullptr, 0, 0, channel, getNextClockCycle(clockTimeBase_) - 1 };
+    channelRequests_.insert(std::make_pair(id, req));
+    statChannelRequests_[channel]->addData(1);
+
+    channels_[channel]->handleCustomEvent(info, id, rqstr);
+}
+
+
+/*
+ * Map a controller-local address to a channel and an address within that channel.
+ * Chunks of channelInterleaveSize_ bytes are dealt round-robin to the channels. With 'xor',
+ * the channel index is also XORed with the chunk's row (its index within the channel) so that
+ * power-of-2 strides spread across channels. Either way each channel sees a dense address space.
+ */
+unsigned int MemController::getChannel(Addr addr, Addr &channelAddr) {
+    Addr chunk = addr / channelInterleaveSize_;
+    Addr row = chunk / channels_.size();
+    unsigned int channel = chunk % channels_.size();
+
+    if (channelXor_) {
+        for (Addr bits = row; bits != 0; bits >>= channelBits_)
+            channel ^= bits & (channels_.size() - 1);
+    }
+
+    channelAddr = row * channelInterleaveSize_ + (addr % channelInterleaveSize_);
+    return channel;
+}
+
+
+/* Response from one channel: restore the controller-local addresses before handling it */
+void MemController::handleChannelResponse(SST::Event::id_type id, uint32_t flags) {
+    std::map<SST::Event::id_type, ChannelRequest>::iterator it = channelRequests_.find(id);
+    if (it == channelRequests_.end())
+        out.fatal(CALL_INFO, -1, "Memory controller (%s) received unrecognized channel response ID: %" PRIu64 ", %" PRIu32 "", getName().c_str(), id.first, id.second);
+
+    ChannelRequest &req = it->second;
+    if (req.event) {
+        req.event->setBaseAddr(req.baseAddr);
+        req.event->setAddr(req.addr);
+    }
+    statChannelLatency_[req.channel]->addData(getNextClockCycle(clockTimeBase_) - 1 - req.issueCycle);
+    channelRequests_.erase(it);
+
+    handleMemResponse(id, flags);
+}
+
+
+bool MemController::clockBackends(Cycle_t cycle) {
+    bool unclock = true;
+    for (std::vector<MemBackendConvertor*>::iterator it = channels_.begin(); it != channels_.end(); it++) {
+        if (!(*it)->clock(cycle))
+            unclock = false;
+    }
+    return unclock;
+}
+
+
+void MemController::turnBackendClocksOn(Cycle_t cycle) {
+    for (std::vector<MemBackendConvertor*>::iterator it = channels_.begin(); it != channels_.end(); it++)
+        (*it)->turnClockOn(cycle);
+}
+
+
+void MemController::turnBackendClocksOff() {
+    for (std::vector<MemBackendConvertor*>::iterator it = channels_.begin(); it != channels_.end(); it++)
+        (*it)->turnClockOff();
+}
+
+
+/* A channel woke up the controller. The channels share the controller's clock so wake them all */
+Cycle_t MemController::turnChannelClocksOn() {
+    Cycle_t cycle = turnClockOn();
+    turnBackendClocksOn(cycle);
+    return cycle;
 }
 
 
@@ -593,7 +783,8 @@ void MemController::init(unsigned int phase) {
 }
 
 void MemController::setup(void) {
-    memBackendConvertor_->setup();
+    for (std::vector<MemBackendConvertor*>::iterator it = channels_.begin(); it != channels_.end(); it++)
+        (*it)->setup();
     link_->setup();
 }
 
@@ -601,7 +792,8 @@ void MemController::setup(void) {
 void MemController::finish(void) {
     Cycle_t cycle = getNextClockCycle(clockTimeBase_); // Get finish time
     cycle--;
-    memBackendConvertor_->finish(cycle);
+    for (std::vector<MemBackendConvertor*>::iterator it = channels_.begin(); it != channels_.end(); it++)
+        (*it)->finish(cycle);
     link_->finish();
     if ( CHECKPOINT_SAVE ==  checkpoint_ ) {
         stringstream filename;
@@ -619,10 +811,10 @@ void MemController::writeData(MemEvent* event) {
         Addr addr = event->queryFlag(MemEvent::F_NONCACHEABLE) ? event->getAddr() : event->getBaseAddr();
         if (is_debug_event(event)) { 
             Debug(_L8_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); 
-            printDataValue(addr, &(event->getPayload()), true);
+            printDataValue(addr, &(event->getSharedPayload().data()), true);
         }
 
-        backing_->set(addr, event->getSize(), event->getPayload());
+        backing_->set(addr, event->getSize(), event->getSharedPayload().data());
 
         return;
     }
@@ -631,10 +823,10 @@ void MemController::writeData(MemEvent* event) {
         Addr addr = event->getAddr();
         if (is_debug_event(event)) { 
             Debug(_L8_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); 
-            printDataValue(addr, &(event->getPayload()), true);
+            printDataValue(addr, &(event->getSharedPayload().data()), true);
         }
         
-        backing_->set(addr, event->getSize(), event->getPayload());
+        backing_->set(addr, event->getSize(), event->getSharedPayload().data());
 
         return;
     }
@@ -646,13 +838,13 @@ void MemController::readData(MemEvent* event) {
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     Addr localAddr = noncacheable ? event->getAddr() : event->getBaseAddr();
 
-    vector<uint8_t> payload;
-    payload.resize(event->getSize(), 0);
+    // Read straight into a pooled buffer that the response and the caches above share
+    Payload payload(event->getSize());
 
     if (backing_) {
-        backing_->get(localAddr, event->getSize(), payload);
+        backing_->get(localAddr, event->getSize(), payload.mutableData());
         if (is_debug_addr(localAddr))
-            printDataValue(localAddr, &(payload), false);
+            printDataValue(localAddr, &(payload.data()), false);
     }
 
     event->setPayload(payload);
@@ -685,6 +877,13 @@ void MemController::readData(Addr addr, size_t bytes, std::vector<uint8_t> &data
 }
 
 
+State MemController::warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data) {
+    if (backing_)
+        backing_->get(translateToLocal(addr), data.size(), data.mutableData());
+    return cmd == Command::GetX ? M : E;
+}
+
+
 /* Translations assume interleaveStep is divisible by interleaveSize */
 Addr MemController::translateToLocal(Addr addr) {
     Addr rAddr = addr;
@@ -786,6 +985,9 @@ void MemController::printStatus(Output &statusOut) {
         statusOut.output("    %s\n", it->second->getVerboseString(dlevel).c_str());
     }
 
+    if (channels_.size() > 1)
+        statusOut.output("  Channels: %zu, requests in channels: %zu\n", channels_.size(), channelRequests_.size());
+
     statusOut.output("  Link Status: ");
     if (link_)
         link_->printStatus(statusOut);
@@ -807,7 +1009,7 @@ void MemController::emergencyShutdown() {
     }
 }
 
-void MemController::printDataValue(Addr addr, std::vector<uint8_t>* data, bool set) {
+void MemController::printDataValue(Addr addr, const std::vector<uint8_t>* data, bool set) {
     if (dlevel < 11) return;
 
     std::string action = set ? "WRITE" : "READ";
@@ -26,13 +26,14 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/warmup.h"
 
 namespace SST {
 namespace MemHierarchy {
 
 class MemBackendConvertor;
 
-class MemController : public SST::Component {
+class MemController : public SST::Component, public WarmupTarget {
 public:
 /* Element Library Info */
     SST_ELI_REGISTER_COMPONENT(MemController, "memHierarchy", "MemController", SST_ELI_ELEMENT_VERSION(1,0,0),
@@ -57,7 +58,10 @@ public:
             {"addr_range_end",      "(uint) Highest address handled by this memory.", "uint64_t-1"},\
             {"interleave_size",     "(string) Size of interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
             {"interleave_step",     "(string) Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
-            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""}
+            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""},\
+            {"channels",            "(uint) Number of memory channels behind this controller. Each channel has its own backend and convertor (mem_size is per channel); the controller interleaves requests across them and merges their responses", "1"},\
+            {"channel_interleave",  "(string) How addresses map to channels when channels > 1. Options: 'line' and 'page' (round-robin in chunks of channel_interleave_size), 'xor' (round-robin, with the channel index XOR-hashed with higher address bits; channels must be a power of 2)", "line"},\
+            {"channel_interleave_size", "(string) Size of the chunks interleaved across channels. Must be at least as large as a request. Defaults to 64B for 'line' and 'xor' and 4KiB for 'page'", ""}
 
     SST_ELI_DOCUMENT_PARAMS( MEMCONTROLLER_ELI_PARAMS )
 
@@ -71,13 +75,18 @@ public:
     SST_ELI_DOCUMENT_PORTS( MEMCONTROLLER_ELI_PORTS )
 
 
-#define MEMCONTROLLER_ELI_SUBCOMPONENTSLOTS {"backend", "Backend memory model to use for timing. Defaults to simpleMem", "SST::MemHierarchy::MemBackend"},\
+#define MEMCONTROLLER_ELI_SUBCOMPONENTSLOTS {"backend", "Backend memory model to use for timing. Defaults to simpleMem. With channels > 1, fill slots 0 to channels-1 with one backend per channel", "SST::MemHierarchy::MemBackend"},\
             {"customCmdHandler", "Optional handler for custom command types", "SST::MemHierarchy::CustomCmdMemHandler"}, \
             {"listener", "Optional listeners to gather statistics, create traces, etc. Multiple listeners supported.", "SST::MemHierarchy::CacheListener"}, \
             {"cpulink", "CPU-side link manager (e.g., to caches/cpu). Defaults to MemLink.", "SST::MemHierarchy::MemLinkBase"}
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( MEMCONTROLLER_ELI_SUBCOMPONENTSLOTS )
 
+#define MEMCONTROLLER_ELI_STATS { "channel_requests",   "Number of requests sent to each channel. The subid is the channel number. Only recorded when channels > 1", "requests", 1 },\
+            { "channel_latency",    "Total latency of requests sent to each channel. The subid is the channel number. Only recorded when channels > 1", "cycles", 1 }
+
+    SST_ELI_DOCUMENT_STATISTICS( MEMCONTROLLER_ELI_STATS )
+
 /* Begin class definition */
     typedef uint64_t ReqId;
 
@@ -94,9 +103,15 @@ public:
     void writeData(Addr addr, std::vector<uint8_t>* data);
     void readData(Addr addr, size_t size, std::vector<uint8_t>& data);
 
+    /* Functional warmup (see warmup.h). Memory grants exclusive access and supplies data from the backing store */
+    State warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data);
+    void warmWriteback(Addr addr, Command cmd, const std::string &src) { }
+    bool warmInvalidate(Addr addr, Command cmd) { return false; }
+
 protected:
     MemController();  // for serialization only
     virtual ~MemController() {
+        WarmupRegistry::removeTarget(getName(), this);
         if (backing_)
             delete backing_;
     }
@@ -125,9 +140,17 @@ protected:
     std::set<Addr> DEBUG_ADDR;
     int dlevel;
 
-    MemBackendConvertor*    memBackendConvertor_;
+    MemBackendConvertor*    memBackendConvertor_;  // Channel 0
     Backend::Backing*       backing_;
 
+    /* Send requests to the backend(s). With multiple channels, these pick the channel and
+     * rewrite the event's address to a channel-local one for the duration of the access */
+    void issueMemEvent(MemEvent* ev);
+    void issueCustomEvent(Interfaces::StandardMem::CustomData* info, SST::Event::id_type id, std::string rqstr);
+    bool clockBackends(Cycle_t cycle); // Returns true if all channels can be unclocked
+    void turnBackendClocksOn(Cycle_t cycle);
+    void turnBackendClocksOff();
+
     MemLinkBase* link_;         // Link to the rest of memHierarchy
     bool clockLink_;            // Flag - should we call clock() on this link or not
 
@@ -161,12 +184,33 @@ protected:
     virtual void printStatus(Output &out);
     virtual void emergencyShutdown();
     
-    void printDataValue(Addr addr, std::vector<uint8_t>* data, bool set);
+    void printDataValue(Addr addr, const std::vector<uint8_t>* data, bool set);
 
 private:
 
     std::map<SST::Event::id_type, MemEventBase*> outstandingEvents_; // For sending responses. Expect backend to respond to ALL requests so that we know the execution order
 
+    /* Multi-channel mode */
+    struct ChannelRequest {
+        MemEvent* event;    // Null for custom requests, which are not rewritten
+        Addr baseAddr;      // Controller-local addresses to restore on response
+        Addr addr;
+        unsigned int channel;
+        Cycle_t issueCycle;
+    };
+
+    std::vector<MemBackendConvertor*> channels_;
+    bool channelXor_;                   // XOR-hash higher address bits into the channel index
+    Addr channelInterleaveSize_;
+    unsigned int channelBits_;          // log2(channels) for 'xor'
+    std::map<SST::Event::id_type, ChannelRequest> channelRequests_;
+    std::vector<Statistic<uint64_t>*> statChannelRequests_;
+    std::vector<Statistic<uint64_t>*> statChannelLatency_;
+
+    unsigned int getChannel(Addr addr, Addr &channelAddr);
+    void handleChannelResponse(SST::Event::id_type id, uint32_t flags);
+    Cycle_t turnChannelClocksOn();
+
     void handleCustomEvent(MemEventBase* ev);
 };
 
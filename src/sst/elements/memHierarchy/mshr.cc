@@ -605,7 +605,7 @@ uint32_t MSHR::getAcksNeeded(Addr addr) {
     return (mshr_.find(addr)->second.acksNeeded);
 }
 
-void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
+void MSHR::setData(Addr addr, const Payload& data, bool dirty) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L10_, "    MSHR::setData(0x%" PRIx64 ")\n", addr);
     if (mshr_.find(addr) == mshr_.end()) {
@@ -619,6 +619,10 @@ void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
     mshr_.find(addr)->second.dataDirty = dirty;
 }
 
+void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
+    setData(addr, Payload(data), dirty);
+}
+
 void MSHR::clearData(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L10_, "    MSHR::clearData(0x%" PRIx64 ")\n", addr);
@@ -629,7 +633,7 @@ void MSHR::clearData(Addr addr) {
     mshr_.find(addr)->second.dataDirty = false;
 }
 
-vector<uint8_t>& MSHR::getData(Addr addr) {
+const Payload& MSHR::getData(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getData(0x%" PRIx64 ")\n", addr);
     if (mshr_.find(addr) == mshr_.end()) {
@@ -167,7 +167,7 @@ struct MSHRRegister {
     MSHRRegister() : acksNeeded(0), dataDirty(false), pendingRetries(0) { }
     list<MSHREntry> entries;
     uint32_t acksNeeded;
-    vector<uint8_t> dataBuffer;
+    Payload dataBuffer;
     bool dataDirty;
     uint32_t pendingRetries;
 
@@ -245,9 +245,10 @@ public:
     bool decrementAcksNeeded(Addr addr);
     uint32_t getAcksNeeded(Addr addr);
 
+    void setData(Addr addr, const Payload& data, bool dirty = false);
     void setData(Addr addr, vector<uint8_t>& data, bool dirty = false);
     void clearData(Addr addr);
-    vector<uint8_t>& getData(Addr addr);
+    const Payload& getData(Addr addr);
     bool hasData(Addr addr);
     bool getDataDirty(Addr addr);
     void setDataDirty(Addr addr, bool dirty);
@@ -0,0 +1,234 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_PAYLOAD_H
+#define MEMHIERARCHY_PAYLOAD_H
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include <sst/core/serialization/serializer.h>
+
+namespace SST { namespace MemHierarchy {
+
+/* Counts of payload buffer activity on the calling thread */
+struct PayloadCounters {
+    uint64_t allocations;   // Buffers taken from the heap
+    uint64_t reuses;        // Buffers taken from the pool
+    uint64_t copies;        // Deep copies of data into a buffer
+    uint64_t bytesCopied;
+};
+
+/*
+ * Handle to a reference-counted data buffer.
+ *
+ * Copying a handle shares the buffer, so data can move from memory to an
+ * event, into a cache line, into the MSHR and back into an event without
+ * copying the bytes. A handle copies the bytes only when it is written
+ * while shared. A reference returned by mutableData() is valid until the
+ * handle is next shared, modified, or destroyed.
+ *
+ * Released buffers go to a per-thread pool and keep their storage, so a
+ * steady stream of line-sized payloads allocates nothing once warm.
+ */
+class Payload {
+public:
+    typedef std::vector<uint8_t> dataVec;
+
+    Payload() : buf_(nullptr) { }
+    explicit Payload(size_t size) : buf_(acquire()) { buf_->bytes.assign(size, 0); }
+    explicit Payload(const dataVec &data) : buf_(nullptr) { assign(data.data(), data.size()); }
+
+    Payload(const Payload &other) : buf_(other.buf_) {
+        if (buf_) buf_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    Payload(Payload &&other) : buf_(other.buf_) { other.buf_ = nullptr; }
+    ~Payload() { release(); }
+
+    Payload& operator=(const Payload &other) {
+        if (other.buf_ != buf_) {
+            if (other.buf_) other.buf_->refs.fetch_add(1, std::memory_order_relaxed);
+            release();
+            buf_ = other.buf_;
+        }
+        return *this;
+    }
+    Payload& operator=(Payload &&other) {
+        if (this != &other) {
+            release();
+            buf_ = other.buf_;
+            other.buf_ = nullptr;
+        }
+        return *this;
+    }
+
+    /* Read access, never copies */
+    size_t size() const { return buf_ ? buf_->bytes.size() : 0; }
+    bool empty() const { return size() == 0; }
+    const dataVec& data() const { return buf_ ? buf_->bytes : none(); }
+    dataVec::const_iterator begin() const { return data().begin(); }
+    dataVec::const_iterator end() const { return data().end(); }
+    uint8_t operator[](size_t i) const { return buf_->bytes[i]; }
+    uint8_t at(size_t i) const { return data().at(i); }
+    bool isShared() const { return buf_ && buf_->refs.load(std::memory_order_acquire) > 1; }
+    bool sharesWith(const Payload &other) const { return buf_ && buf_ == other.buf_; }
+
+    /* Write access, copies first if the buffer is shared */
+    dataVec& mutableData() {
+        detach();
+        return buf_->bytes;
+    }
+
+    void resize(size_t size) {
+        if (size == this->size()) return;
+        detach();
+        buf_->bytes.resize(size, 0);
+    }
+
+    void clear() { release(); }
+
+    void assign(const uint8_t *data, size_t size) {
+        own();
+        buf_->bytes.assign(data, data + size);
+        count(size);
+    }
+    void assign(const dataVec &data) { assign(data.data(), data.size()); }
+
+    /* Write src at offset. Overwriting the whole payload shares src instead. */
+    void write(const Payload &src, size_t offset) {
+        if (offset == 0 && src.size() == size() && src.buf_) {
+            *this = src;
+            return;
+        }
+        write(src.data(), offset);
+    }
+    void write(const dataVec &src, size_t offset) {
+        if (src.empty()) return;
+        detach();
+        std::memcpy(buf_->bytes.data() + offset, src.data(), src.size());
+        count(src.size());
+    }
+
+    /* Serialized as a vector; unpacking takes the vector's storage */
+    void serialize(SST::Core::Serialization::serializer &ser) {
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            dataVec bytes;
+            ser & bytes;
+            release();
+            if (!bytes.empty()) {
+                buf_ = acquire();
+                buf_->bytes.swap(bytes);
+            }
+        } else if (buf_) {
+            ser & buf_->bytes;  // Not modified by pack/size
+        } else {
+            dataVec bytes;
+            ser & bytes;
+        }
+    }
+
+    static const PayloadCounters& getCounters() { return pool().counters; }
+
+private:
+    struct Buffer {
+        std::atomic<uint32_t> refs;
+        dataVec bytes;
+    };
+
+    // Buffers larger than this are freed rather than pooled
+    static const size_t MAX_POOLED_BYTES = 4096;
+    static const size_t MAX_POOLED_BUFFERS = 4096;
+
+    struct Pool {
+        Pool() : counters{0, 0, 0, 0} { }
+        ~Pool() {
+            for (Buffer *buf : free)
+                delete buf;
+        }
+        std::vector<Buffer*> free;
+        PayloadCounters counters;
+    };
+
+    static Pool& pool() {
+        static thread_local Pool p;
+        return p;
+    }
+
+    static const dataVec& none() {
+        static const dataVec empty;
+        return empty;
+    }
+
+    static Buffer* acquire() {
+        Pool &p = pool();
+        Buffer *buf;
+        if (p.free.empty()) {
+            buf = new Buffer();
+            p.counters.allocations++;
+        } else {
+            buf = p.free.back();
+            p.free.pop_back();
+            p.counters.reuses++;
+        }
+        buf->refs.store(1, std::memory_order_relaxed);
+        return buf;
+    }
+
+    void release() {
+        if (buf_ && buf_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Pool &p = pool();
+            if (p.free.size() < MAX_POOLED_BUFFERS && buf_->bytes.capacity() <= MAX_POOLED_BYTES) {
+                p.free.push_back(buf_);
+            } else {
+                delete buf_;
+            }
+        }
+        buf_ = nullptr;
+    }
+
+    // Ensure this handle is the only one referencing its buffer, keeping the contents
+    void detach() {
+        if (!buf_) {
+            buf_ = acquire();
+        } else if (buf_->refs.load(std::memory_order_acquire) != 1) {
+            Buffer *copy = acquire();
+            copy->bytes.assign(buf_->bytes.begin(), buf_->bytes.end());
+            count(copy->bytes.size());
+            release();
+            buf_ = copy;
+        }
+    }
+
+    // Ensure this handle is the only one referencing its buffer, discarding the contents
+    void own() {
+        if (!buf_ || buf_->refs.load(std::memory_order_acquire) != 1) {
+            release();
+            buf_ = acquire();
+        }
+    }
+
+    static void count(size_t bytes) {
+        PayloadCounters &c = pool().counters;
+        c.copies++;
+        c.bytesCopied += bytes;
+    }
+
+    Buffer *buf_;
+};
+
+}}
+
+#endif
@@ -0,0 +1,234 @@
+// Copyright 2013-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MEMHIERARCHY_ROUTETABLE_H_
+#define _MEMHIERARCHY_ROUTETABLE_H_
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Maps an address to the destination whose region contains it.
+ *
+ * Regions are added with a small integer destination id and the table is
+ * compiled once all are known. Non-interleaved regions become intervals.
+ * Interleaved regions with the same step and overlapping spans are merged
+ * into one interval backed by a table with one slot per interleave
+ * granule in a period, so a lookup is a binary search over the intervals
+ * plus at most one table index. If the regions can't be compiled (the
+ * intervals overlap or a period table would be too big), lookups scan the
+ * regions in the order they were added.
+ */
+class RouteTable {
+public:
+    static const uint32_t NO_ROUTE = std::numeric_limits<uint32_t>::max();
+
+    RouteTable() : compiled(false) { }
+
+    void clear() {
+        routes.clear();
+        intervals.clear();
+        tables.clear();
+        compiled = false;
+    }
+
+    void addRegion(const MemRegion &region, uint32_t dest) {
+        routes.push_back(Route(region, dest));
+        compiled = false;
+    }
+
+    /* Build the lookup structures. Returns false if lookups will fall back to a linear scan */
+    bool compile(size_t maxSlots = 65536) {
+        intervals.clear();
+        tables.clear();
+        compiled = false;
+
+        std::vector<uint32_t> interleaved;
+        for (uint32_t i = 0; i < routes.size(); i++) {
+            const MemRegion &reg = routes[i].region;
+            if (reg.interleaveSize == 0 || reg.interleaveSize >= reg.interleaveStep) {
+                intervals.push_back(Interval(reg.start, reg.end, i, -1));
+            } else {
+                interleaved.push_back(i);
+            }
+        }
+
+        // Group interleaved regions with the same step whose spans overlap
+        std::sort(interleaved.begin(), interleaved.end(), [this](uint32_t a, uint32_t b) {
+                const MemRegion &ra = routes[a].region;
+                const MemRegion &rb = routes[b].region;
+                if (ra.interleaveStep != rb.interleaveStep) return ra.interleaveStep < rb.interleaveStep;
+                return ra.start < rb.start;
+            });
+        for (size_t i = 0; i < interleaved.size();) {
+            const MemRegion &first = routes[interleaved[i]].region;
+            Addr end = first.end;
+            size_t j = i + 1;
+            while (j < interleaved.size()) {
+                const MemRegion &next = routes[interleaved[j]].region;
+                if (next.interleaveStep != first.interleaveStep || next.start > end) break;
+                end = std::max(end, next.end);
+                j++;
+            }
+            if (!buildPeriodTable(interleaved, i, j, end, maxSlots))
+                return false;
+            i = j;
+        }
+
+        std::sort(intervals.begin(), intervals.end(), [](const Interval &a, const Interval &b) { return a.start < b.start; });
+        for (size_t i = 1; i < intervals.size(); i++) {
+            if (intervals[i].start <= intervals[i-1].end) {
+                intervals.clear();
+                tables.clear();
+                return false;
+            }
+        }
+
+        compiled = true;
+        return true;
+    }
+
+    inline uint32_t lookup(Addr addr) const {
+        if (!compiled) return scan(addr);
+
+        // Last interval starting at or before addr
+        auto it = std::upper_bound(intervals.begin(), intervals.end(), addr,
+                [](Addr a, const Interval &in) { return a < in.start; });
+        if (it == intervals.begin()) return NO_ROUTE;
+        --it;
+        if (addr > it->end) return NO_ROUTE;
+        if (it->table < 0) return routes[it->route].dest;
+
+        const PeriodTable &table = tables[it->table];
+        Addr offset = addr - table.base;
+        uint32_t slot;
+        if (table.pow2) {
+            slot = (offset & table.stepMask) >> table.granuleShift;
+        } else {
+            slot = (offset % table.step) / table.granule;
+        }
+        uint32_t route = table.slots[slot];
+        if (route == NO_ROUTE) return NO_ROUTE;
+        if (routes[route].region.contains(addr)) return routes[route].dest;
+
+        // Regions in the group end at different addresses
+        for (uint32_t member : table.members) {
+            if (routes[member].region.contains(addr)) return routes[member].dest;
+        }
+        return NO_ROUTE;
+    }
+
+    bool isCompiled() const { return compiled; }
+    size_t getNumIntervals() const { return intervals.size(); }
+    size_t getNumPeriodTables() const { return tables.size(); }
+
+private:
+    struct Route {
+        Route(const MemRegion &r, uint32_t d) : region(r), dest(d) { }
+        MemRegion region;
+        uint32_t dest;
+    };
+
+    struct Interval {
+        Interval(Addr s, Addr e, uint32_t r, int32_t t) : start(s), end(e), route(r), table(t) { }
+        Addr start;
+        Addr end;
+        uint32_t route;     // Route for a non-interleaved interval
+        int32_t table;      // Period table for interleaved intervals, otherwise -1
+    };
+
+    struct PeriodTable {
+        Addr base;
+        Addr step;
+        Addr granule;
+        bool pow2;
+        Addr stepMask;
+        uint32_t granuleShift;
+        std::vector<uint32_t> slots;    // Route for each granule in a period
+        std::vector<uint32_t> members;
+    };
+
+    static Addr gcd(Addr a, Addr b) {
+        while (b != 0) {
+            Addr t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    static bool isPow2(Addr x) { return x != 0 && (x & (x - 1)) == 0; }
+
+    bool buildPeriodTable(const std::vector<uint32_t> &group, size_t first, size_t last, Addr end, size_t maxSlots) {
+        PeriodTable table;
+        table.base = routes[group[first]].region.start;
+        table.step = routes[group[first]].region.interleaveStep;
+
+        // Largest granule that every chunk boundary falls on
+        Addr granule = table.step;
+        for (size_t i = first; i < last; i++) {
+            const MemRegion &reg = routes[group[i]].region;
+            granule = gcd(granule, (reg.start - table.base) % table.step);
+            granule = gcd(granule, reg.interleaveSize);
+        }
+        if (table.step / granule > maxSlots) return false;
+
+        table.granule = granule;
+        table.pow2 = isPow2(table.step) && isPow2(granule);
+        table.stepMask = table.step - 1;
+        table.granuleShift = 0;
+        while (((Addr)1 << table.granuleShift) < granule) table.granuleShift++;
+
+        size_t nslots = table.step / granule;
+        table.slots.assign(nslots, (uint32_t)NO_ROUTE);
+        for (size_t i = first; i < last; i++) {
+            uint32_t route = group[i];
+            const MemRegion &reg = routes[route].region;
+            size_t slot = ((reg.start - table.base) % table.step) / granule;
+            for (Addr k = 0; k < reg.interleaveSize / granule; k++) {
+                uint32_t &entry = table.slots[(slot + k) % nslots];
+                if (entry == NO_ROUTE) entry = route;
+            }
+            table.members.push_back(route);
+        }
+
+        intervals.push_back(Interval(table.base, end, NO_ROUTE, tables.size()));
+        tables.push_back(table);
+        return true;
+    }
+
+    uint32_t scan(Addr addr) const {
+        for (const Route &route : routes) {
+            if (route.region.contains(addr)) return route.dest;
+        }
+        return NO_ROUTE;
+    }
+
+    std::vector<Route> routes;
+    std::vector<Interval> intervals;
+    std::vector<PeriodTable> tables;
+    bool compiled;
+};
+
+} //namespace MemHierarchy
+} //namespace SST
+
+#endif
@@ -310,16 +310,16 @@ void Scratchpad::init(unsigned int phase) {
                 MemEventInitCoherence * initEvC = static_cast<MemEventInitCoherence*>(initEv);
                 if (initEvC->getType() == Endpoint::Cache) {
                     caching_ = true;
-                    cacheStatus_.resize(scratchSize_/scratchLineSize_, false);
+                    cacheStatus_.resize((scratchSize_/scratchLineSize_ + 63) / 64, 0);
                 } else if (initEvC->getType() == Endpoint::Directory) {
                     caching_ = true;
                     directory_ = true;
-                    cacheStatus_.resize(scratchSize_/scratchLineSize_, false);
+                    cacheStatus_.resize((scratchSize_/scratchLineSize_ + 63) / 64, 0);
                 }
             }
         } else { // Not a NULLCMD
             MemEventInit * memRequest = new MemEventInit(getName(), initEv->getCmd(), initEv->getAddr() - remoteAddrOffset_, initEv->getPayload());
-            memRequest->setDst(linkDown_->getTargetDestination(memRequest->getAddr()));
+            memRequest->setDstID(linkDown_->getTargetDestination(memRequest->getAddr()));
             linkDown_->sendUntimedData(memRequest);
         }
         delete initEv;
@@ -416,17 +416,17 @@ void Scratchpad::processIncomingRemoteEvent(SST::Event * event) {
                 getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString(dlevel).c_str());
 
     // Determine what kind of event spawned this and pass off to handler
-    std::map<SST::Event::id_type,SST::Event::id_type>::iterator it = responseIDMap_.find(ev->getResponseToID());
+    ForwardedRequest * fwd = forwardedRequests_.find(ev->getResponseToID());
 
-    if (it == responseIDMap_.end()) {
-        dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseIDMap_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
+    if (fwd == nullptr) {
+        dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in forwardedRequests_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
                 getName().c_str(), ev->getResponseToID().first, ev->getResponseToID().second, timestamp_);
     }
 
-    SST::Event::id_type requestID = it->second;
-    responseIDMap_.erase(it);
+    SST::Event::id_type requestID = fwd->requestID;
+    forwardedRequests_.erase(ev->getResponseToID());
 
-    MemEventBase * requestBase = outstandingEventList_.find(requestID)->second.request;
+    MemEventBase * requestBase = outstandingEventList_.find(requestID)->request;
 
     if (requestBase->getCmd() == Command::Get) handleRemoteGetResponse(ev, requestID);
     else handleRemoteReadResponse(ev, requestID);
@@ -461,7 +461,7 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
     while (!memMsgQueue_.empty() && memMsgQueue_.begin()->first < timestamp_) {
         MemEvent * sendEv = memMsgQueue_.begin()->second;
-        sendEv->setDst(linkDown_->getTargetDestination(sendEv->getBaseAddr()));
+        sendEv->setDstID(linkDown_->getTargetDestination(sendEv->getBaseAddr()));
 
         if (is_debug_event(sendEv)) {
             debug = true;
@@ -537,21 +537,20 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
     MemEvent * read = new MemEvent(getName(), ev->getAddr(), ev->getBaseAddr(), Command::GetS, ev->getSize());
     read->copyMetadata(ev);
 
-    responseIDMap_.insert(std::make_pair(read->getID(),ev->getID()));
-    responseIDAddrMap_.insert(std::make_pair(read->getID(),ev->getBaseAddr()));
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    forwardedRequests_.insert(read->getID(), ForwardedRequest(ev->getID(), ev->getBaseAddr()));
+    outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev,response));
 
-    if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
+    if (mshr_.find(ev->getBaseAddr()) == nullptr) {
         std::vector<uint8_t> data = doScratchRead(read);
         response->setPayload(data);
-        mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1,MSHREntry(ev->getID(), Command::GetS, true, false))));
+        mshr_.insert(ev->getBaseAddr(), std::deque<MSHREntry>(1,MSHREntry(ev->getID(), Command::GetS, true, false)));
         if (caching_ && !ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
-            cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = true;
+            setMayBeCached(ev->getBaseAddr(), true);
         }
         if (is_debug_addr(addr))
             eventDI.action = "ScrRead";
     } else {
-        mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetS, read));
+        mshr_.find(ev->getBaseAddr())->push_back(MSHREntry(ev->getID(), Command::GetS, read));
         if (is_debug_addr(addr)) {
             eventDI.action = "stall";
             eventDI.reason = "MSHR conflict";
@@ -560,7 +559,7 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
 
     if (is_debug_event(ev)) {
         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->second.back().getString().c_str());
+                getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->back().getString().c_str());
     }
 }
 
@@ -587,13 +586,13 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     bool doWrite = false; // Decide whether to handle this write immediately EVEN if a conflict
     bool inserted = false;
     /* Check for writeback/invalidation races */
-    if (!directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
-        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+    if (!directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != nullptr) {
+        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->front());
+        if (outstandingEventList_.find(entry->id)->request->getCmd() == Command::Get) {
             handleAckInv(ev);
             return;
             // TODO handle corner cases where Get only writes partial line
-        } else if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Put) {
+        } else if (outstandingEventList_.find(entry->id)->request->getCmd() == Command::Put) {
             if (ev->getPayload().empty()) {
                 handleAckInv(ev);
             } else {
@@ -601,10 +600,10 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
             }
             return;
         }
-    } else if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
+    } else if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != nullptr) {
         /* Drop writeback if we're stalled waiting for a ForceInv response */
-        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->front());
+        if (outstandingEventList_.find(entry->id)->request->getCmd() == Command::Get) {
             MemEvent * response = ev->makeResponse();
             sendResponse(response);
             delete ev;
@@ -615,7 +614,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     /* Drop clean writebacks after sending AckPut */
     if (ev->isWriteback() && !ev->getDirty()) {
         if (caching_) {
-            cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = directory_;
+            setMayBeCached(ev->getBaseAddr(), directory_);
         }
         MemEvent * response = ev->makeResponse();
         sendResponse(response);
@@ -632,19 +631,19 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     write->copyMetadata(ev);
     write->setFlag(MemEvent::F_NORESPONSE);
 
-    if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
+    if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != nullptr) {
         /* For directory - jump write ahead of a Put so we have correct data but otherwise
          * do not resolve race by treating writeback as ackinv since it may not actually signal that
          * the block is not present in caches */
-        std::list<MSHREntry>* entry = &(mshr_.find(ev->getBaseAddr())->second);
-        for (std::list<MSHREntry>::iterator it = entry->begin(); it != entry->end(); it++) {
+        std::deque<MSHREntry>* entry = mshr_.find(ev->getBaseAddr());
+        for (std::deque<MSHREntry>::iterator it = entry->begin(); it != entry->end(); it++) {
             if (it->cmd == Command::Put) {
                 if (it == entry->begin()) {
                     doScratchWrite(write);
                     sendResponse(response); /* Send response when request is sent to scratch, since scratch doesn't respond */
                     delete ev;
                 } else {
-                    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+                    outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev,response));
                     it = entry->insert(it, MSHREntry(ev->getID(), Command::GetX, write));
 
                     if (is_debug_event(ev))
@@ -656,21 +655,21 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
         }
     }
 
-    if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
+    if (mshr_.find(ev->getBaseAddr()) == nullptr) {
         doScratchWrite(write);
         sendResponse(response); /* Send response when request is sent to scratch since scratch doesn't respond */
         delete ev;
         /* Update cache state */
         if (caching_ && !ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
-            cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = directory_;
+            setMayBeCached(ev->getBaseAddr(), directory_);
         }
     } else {
-        outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
-        mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetX, write));
+        outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev,response));
+        mshr_.find(ev->getBaseAddr())->push_back(MSHREntry(ev->getID(), Command::GetX, write));
 
         if (is_debug_event(ev))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                        getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->second.back().getString().c_str());
+                        getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->back().getString().c_str());
     }
 }
 
@@ -697,7 +696,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     stat_ScratchGetReceived->addData(1);
 
     MoveEvent * response = ev->makeResponse();
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev,response));
 
     // Issue remote read
     ev->setSrcBaseAddr((ev->getSrcAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
@@ -706,7 +705,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     remoteRead->setFlag(MemEvent::F_NONCACHEABLE);
     remoteRead->setVirtualAddress(ev->getSrcVirtualAddress());
     remoteRead->setInstructionPointer(ev->getInstructionPointer());
-    responseIDMap_.insert(std::make_pair(remoteRead->getID(), ev->getID()));
+    forwardedRequests_.insert(remoteRead->getID(), ForwardedRequest(ev->getID(), 0));
 
     if (is_debug_event(remoteRead)) {
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get           0x%-16" PRIx64 " 0x%-16" PRIx64 " Remote Read (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
@@ -721,18 +720,18 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     uint32_t lineCount = 1 + (ev->getDstAddr() + ev->getSize() - ev->getDstBaseAddr() - 1)/ scratchLineSize_;
     for (uint32_t i = 0; i < lineCount; i++) {
         Addr baseAddr = ev->getDstBaseAddr() + i*scratchLineSize_;
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        if (mshr_.find(baseAddr) == nullptr) {
             bool needAck = startGet(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck))));
+            mshr_.insert(baseAddr, std::deque<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck)));
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Get, true));
+            mshr_.find(baseAddr)->push_back(MSHREntry(ev->getID(), Command::Get, true));
         }
 
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->back().getString().c_str());
 
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstandingEventList_.find(ev->getID())->incrementCount();
     }
 }
 
@@ -763,7 +762,7 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
     remoteWrite->setFlag(MemEvent::F_NONCACHEABLE);
     remoteWrite->setFlag(MemEvent::F_NORESPONSE);
 
-    outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite)));
+    outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev, response, remoteWrite));
 
     Addr addr = ev->getSrcAddr();
     Addr baseAddr = ev->getSrcBaseAddr();
@@ -772,23 +771,23 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
         uint32_t size = (baseAddr + scratchLineSize_) - addr;
         if (size > bytesLeft) size = bytesLeft;
 
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        if (mshr_.find(baseAddr) == nullptr) {
             bool needAck = startPut(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck))));
+            mshr_.insert(baseAddr, std::deque<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck)));
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Put));
+            mshr_.find(baseAddr)->push_back(MSHREntry(ev->getID(), Command::Put));
         }
 
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
                     getCurrentSimCycle(), timestamp_, getName().c_str(),
-                    baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    baseAddr, mshr_.find(baseAddr)->back().getString().c_str());
 
         bytesLeft -= size;
         baseAddr += scratchLineSize_;
         addr = baseAddr;
 
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstandingEventList_.find(ev->getID())->incrementCount();
     }
 }
 
@@ -801,17 +800,16 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
  *  All others (regular read responses): call finishRequest()
  */
 void Scratchpad::handleScratchResponse(SST::Event::id_type responseID) {
-    SST::Event::id_type requestID = responseIDMap_.find(responseID)->second;
-    responseIDMap_.erase(responseID);
-
-    Addr baseAddr = responseIDAddrMap_.find(responseID)->second;
-    responseIDAddrMap_.erase(responseID);
+    ForwardedRequest * fwd = forwardedRequests_.find(responseID);
+    SST::Event::id_type requestID = fwd->requestID;
+    Addr baseAddr = fwd->baseAddr;
+    forwardedRequests_.erase(responseID);
 
     if (is_debug_addr(baseAddr))
         dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Recv  0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, responseID.first, responseID.second);
 
-    if (outstandingEventList_.find(requestID)->second.request->getCmd() == Command::Put) {
+    if (outstandingEventList_.find(requestID)->request->getCmd() == Command::Put) {
         updatePut(requestID);
     } else { // Anything else - GetS, GetX, etc.
         finishRequest(requestID);
@@ -834,16 +832,16 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
     Addr baseAddr = response->getBaseAddr();
 
     /* Look up request in mshr */
-    MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    MSHREntry * entry = &(mshr_.find(baseAddr)->front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->request);
 
     /* Update cache status */
     if (is_debug_addr(baseAddr))
         dbg.debug(_L9_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s UpdCache   0x%-16" PRIx64 "  Uncached\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr);
 
-    cacheStatus_.at(baseAddr/scratchLineSize_) = false;
+    setMayBeCached(baseAddr, false);
 
     if (entry->cmd == Command::Get) {
         entry->needAck = false;
@@ -877,16 +875,15 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
         read->MemEventBase::copyMetadata(request);
         read->setVirtualAddress(request->getSrcVirtualAddress());
         read->setInstructionPointer(request->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(),requestID));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
+        forwardedRequests_.insert(read->getID(), ForwardedRequest(requestID, baseAddr));
 
         std::vector<uint8_t> data = doScratchRead(read);
-        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
+        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->remoteWrite->getPayload();
         uint32_t offset = addr - request->getSrcAddr();
         for (uint32_t i = 0; i < size; i++) {
             payload[i+offset] = data[i];
         }
-        outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+        outstandingEventList_.find(requestID)->remoteWrite->setPayload(payload);
     } else {
         dbg.fatal(CALL_INFO, -1, "%s, Error: unhandled case in handleAckInv. Time = %" PRIu64 ", Event = (%s).\n",
                 getName().c_str(), timestamp_, event->getVerboseString(dlevel).c_str());
@@ -909,12 +906,12 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     Addr baseAddr = response->getBaseAddr();
 
     /* Look up request in mshr */
-    MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    MSHREntry * entry = &(mshr_.find(baseAddr)->front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->request);
 
     /* Update cache status */
-    cacheStatus_.at(baseAddr/scratchLineSize_) = false;
+    setMayBeCached(baseAddr, false);
 
     // Send a write to scratch if the line was dirty since we forcefully invalidated
     if (response->getDirty()) {
@@ -933,12 +930,12 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
     // Update write payload
-    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
+    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->remoteWrite->getPayload();
     uint32_t offset = addr - put->getSrcAddr();
     for (uint32_t i = 0; i < size; i++) {
         payload[i+offset] = response->getPayload()[i];
     }
-    outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+    outstandingEventList_.find(requestID)->remoteWrite->setPayload(payload);
 
     // Clear this mshr entry
     updatePut(requestID);
@@ -961,13 +958,13 @@ void Scratchpad::handleNack(MemEventBase * event) {
      * been resolved.
      */
     MemEvent * nackedEvent = nack->getNACKedEvent();
-    if (mshr_.find(nackedEvent->getBaseAddr()) == mshr_.end()) {
+    if (mshr_.find(nackedEvent->getBaseAddr()) == nullptr) {
         delete nackedEvent;
         delete nack;
         return;
     }
 
-    MSHREntry * entry = &(mshr_.find(nackedEvent->getBaseAddr())->second.front());
+    MSHREntry * entry = &(mshr_.find(nackedEvent->getBaseAddr())->front());
     if (entry->needAck) {
         // Determine whether nackedEvent actually matches request -> if not, don't resend
         // resend inv
@@ -1001,8 +998,8 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     request->setFlag(MemEvent::F_NONCACHEABLE); // Use byte not line address
 
     MemEvent * response = event->makeResponse();
-    outstandingEventList_.insert(std::make_pair(event->getID(), OutstandingEvent(event, response)));
-    responseIDMap_.insert(std::make_pair(request->getID(), event->getID()));
+    outstandingEventList_.insert(event->getID(), OutstandingEvent(event, response));
+    forwardedRequests_.insert(request->getID(), ForwardedRequest(event->getID(), 0));
 
     memMsgQueue_.insert(std::make_pair(timestamp_, request));
 }
@@ -1040,7 +1037,7 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
  */
 void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_type requestID) {
 
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->request);
 
     uint32_t bytesLeft = request->getSize();
     Addr addr = request->getDstAddr();
@@ -1058,31 +1055,31 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
         write->setInstructionPointer(request->getInstructionPointer());
         write->setFlag(MemEvent::F_NORESPONSE);
 
-        if (mshr_.find(baseAddr)->second.front().id == requestID) {
+        if (mshr_.find(baseAddr)->front().id == requestID) {
             doScratchWrite(write);
-            mshr_.find(baseAddr)->second.front().needData = false;
+            mshr_.find(baseAddr)->front().needData = false;
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                        getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                        getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->front().getString().c_str());
 
-            if (!mshr_.find(baseAddr)->second.front().needAck) {
+            if (!mshr_.find(baseAddr)->front().needAck) {
                 updateGet(requestID);
                 updateMSHR(baseAddr);
             }
         } else {
             // Find it
-            if (mshr_.find(baseAddr) == mshr_.end()) {
+            if (mshr_.find(baseAddr) == nullptr) {
                 dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
             }
-            for (std::list<MSHREntry>::iterator it = mshr_.find(baseAddr)->second.begin(); it != mshr_.find(baseAddr)->second.end(); it++) {
+            for (std::deque<MSHREntry>::iterator it = mshr_.find(baseAddr)->begin(); it != mshr_.find(baseAddr)->end(); it++) {
                 if (it->id == requestID) {
                     it->scratch = write;
                     it->needData = false;
 
                     if (is_debug_addr(baseAddr))
                         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                                getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                                getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->front().getString().c_str());
                 }
             }
         }
@@ -1096,7 +1093,7 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
 
 void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_type requestID) {
     // Update response with payload and finish request
-    MemEvent * fwdResponse = static_cast<MemEvent*>(outstandingEventList_.find(requestID)->second.response);
+    MemEvent * fwdResponse = static_cast<MemEvent*>(outstandingEventList_.find(requestID)->response);
     fwdResponse->setPayload(response->getPayload());
 
     finishRequest(requestID);
@@ -1107,42 +1104,42 @@ void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_ty
 // Update MSHR
 void Scratchpad::updateMSHR(Addr baseAddr) {
     // Remove top event
-    mshr_.find(baseAddr)->second.pop_front();
+    mshr_.find(baseAddr)->pop_front();
 
     // Start next event
-    while (!mshr_.find(baseAddr)->second.empty()) {
-        MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    while (!mshr_.find(baseAddr)->empty()) {
+        MSHREntry * entry = &(mshr_.find(baseAddr)->front());
 
         if (entry->cmd == Command::GetS) {
             std::vector<uint8_t> readData = doScratchRead(entry->scratch);
-            static_cast<MemEvent*>(outstandingEventList_.find(entry->id)->second.response)->setPayload(readData);
+            static_cast<MemEvent*>(outstandingEventList_.find(entry->id)->response)->setPayload(readData);
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entry->getString().c_str());
 
-            if (caching_ && (outstandingEventList_.find(entry->id)->second.request->queryFlag(MemEvent::F_NONCACHEABLE))) {
-                cacheStatus_.at(baseAddr/scratchLineSize_) = true;
+            if (caching_ && (outstandingEventList_.find(entry->id)->request->queryFlag(MemEvent::F_NONCACHEABLE))) {
+                setMayBeCached(baseAddr, true);
             }
             break;
         } else if (entry->cmd == Command::GetX || entry->cmd == Command::Write) {
             doScratchWrite(entry->scratch);
             finishRequest(entry->id);
-            mshr_.find(baseAddr)->second.pop_front();
+            mshr_.find(baseAddr)->pop_front();
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr);
 
         } else if (entry->cmd == Command::Get) {
-            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->request));
             if (!entry->needData) {
                 doScratchWrite(entry->scratch);
                 entry->scratch = nullptr;
             }
             if (!entry->needAck && !entry->needData) {
                 updateGet(entry->id);
-                mshr_.find(baseAddr)->second.pop_front();
+                mshr_.find(baseAddr)->pop_front();
 
                 if (is_debug_addr(baseAddr))
                     dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
@@ -1155,7 +1152,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
                 break; // Still waiting on something
             }
         } else if (entry->cmd == Command::Put) {
-            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->request));
             entry->needData = !entry->needAck;
 
             if (is_debug_addr(baseAddr))
@@ -1169,7 +1166,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
     }
 
     // Clear mshr entry if list is empty
-    if (mshr_.find(baseAddr)->second.empty()) {
+    if (mshr_.find(baseAddr)->empty()) {
         mshr_.erase(baseAddr);
 
         if (is_debug_addr(baseAddr))
@@ -1214,7 +1211,7 @@ void Scratchpad::sendResponse(MemEventBase * event) {
  * Return whether inv was sent or not
  */
 bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
-    if (caching_ && cacheStatus_.at(baseAddr/scratchLineSize_) == true) {
+    if (caching_ && mayBeCached(baseAddr)) {
         MemEvent * inv = new MemEvent(getName(), baseAddr, baseAddr, Command::ForceInv, scratchLineSize_);
         inv->MemEventBase::copyMetadata(get);
         inv->setDst(linkUp_->getSources()->begin()->name);
@@ -1234,10 +1231,10 @@ bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
  * Return whether fetch was sent or not
  */
 bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
-    if (caching_ && cacheStatus_.at(baseAddr/scratchLineSize_) == true) {
+    if (caching_ && mayBeCached(baseAddr)) {
         MemEvent * inv = new MemEvent(getName(), baseAddr, baseAddr, Command::FetchInv, scratchLineSize_);
         inv->MemEventBase::copyMetadata(put);
-        inv->setDst(put->getSrc());
+        inv->setDstID(put->getSrcID());
         inv->setVirtualAddress(put->getSrcVirtualAddress());
         inv->setInstructionPointer(put->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
@@ -1255,55 +1252,54 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
         read->MemEventBase::copyMetadata(put);
         read->setVirtualAddress(put->getSrcVirtualAddress());
         read->setInstructionPointer(put->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(), put->getID()));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
+        forwardedRequests_.insert(read->getID(), ForwardedRequest(put->getID(), baseAddr));
 
         std::vector<uint8_t> data = doScratchRead(read);
 
-        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->second.remoteWrite->getPayload();
+        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->remoteWrite->getPayload();
         uint32_t offset = addr - put->getSrcAddr();
         for (uint32_t i = 0; i < size; i++) {
             payload[i+offset] = data[i];
         }
-        outstandingEventList_.find(put->getID())->second.remoteWrite->setPayload(payload);
+        outstandingEventList_.find(put->getID())->remoteWrite->setPayload(payload);
         return false;
     }
 }
 
 void Scratchpad::updatePut(SST::Event::id_type putID) {
-    uint32_t count = outstandingEventList_.find(putID)->second.decrementCount();
+    uint32_t count = outstandingEventList_.find(putID)->decrementCount();
     if (count == 0) {
-        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(putID)->second.request);
+        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(putID)->request);
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Scratch Done (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(),
                 put->getSrcBaseAddr(),
                 put->getDstBaseAddr(),
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().first,
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().second,
-                outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr());
+                outstandingEventList_.find(putID)->remoteWrite->getID().first,
+                outstandingEventList_.find(putID)->remoteWrite->getID().second,
+                outstandingEventList_.find(putID)->remoteWrite->getBaseAddr());
 //        dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Finish        0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
-//                getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
-        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite));
-        sendResponse(outstandingEventList_.find(putID)->second.response);
-        delete outstandingEventList_.find(putID)->second.request;
+//                getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
+        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->remoteWrite));
+        sendResponse(outstandingEventList_.find(putID)->response);
+        delete outstandingEventList_.find(putID)->request;
         outstandingEventList_.erase(putID);
     }
 
 }
 
 void Scratchpad::updateGet(SST::Event::id_type getID) {
-    uint32_t count = outstandingEventList_.find(getID)->second.decrementCount();
+    uint32_t count = outstandingEventList_.find(getID)->decrementCount();
     if (count == 0) {
-        sendResponse(outstandingEventList_.find(getID)->second.response);
-        delete outstandingEventList_.find(getID)->second.request;
+        sendResponse(outstandingEventList_.find(getID)->response);
+        delete outstandingEventList_.find(getID)->request;
         outstandingEventList_.erase(getID);
     }
 }
 
 void Scratchpad::finishRequest(SST::Event::id_type requestID) {
-    if (outstandingEventList_.find(requestID)->second.response != nullptr)
-        sendResponse(outstandingEventList_.find(requestID)->second.response);
-    delete outstandingEventList_.find(requestID)->second.request;
+    if (outstandingEventList_.find(requestID)->response != nullptr)
+        sendResponse(outstandingEventList_.find(requestID)->response);
+    delete outstandingEventList_.find(requestID)->request;
     outstandingEventList_.erase(requestID);
 }
 
@@ -23,12 +23,13 @@
 #include <sst/core/link.h>
 #include <sst/core/output.h>
 #include <map>
-#include <list>
+#include <deque>
 
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/moveEvent.h"
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/slotTable.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -226,10 +227,16 @@ private:
         }
     } eventDI;
 
-    std::map<SST::Event::id_type,SST::Event::id_type> responseIDMap_;   // Map a forwarded request ID to a original request ID
-    std::map<SST::Event::id_type,Addr> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
-    std::map<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
-    std::map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
+    // A request forwarded to scratch or remote memory on behalf of a processor request
+    struct ForwardedRequest {
+        ForwardedRequest(SST::Event::id_type requestID, Addr baseAddr) : requestID(requestID), baseAddr(baseAddr) { }
+        SST::Event::id_type requestID;  // Original request ID
+        Addr baseAddr;                  // For scratch requests, the request's baseAddr
+    };
+
+    SlotTable<SST::Event::id_type,ForwardedRequest> forwardedRequests_; // Map a forwarded request ID to the original request
+    SlotTable<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
+    SlotTable<Addr,std::deque<MSHREntry> > mshr_; // MSHR for scratch accesses
 
 
     // Outgoing message queues - map send timestamp to event
@@ -242,8 +249,19 @@ private:
     // Caching information
     bool caching_;  // Whether or not caching is possible
     bool directory_; // Whether or not a directory is managing the caches - if so we cannot assume on a writeback that the data is not cached
-    std::vector<bool> cacheStatus_; // One entry per scratchpad line, whether line may be cached
-    std::map<SST::Event::id_type, uint64_t> cacheCounters_; // Map of a Get or Put ID to the number of cache acks/data responses we are waiting for
+    std::vector<uint64_t> cacheStatus_; // One bit per scratchpad line, whether line may be cached
+
+    bool mayBeCached(Addr baseAddr) const {
+        Addr line = baseAddr / scratchLineSize_;
+        return (cacheStatus_[line >> 6] >> (line & 63)) & 1;
+    }
+    void setMayBeCached(Addr baseAddr, bool cached) {
+        Addr line = baseAddr / scratchLineSize_;
+        if (cached)
+            cacheStatus_[line >> 6] |= (uint64_t)1 << (line & 63);
+        else
+            cacheStatus_[line >> 6] &= ~((uint64_t)1 << (line & 63));
+    }
 
     // Statistics
     Statistic<uint64_t>* stat_ScratchReadReceived;
@@ -0,0 +1,158 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SLOTTABLE_H
+#define MEMHIERARCHY_SLOTTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/* Hash for the integer keys used to track outstanding work: addresses and event ids */
+struct SlotTableHash {
+    size_t operator()(uint64_t key) const {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return (size_t)key;
+    }
+
+    template <typename A, typename B>
+    size_t operator()(const std::pair<A, B> &key) const {
+        return (*this)((uint64_t)key.first * 0x9e3779b97f4a7c15ULL ^ (uint64_t)key.second);
+    }
+};
+
+/*
+ * Map for outstanding transactions and per-line state
+ *
+ * Entries live in a pool of slots that is sized up front and reused as entries
+ * are erased; the pool only grows if more entries than that are live at once.
+ * Slots never move, so a pointer returned by find() or insert() stays valid
+ * until that entry is erased. Keys are looked up through an open-addressed
+ * (linear probing) index of slot numbers that uses backward-shift deletion, so
+ * lookups never walk over tombstones.
+ */
+template <typename Key, typename Value, typename Hash = SlotTableHash>
+class SlotTable {
+public:
+    explicit SlotTable(size_t capacity = 64) : size_(0) {
+        size_t entries = 8;
+        while (entries < 2 * capacity)
+            entries <<= 1;
+        index_.assign(entries, EMPTY);
+        mask_ = entries - 1;
+    }
+
+    /* Returns nullptr if key is not present */
+    Value* find(const Key &key) {
+        int32_t slot = index_[position(key)];
+        return slot == EMPTY ? nullptr : &(slots_[slot].value);
+    }
+
+    /* Key must not already be present */
+    Value* insert(const Key &key, const Value &value) {
+        int32_t slot;
+        if (free_.empty()) {
+            slot = slots_.size();
+            slots_.push_back(Slot(key, value));
+        } else {
+            slot = free_.back();
+            free_.pop_back();
+            slots_[slot].key = key;
+            slots_[slot].value = value;
+        }
+        index_[position(key)] = slot;
+        if (++size_ * 2 > index_.size())
+            grow();
+        return &(slots_[slot].value);
+    }
+
+    /* Returns whether key was present */
+    bool erase(const Key &key) {
+        size_t pos = position(key);
+        if (index_[pos] == EMPTY)
+            return false;
+        free_.push_back(index_[pos]);
+        size_--;
+
+        /* Shift later entries of the probe run back so that no run has a hole */
+        index_[pos] = EMPTY;
+        for (size_t next = (pos + 1) & mask_; index_[next] != EMPTY; next = (next + 1) & mask_) {
+            size_t home = Hash()(slots_[index_[next]].key) & mask_;
+            bool stays = (pos <= next) ? (pos < home && home <= next) : (pos < home || home <= next);
+            if (!stays) {
+                index_[pos] = index_[next];
+                index_[next] = EMPTY;
+                pos = next;
+            }
+        }
+        return true;
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /* Call f(key, value) for each entry, in no particular order */
+    template <typename F>
+    void forEach(F f) {
+        for (size_t i = 0; i < index_.size(); i++) {
+            if (index_[i] != EMPTY)
+                f(slots_[index_[i]].key, slots_[index_[i]].value);
+        }
+    }
+
+private:
+    enum { EMPTY = -1 };
+
+    struct Slot {
+        Slot(const Key &key, const Value &value) : key(key), value(value) { }
+        Key key;
+        Value value;
+    };
+
+    /* Index position holding key, or the empty position where it would go */
+    size_t position(const Key &key) const {
+        size_t pos = Hash()(key) & mask_;
+        while (index_[pos] != EMPTY && !(slots_[index_[pos]].key == key))
+            pos = (pos + 1) & mask_;
+        return pos;
+    }
+
+    void grow() {
+        std::vector<int32_t> old;
+        old.swap(index_);
+        index_.assign(old.size() * 2, EMPTY);
+        mask_ = index_.size() - 1;
+        for (size_t i = 0; i < old.size(); i++) {
+            if (old[i] != EMPTY)
+                index_[position(slots_[old[i]].key)] = old[i];
+        }
+    }
+
+    std::deque<Slot> slots_;        // deque so that slots do not move when the pool grows
+    std::vector<int32_t> free_;
+    std::vector<int32_t> index_;
+    size_t mask_;
+    size_t size_;
+};
+
+}}
+
+#endif
@@ -203,7 +203,7 @@ void StandardInterface::send(StandardMem::Request* req) {
 #endif
 
     if (req->needsResponse())
-        requests_[me->getID()] = std::make_pair(req,me->getCmd());   /* Save this request so we can use it when a response is returned */
+        requests_.insert(me->getID(), std::make_pair(req,me->getCmd()));   /* Save this request so we can use it when a response is returned */
     else
         delete req;
 #ifdef __SST_DEBUG_OUTPUT__
@@ -229,16 +229,16 @@ void StandardInterface::receive(SST::Event* ev) {
     /* Handle responses to requests we sent */
     if (isResponse) {
         MemEventBase::id_type origID = me->getResponseToID();
-        std::map<MemEventBase::id_type,std::pair<StandardMem::Request*,Command>>::iterator reqit = requests_.find(origID);
-        if (reqit == requests_.end()) {
+        std::pair<StandardMem::Request*,Command>* reqEntry = requests_.find(origID);
+        if (reqEntry == nullptr) {
             output.fatal(CALL_INFO, -1, "%s, Error: Received response but cannot locate matching request. Response: %s\n",
                 getName().c_str(), me->getVerboseString(dlevel).c_str());
         }
-        StandardMem::Request* origReq = reqit->second.first;
-        Command origCmd = reqit->second.second;
+        StandardMem::Request* origReq = reqEntry->first;
+        Command origCmd = reqEntry->second;
         if (origCmd == Command::GetS || origCmd == Command::GetSX)
             cmd = Command::GetSResp;
-        requests_.erase(reqit);
+        requests_.erase(origID);
         response = me;
         switch (cmd) {
             case Command::GetSResp:
@@ -308,7 +308,7 @@ void StandardInterface::receive(SST::Event* ev) {
                     getName().c_str(), CommandString[(int)cmd], me->getVerboseString(dlevel).c_str());
         };
         if (deliverReq->needsResponse()) /* Endpoint will need to send a response to this */
-            responses_[deliverReq->getID()] = me;
+            responses_.insert(deliverReq->getID(), me);
         else 
             delete me;
     }
@@ -346,7 +346,7 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::Read* req
     MemEvent* read = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::GetS, req->size);
     read->setRqstr(iface->getName());
     read->setThreadID(req->tid);
-    read->setDst(iface->link_->getTargetDestination(bAddr));
+    read->setDstID(iface->link_->getTargetDestination(bAddr));
     read->setVirtualAddress(req->vAddr);
     read->setInstructionPointer(req->iPtr);
     if (noncacheable)
@@ -381,7 +381,7 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::Write* re
     
     write->setRqstr(iface->getName());
     write->setThreadID(req->tid);
-    write->setDst(iface->link_->getTargetDestination(bAddr));
+    write->setDstID(iface->link_->getTargetDestination(bAddr));
     write->setVirtualAddress(req->vAddr);
     write->setInstructionPointer(req->iPtr);
     
@@ -412,7 +412,7 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::FlushAddr
     MemEvent* flush = new MemEvent(iface->getName(), req->pAddr, bAddr, cmd, req->size);
     flush->setRqstr(iface->getName());
     flush->setThreadID(req->tid);
-    flush->setDst(iface->link_->getTargetDestination(bAddr));
+    flush->setDstID(iface->link_->getTargetDestination(bAddr));
     flush->setVirtualAddress(req->vAddr);
     flush->setInstructionPointer(req->iPtr);
 #ifdef __SST_DEBUG_OUTPUT__
@@ -429,7 +429,7 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadLock* req)
     MemEvent* read = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::GetSX, req->size);
     read->setRqstr(iface->getName());
     read->setThreadID(req->tid);
-    read->setDst(iface->link_->getTargetDestination(bAddr));
+    read->setDstID(iface->link_->getTargetDestination(bAddr));
     read->setVirtualAddress(req->vAddr);
     read->setInstructionPointer(req->iPtr);
     read->setFlag(MemEvent::F_LOCKED);
@@ -446,7 +446,7 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::WriteUnlo
     MemEvent* write = new MemEvent(iface->getName(), req->pAddr, bAddr, Command::Write, req->data);
     write->setRqstr(iface->getName());
     write->setThreadID(req->tid);
-    write->setDst(iface->link_->getTargetDestination(bAddr));
+    write->setDstID(iface->link_->getTargetDestination(bAddr));
     write->setVirtualAddress(req->vAddr);
     write->setInstructionPointer(req->iPtr);
     write->setFlag(MemEvent::F_LOCKED);
@@ -468,7 +468,7 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::LoadLink*
     load->setFlag(MemEvent::F_LLSC);
     load->setRqstr(iface->getName());
     load->setThreadID(req->tid);
-    load->setDst(iface->link_->getTargetDestination(bAddr));
+    load->setDstID(iface->link_->getTargetDestination(bAddr));
     load->setVirtualAddress(req->vAddr);
     load->setInstructionPointer(req->iPtr);
     if (req->getNoncacheable())
@@ -486,7 +486,7 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::StoreCond
     store->setFlag(MemEvent::F_LLSC);
     store->setRqstr(iface->getName());
     store->setThreadID(req->tid);
-    store->setDst(iface->link_->getTargetDestination(bAddr));
+    store->setDstID(iface->link_->getTargetDestination(bAddr));
     store->setVirtualAddress(req->vAddr);
     store->setInstructionPointer(req->iPtr);
     
@@ -533,11 +533,11 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::CustomReq* req
 }
 
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp* resp) { 
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase** reqEntry = iface->responses_.find(resp->getID());
+    if (reqEntry == nullptr)
         iface->output.fatal(CALL_INFO, -1, "%s, Error: Handling a ReadResp but no matching Read found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(*reqEntry); // Matching memEvent req
+    iface->responses_.erase(resp->getID());
     MemEvent* meresp = mereq->makeResponse();
     meresp->setPayload(resp->data);
     if (!resp->getSuccess()) {
@@ -546,11 +546,11 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp*
     return meresp;
 }
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::WriteResp* resp) {
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase** reqEntry = iface->responses_.find(resp->getID());
+    if (reqEntry == nullptr)
         iface->output.fatal(CALL_INFO, -1, "%s, Error: Handling a WriteResp but no matching Write found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(*reqEntry); // Matching memEvent req
+    iface->responses_.erase(resp->getID());
     MemEvent* meresp = mereq->makeResponse();
     if (!resp->getSuccess()) {
         meresp->setFail();
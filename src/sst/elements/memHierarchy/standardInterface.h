@@ -29,6 +29,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/slotTable.h"
 
 namespace SST {
 
@@ -119,8 +120,8 @@ protected:
     Addr        baseAddrMask_;
     Addr        lineSize_;
     std::string rqstr_;
-    std::map<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>> requests_;   /* Map requests sent by the endpoint */
-    std::map<StandardMem::Request::id_t, MemEventBase*> responses_;     /* Map requests received by the endpoint */
+    SlotTable<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>> requests_;  /* Map requests sent by the endpoint */
+    SlotTable<StandardMem::Request::id_t, MemEventBase*> responses_;    /* Map requests received by the endpoint */
     SST::MemHierarchy::MemLinkBase*  link_;
     bool cacheDst_; // Whether we've got a cache below us to handle certain conversions or we need to 
 
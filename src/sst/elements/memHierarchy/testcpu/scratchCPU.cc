@@ -57,6 +57,14 @@ ScratchCPU::ScratchCPU(ComponentId_t id, Params& params) : Component(id), rng(id
 
     reqsToIssue = params.find<uint64_t>("reqsToIssue", 1000);
 
+    std::string mix = params.find<std::string>("requestMix", "all");
+    to_lower(mix);
+    if (mix == "all") instTypes = { 0, 1, 2, 3, 4, 5 };
+    else if (mix == "scratch") instTypes = { 0, 1 };
+    else if (mix == "move") instTypes = { 2, 3 };
+    else if (mix == "remote") instTypes = { 4, 5 };
+    else out.fatal(CALL_INFO, -1, "Error (%s): invalid param 'requestMix' - must be 'all', 'scratch', 'remote', or 'move'. You specified '%s'\n", getName().c_str(), mix.c_str());
+
 
     // tell the simulator not to end without us
     registerAsPrimaryComponent();
@@ -103,8 +111,8 @@ bool ScratchCPU::tick(Cycle_t time) {
             // Create and send requests
             for (int i = 0; i < reqCount; i++) {
 
-                // Determine what kind of request to send -> 6 options
-                uint32_t instType = rng.generateNextUInt32() % 6;
+                // Determine what kind of request to send -> up to 6 options
+                uint32_t instType = instTypes[rng.generateNextUInt32() % instTypes.size()];
 
                 Interfaces::StandardMem::Request * req;
                 if (instType == 0) { // Scratch read
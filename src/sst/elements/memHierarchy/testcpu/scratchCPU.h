@@ -22,6 +22,7 @@
 #include <sst/core/rng/marsaglia.h>
 
 #include <unordered_map>
+#include <vector>
 
 using namespace std;
 
@@ -44,7 +45,8 @@ public:
             {"clock",                   "(string) Clock frequency in Hz or period in s", "1GHz"},
             {"maxOutstandingRequests",  "(uint) Maximum number of requests outstanding at a time", "8"},
             {"maxRequestsPerCycle",     "(uint) Maximum number of requests to issue per cycle", "2"},
-            {"reqsToIssue",             "(uint) Number of requests to issue before ending simulation", "1000"} )
+            {"reqsToIssue",             "(uint) Number of requests to issue before ending simulation", "1000"},
+            {"requestMix",              "(string) Kinds of requests to issue. Options: 'all', 'scratch' (scratch reads/writes), 'remote' (memory reads/writes), 'move' (ScratchGet/ScratchPut)", "all"} )
 
     SST_ELI_DOCUMENT_PORTS( {"mem_link", "Connection to cache", { "memHierarchy.MemEventBase" } } )
 
@@ -68,6 +70,7 @@ private:
     uint64_t maxAddr;           // Max address of memory
     uint64_t scratchLineSize;   // Line size for scratchpad -> controls maximum request size
     uint64_t memLineSize;       // Line size for memory -> controls maximum request size
+    std::vector<uint32_t> instTypes;    // Request types to choose from
     uint64_t log2ScratchLineSize;
     uint64_t log2MemLineSize;
 
@@ -37,6 +37,7 @@ componentlist = (
     "memHierarchy.memInterface",
     "memHierarchy.networkMemoryInspector",
     "memHierarchy.reorderByRow",
+    "memHierarchy.reorderFRFCFS",
     "memHierarchy.reorderSimple",
     "memHierarchy.reorderTransactionQ",
     "memHierarchy.replacement.lfu",
@@ -0,0 +1,98 @@
+# Throughput benchmark for memHierarchy.Scratchpad.
+#
+# A ScratchCPU drives a scratchpad with deep pipelines of outstanding requests.
+# The --mix option selects which requests are issued: 'move' issues only
+# ScratchGet/ScratchPut, 'scratch' only scratch reads/writes, 'remote' only
+# reads/writes that bypass the scratchpad, and 'all' a mix of everything.
+# With --cache, an L1 sits between the CPU and scratchpad, so moves must also
+# shoot down cached lines.
+#
+# Compare the mixes with, for example:
+#   for m in scratch remote move all; do
+#     /usr/bin/time -f "$m: %e s, %M KB" sst --print-timing-info scratchMoveThroughput.py --model-options="--mix $m --cache"
+#   done
+
+import sst
+import argparse
+from mhlib import componentlist
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--mix", default="move", choices=["all", "scratch", "remote", "move"], help="kinds of requests to issue")
+parser.add_argument("--requests", type=int, default=200000, help="requests issued by the CPU")
+parser.add_argument("--outstanding", type=int, default=256, help="maximum requests outstanding at the CPU")
+parser.add_argument("--per_cycle", type=int, default=4, help="maximum requests issued per cycle")
+parser.add_argument("--cache", action="store_true", help="put an L1 between the CPU and the scratchpad")
+parser.add_argument("--stats", action="store_true", help="print statistics")
+args = parser.parse_args()
+
+core_clock = "2GHz"
+
+comp_cpu = sst.Component("core", "memHierarchy.ScratchCPU")
+comp_cpu.addParams({
+    "scratchSize" : 65536,      # 64K scratch
+    "maxAddr" : 4194304,        # 4M mem
+    "scratchLineSize" : 64,
+    "memLineSize" : 128,
+    "clock" : core_clock,
+    "maxOutstandingRequests" : args.outstanding,
+    "maxRequestsPerCycle" : args.per_cycle,
+    "reqsToIssue" : args.requests,
+    "requestMix" : args.mix,
+    "verbose" : 1,
+})
+iface = comp_cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+comp_scratch = sst.Component("scratch", "memHierarchy.Scratchpad")
+comp_scratch.addParams({
+    "clock" : core_clock,
+    "size" : "64KiB",
+    "scratch_line_size" : 64,
+    "memory_line_size" : 128,
+    "backing" : "none",
+})
+scratch_conv = comp_scratch.setSubComponent("backendConvertor", "memHierarchy.simpleMemScratchBackendConvertor")
+scratch_back = scratch_conv.setSubComponent("backend", "memHierarchy.simpleMem")
+scratch_back.addParams({
+    "access_time" : "10ns",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_start" : 0,
+    "backing" : "none",
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "100ns",
+    "mem_size" : "4MiB",
+})
+
+if args.stats:
+    sst.setStatisticLoadLevel(7)
+    sst.setStatisticOutput("sst.statOutputConsole")
+    for a in componentlist:
+        sst.enableAllStatisticsForComponentType(a)
+
+if args.cache:
+    comp_l1 = sst.Component("l1", "memHierarchy.Cache")
+    comp_l1.addParams({
+        "cache_frequency" : core_clock,
+        "cache_size" : "4KiB",
+        "access_latency_cycles" : 4,
+        "coherence_protocol" : "MESI",
+        "cache_line_size" : 64,
+        "L1" : 1,
+        "associativity" : 4,
+        "replacement_policy" : "lru",
+    })
+    link_cpu_l1 = sst.Link("link_cpu_l1")
+    link_cpu_l1.connect( (iface, "port", "500ps"), (comp_l1, "high_network_0", "500ps") )
+    link_l1_scratch = sst.Link("link_l1_scratch")
+    link_l1_scratch.connect( (comp_l1, "low_network_0", "500ps"), (comp_scratch, "cpu", "500ps") )
+else:
+    link_cpu_scratch = sst.Link("link_cpu_scratch")
+    link_cpu_scratch.connect( (iface, "port", "1000ps"), (comp_scratch, "cpu", "1000ps") )
+
+link_scratch_mem = sst.Link("link_scratch_mem")
+link_scratch_mem.connect( (comp_scratch, "memory", "100ps"), (memctrl, "direct_link", "100ps") )
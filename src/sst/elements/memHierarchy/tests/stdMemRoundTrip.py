@@ -0,0 +1,64 @@
+# Microbenchmark for request round trips through memHierarchy.standardInterface.
+#
+# A standardCPU issues a request every cycle to an L1 that is large enough to
+# hold its whole address range, so after warm-up every request hits and the
+# simulation time is dominated by converting requests and responses in the
+# interface and the L1 lookup. Round trips per second is --ops divided by the
+# wall-clock time that SST reports.
+#
+# Run with, for example:
+#   sst --print-timing-info stdMemRoundTrip.py --model-options="--ops 2000000 --outstanding 64"
+
+import sst
+import argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--ops", type=int, default=1000000, help="requests issued by the CPU")
+parser.add_argument("--outstanding", type=int, default=64, help="maximum requests outstanding at the CPU")
+parser.add_argument("--per_issue", type=int, default=4, help="maximum requests issued per cycle")
+parser.add_argument("--mem_size", default="16KiB", help="address range the CPU touches, should fit in the L1")
+args = parser.parse_args()
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 1,
+    "memSize" : args.mem_size,
+    "clock" : "2GHz",
+    "verbose" : 0,
+    "maxOutstanding" : args.outstanding,
+    "reqsPerIssue" : args.per_issue,
+    "opCount" : args.ops,
+    "write_freq" : 25,
+    "read_freq" : 75,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "8",
+    "cache_line_size" : "64",
+    "L1" : "1",
+    "cache_size" : "32KiB",
+    "max_requests_per_cycle" : -1,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "512MiB",
+})
+
+link_cpu_cache = sst.Link("link_cpu_cache")
+link_cpu_cache.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+link_cache_mem = sst.Link("link_cache_mem")
+link_cache_mem.connect( (l1cache, "low_network_0", "50ps"), (memctrl, "direct_link", "50ps") )
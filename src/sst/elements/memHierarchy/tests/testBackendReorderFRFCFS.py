@@ -0,0 +1,143 @@
+import sst
+from mhlib import componentlist
+
+# FR-FCFS scheduler in front of simpleDRAM.
+# core0 issues random reads and writes and core1 streams through memory, so each
+# bank sees a run of row hits from core1 with core0's requests to other rows
+# waiting behind them. The small bank queues, low write watermarks, and row hit
+# cap are chosen so that rejection, write drains, and the cap all occur.
+# The reorderer and simpleDRAM are given the same banks/bank_interleave_granularity/row_size
+# so that the reorderer's row hits are also row hits in simpleDRAM.
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_MEM = 0
+
+# Define the simulation components
+cpu0 = sst.Component("core0", "memHierarchy.standardCPU")
+cpu0.addParams({
+    "memFreq" : 2,
+    "memSize" : "1MiB",
+    "verbose" : 0,
+    "clock" : "2GHz",
+    "rngseed" : 7,
+    "maxOutstanding" : 16,
+    "opCount" : 3000,
+    "reqsPerIssue" : 2,
+    "write_freq" : 50, # 50% writes
+    "read_freq" : 50,  # 50% reads
+})
+iface0 = cpu0.setSubComponent("memory", "memHierarchy.standardInterface")
+
+c0_l1cache = sst.Component("l1cache0.mesi", "memHierarchy.Cache")
+c0_l1cache.addParams({
+      "access_latency_cycles" : "3",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "2",
+      "cache_line_size" : "64",
+      "cache_size" : "4 KB",
+      "L1" : "1",
+      "debug" : DEBUG_L1,
+      "debug_level" : 10,
+})
+
+cpu1 = sst.Component("core1", "memHierarchy.streamCPU")
+cpu1.addParams({
+    "commFreq" : 1,
+    "memSize" : 1048576,
+    "verbose" : 0,
+    "clock" : "2GHz",
+    "rngseed" : 11,
+    "maxOutstanding" : 64,
+    "num_loadstore" : 20000,
+    "reqsPerIssue" : 4,
+    "do_write" : 1,
+})
+iface1 = cpu1.setSubComponent("memory", "memHierarchy.standardInterface")
+
+c1_l1cache = sst.Component("l1cache1.mesi", "memHierarchy.Cache")
+c1_l1cache.addParams({
+      "access_latency_cycles" : "3",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "2",
+      "cache_line_size" : "64",
+      "cache_size" : "4 KB",
+      "L1" : "1",
+      "debug" : DEBUG_L1,
+      "debug_level" : 10,
+})
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({
+      "bus_frequency" : "2 Ghz",
+})
+
+l2cache = sst.Component("l2cache.mesi.inclus", "memHierarchy.Cache")
+l2cache.addParams({
+      "access_latency_cycles" : "10",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "8",
+      "cache_line_size" : "64",
+      "cache_size" : "16 KB",
+      "debug" : DEBUG_L2,
+      "debug_level" : 10,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "debug" : DEBUG_MEM,
+    "debug_level" : 10,
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+})
+memreorder = memctrl.setSubComponent("backend", "memHierarchy.reorderFRFCFS")
+memreorder.addParams({
+    "max_issue_per_cycle" : 2,
+    "banks" : 4,
+    "bank_interleave_granularity" : "512B",
+    "row_size" : "2KiB",
+    "bank_queue_depth" : 4,
+    "write_high_watermark" : 8,
+    "write_low_watermark" : 2,
+    "row_hit_cap" : 2,
+})
+memory = memreorder.setSubComponent("backend", "memHierarchy.simpleDRAM")
+memory.addParams({
+    "mem_size" : "512MiB",
+    "tCAS" : 3, # 11@800MHz roughly coverted to 200MHz
+    "tRCD" : 3,
+    "tRP" : 3,
+    "cycle_time" : "5ns",
+    "banks" : 4,
+    "bank_interleave_granularity" : "512B",
+    "row_size" : "2KiB",
+    "row_policy" : "open"
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+
+# Define the simulation links
+link_c0_l1cache = sst.Link("link_c0_l1cache")
+link_c0_l1cache.connect( (iface0, "port", "100ps"), (c0_l1cache, "high_network_0", "100ps") )
+link_c0L1cache_bus = sst.Link("link_c0L1cache_bus")
+link_c0L1cache_bus.connect( (c0_l1cache, "low_network_0", "500ps"), (bus, "high_network_0", "500ps") )
+link_c1_l1cache = sst.Link("link_c1_l1cache")
+link_c1_l1cache.connect( (iface1, "port", "100ps"), (c1_l1cache, "high_network_0", "100ps") )
+link_c1L1cache_bus = sst.Link("link_c1L1cache_bus")
+link_c1L1cache_bus.connect( (c1_l1cache, "low_network_0", "500ps"), (bus, "high_network_1", "500ps") )
+link_bus_l2cache = sst.Link("link_bus_l2cache")
+link_bus_l2cache.connect( (bus, "low_network_0", "500ps"), (l2cache, "high_network_0", "500ps") )
+link_l2cache_mem = sst.Link("link_l2cache_mem")
+link_l2cache_mem.connect( (l2cache, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
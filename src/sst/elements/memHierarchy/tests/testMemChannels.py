@@ -0,0 +1,74 @@
+import sst
+import argparse
+
+# One memory controller with four channels, each with its own simpleMem backend.
+# streamCPU sweeps a 20KiB region (five 4KiB pages) through a 4KiB L1, so every
+# pass misses on every line and writes back the dirty ones.
+#   line: 64B chunks are dealt round-robin, so the channels share the load evenly
+#   page: 4KiB chunks are dealt round-robin, so channel 0 gets pages 0 and 4
+#   xor:  4KiB chunks, with page 4 (row 1) XOR-folded onto channel 1
+parser = argparse.ArgumentParser()
+parser.add_argument("--interleave", help="channel_interleave mode: line, page, or xor", default="line")
+args = parser.parse_args()
+
+DEBUG_L1 = 0
+DEBUG_MEM = 0
+
+# Define the simulation components
+cpu = sst.Component("core", "memHierarchy.streamCPU")
+cpu.addParams({
+    "commFreq" : 1,
+    "memSize" : 20480,
+    "verbose" : 0,
+    "clock" : "2GHz",
+    "maxOutstanding" : 16,
+    "num_loadstore" : 20000,
+    "reqsPerIssue" : 2,
+    "do_write" : 1,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "cache_size" : "4 KB",
+    "L1" : "1",
+    "debug" : DEBUG_L1,
+    "debug_level" : 10,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "channels" : 4,
+    "channel_interleave" : args.interleave,
+    "debug" : DEBUG_MEM,
+    "debug_level" : 10,
+})
+if args.interleave == "xor":
+    memctrl.addParam("channel_interleave_size", "4KiB")
+
+for channel in range(4):
+    memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem", channel)
+    memory.addParams({
+        "access_time" : "100 ns",
+        "mem_size" : "64MiB",
+    })
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+l1cache.enableAllStatistics()
+memctrl.enableAllStatistics()
+
+# Define the simulation links
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "500ps"), (l1cache, "high_network_0", "500ps") )
+link_l1_mem = sst.Link("link_l1_mem")
+link_l1_mem.connect( (l1cache, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
@@ -0,0 +1,79 @@
+import sst
+
+# Functional warmup. The L1 replays testWarmup.trace through the L1, L2, and
+# memory before simulation starts. The trace covers every line streamCPU
+# accesses and the lines fit in the L1, so every access should hit,
+# including the first access to each line: CacheMisses must be 0 in both caches.
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_MEM = 0
+
+# Define the simulation components
+cpu = sst.Component("cpu", "memHierarchy.streamCPU")
+cpu.addParams({
+    "clock" : "2GHz",
+    "do_write" : "1",
+    "num_loadstore" : "2000",
+    "commFreq" : "4",
+    "memSize" : "4096",
+    "maxOutstanding" : "8",
+    "verbose" : 0,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "cache_size" : "8 KB",
+    "L1" : "1",
+    "warmup_trace" : "testWarmup.trace",
+    "warmup_trace_format" : "addr",
+    "debug" : DEBUG_L1,
+    "debug_level" : 10,
+})
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "8",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "8",
+    "cache_line_size" : "64",
+    "cache_size" : "32 KB",
+    "debug" : DEBUG_L2,
+    "debug_level" : 10,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_start" : 0,
+    "debug" : DEBUG_MEM,
+    "debug_level" : 10,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "100ns",
+    "mem_size" : "1MiB",
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+l1cache.enableAllStatistics()
+l2cache.enableAllStatistics()
+
+# Define the simulation links
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "1000ps"), (l1cache, "high_network_0", "1000ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1cache, "low_network_0", "1000ps"), (l2cache, "high_network_0", "1000ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "low_network_0", "1000ps"), (memctrl, "direct_link", "1000ps") )
@@ -62,6 +62,16 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_BackendReorderSimple(self):
         self.memHA_Template("BackendReorderSimple")
 
+    def test_memHA_BackendReorderFRFCFS(self):
+        # Check that the config exercises each of the scheduler's limits rather than
+        # diffing against a reference file, and that the scheduler's notion of a row hit
+        # agrees with simpleDRAM's, i.e., that the two map addresses to banks and rows the same way
+        stats = self.memHA_Stats_Template("BackendReorderFRFCFS")
+        for stat in ["row_hit_cap_reached", "write_drains", "bank_queue_full"]:
+            self.assertTrue(stats["memory:backend." + stat] > 0, "memHA test BackendReorderFRFCFS did not exercise {0}".format(stat))
+        self.assertEqual(stats["memory:backend.row_hits_issued"], stats["memory:backend:backend.row_already_open"],
+                "memHA test BackendReorderFRFCFS: reorderFRFCFS row hits do not match simpleDRAM row hits")
+
     def test_memHA_BackendSimpleDRAM_1(self):
         self.memHA_Template("BackendSimpleDRAM_1")
 
@@ -186,6 +196,52 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     
     def test_memHA_StdMem_mmio3(self):
         self.memHA_Template("StdMem_mmio3")
+
+    def test_memHA_Warmup(self):
+        # The warmup trace covers every line the CPU touches, so the whole run should
+        # hit in the L1 and nothing should reach the L2
+        stats = self.memHA_Stats_Template("Warmup")
+        self.assertEqual(stats["l1cache.CacheMisses"], 0, "memHA test Warmup: L1 missed after warmup")
+        self.assertEqual(stats["l1cache.CacheHits"], 2000, "memHA test Warmup: L1 did not see every CPU access")
+        for stat in ["GetS_recv", "GetX_recv", "Write_recv"]:
+            self.assertEqual(stats["l2cache." + stat], 0, "memHA test Warmup: L2 received {0} after warmup".format(stat))
+
+    def test_memHA_MemChannels_line(self):
+        # Line interleaving spreads the sweep evenly over the channels
+        requests = self.memHA_MemChannels_Template("line")
+        mean = sum(requests) / len(requests)
+        for channel, count in enumerate(requests):
+            self.assertTrue(abs(count - mean) < 0.05 * mean,
+                    "memHA test MemChannels_line: channel {0} got {1} requests, expected about {2}".format(channel, count, mean))
+
+    def test_memHA_MemChannels_page(self):
+        # Page interleaving puts two of the sweep's five pages on channel 0
+        requests = self.memHA_MemChannels_Template("page")
+        for channel in range(1, 4):
+            self.assertTrue(requests[0] > 1.5 * requests[channel],
+                    "memHA test MemChannels_page: channel 0 got {0} requests, channel {1} got {2}".format(requests[0], channel, requests[channel]))
+
+    def test_memHA_MemChannels_xor(self):
+        # XOR interleaving moves the sweep's fifth page from channel 0 to channel 1
+        requests = self.memHA_MemChannels_Template("xor")
+        for channel in [0, 2, 3]:
+            self.assertTrue(requests[1] > 1.5 * requests[channel],
+                    "memHA test MemChannels_xor: channel 1 got {0} requests, channel {1} got {2}".format(requests[1], channel, requests[channel]))
+
+    # Run testMemChannels.py and return the number of requests each channel received
+    def memHA_MemChannels_Template(self, interleave):
+        testcase = "MemChannels_{0}".format(interleave)
+        stats = self.memHA_Stats_Template(testcase, sdl="MemChannels",
+                                          model_options="--interleave={0}".format(interleave))
+        requests = [stats["memory.channel_requests.{0}".format(channel)] for channel in range(4)]
+        for channel in range(4):
+            self.assertTrue(requests[channel] > 0, "memHA test {0}: channel {1} received no requests".format(testcase, channel))
+            self.assertTrue(stats["memory.channel_latency.{0}".format(channel)] > 0,
+                    "memHA test {0}: channel {1} recorded no latency".format(testcase, channel))
+        # Each L1 miss and writeback goes to exactly one channel
+        self.assertEqual(sum(requests), stats["l1cache.CacheMisses"] + stats["l1cache.evict_M"],
+                "memHA test {0}: channel requests do not match the L1's misses and writebacks".format(testcase))
+        return requests
 #####
 
     def memHA_Template(self, testcase,
@@ -251,6 +307,34 @@ class testcase_memHierarchy_memHA(SSTTestCase):
             log_failure(diffdata)
             self.assertTrue(filesAreTheSame, "Output file {0} does not pass check against the Reference File {1} ".format(outfile, reffile))
 
+    # Run a test and return the sum of each statistic, keyed by '<component>.<statistic>'
+    def memHA_Stats_Template(self, testcase, testtimeout=240, sdl=None, model_options=""):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testcasename_sdl = (testcase if sdl is None else sdl).replace("_", "-")
+        testDataFileName=("test_memHA_{0}".format(testcase))
+        sdlfile = "{0}/test{1}.py".format(test_path, testcasename_sdl)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        log_debug("testcase = {0}".format(testcase))
+        log_debug("sdl file = {0}".format(sdlfile))
+
+        otherargs = '--model-options="{0}"'.format(model_options) if model_options else ""
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args=otherargs,
+                     timeout_sec=testtimeout, mpi_out_files=mpioutfiles)
+
+        stat_sum = re.compile(' ([\w.:]+) : Accumulator : Sum.\w+ = (\d+);')
+        stats = {}
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                m = stat_sum.match(line)
+                if m != None:
+                    stats[m.group(1)] = stats.get(m.group(1), 0) + int(m.group(2))
+        return stats
+
 ###
     # Remove lines containing any string found in 'remove_strs' from in_file
     # If out_file != None, output is out_file
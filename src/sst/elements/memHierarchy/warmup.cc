@@ -0,0 +1,216 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "warmup.h"
+
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/* Prospero binary record: cycle, op, address, size */
+static const size_t PROSPERO_RECORD_SIZE = sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t);
+
+static void decodeProsperoRecord(const char* record, WarmupAccess &access) {
+    char op;
+    std::memcpy(&op, record + sizeof(uint64_t), sizeof(char));
+    std::memcpy(&access.addr, record + sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
+    std::memcpy(&access.size, record + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
+    access.write = !(op == 'R' || op == 'r');
+}
+
+/*******************************************************************************
+ * WarmupTraceReader
+ *******************************************************************************/
+
+WarmupTraceReader::WarmupTraceReader(std::string file, std::string format, std::string owner, Output* out) :
+    file_(file), out_(out), fp_(nullptr), gz_(nullptr), line_(0)
+{
+    to_lower(format);
+    if (format == "addr") {
+        format_ = Format::Addr;
+    } else if (format == "prospero_text") {
+        format_ = Format::ProsperoText;
+    } else if (format == "prospero_binary") {
+        format_ = Format::ProsperoBinary;
+    } else if (format == "prospero_compressed") {
+        format_ = Format::ProsperoCompressed;
+    } else {
+        out_->fatal(CALL_INFO, -1, "%s, Error: invalid param 'warmup_trace_format': '%s'. Options: addr, prospero_text, prospero_binary, prospero_compressed.\n",
+                owner.c_str(), format.c_str());
+    }
+
+    if (format_ == Format::ProsperoCompressed) {
+#ifdef HAVE_LIBZ
+        gz_ = gzopen(file_.c_str(), "rb");
+        if (gz_ == Z_NULL)
+            out_->fatal(CALL_INFO, -1, "%s, Error: unable to open warmup trace '%s'.\n", owner.c_str(), file_.c_str());
+#else
+        out_->fatal(CALL_INFO, -1, "%s, Error: warmup_trace_format 'prospero_compressed' requires SST to be configured with zlib.\n", owner.c_str());
+#endif
+    } else {
+        fp_ = fopen(file_.c_str(), format_ == Format::ProsperoBinary ? "rb" : "r");
+        if (fp_ == nullptr)
+            out_->fatal(CALL_INFO, -1, "%s, Error: unable to open warmup trace '%s'.\n", owner.c_str(), file_.c_str());
+    }
+}
+
+WarmupTraceReader::~WarmupTraceReader() {
+    if (fp_)
+        fclose(fp_);
+#ifdef HAVE_LIBZ
+    if (gz_)
+        gzclose((gzFile)gz_);
+#endif
+}
+
+bool WarmupTraceReader::next(WarmupAccess &access) {
+    char buffer[256];
+    switch (format_) {
+        case Format::Addr:
+            while (fgets(buffer, sizeof(buffer), fp_)) {
+                line_++;
+                char* pos = buffer;
+                while (*pos == ' ' || *pos == '\t') pos++;
+                if (*pos == '\0' || *pos == '\n' || *pos == '#')
+                    continue;
+                char* end;
+                access.addr = strtoull(pos, &end, 0);
+                if (end == pos)
+                    out_->fatal(CALL_INFO, -1, "Error: warmup trace '%s', line %" PRIu64 ": expected an address.\n", file_.c_str(), line_);
+                while (*end == ' ' || *end == '\t') end++;
+                access.write = (*end == 'W' || *end == 'w');
+                access.size = 1;
+                return true;
+            }
+            return false;
+        case Format::ProsperoText:
+            while (fgets(buffer, sizeof(buffer), fp_)) {
+                line_++;
+                uint64_t cycle;
+                char op;
+                if (sscanf(buffer, "%" SCNu64 " %c %" SCNu64 " %" SCNu32, &cycle, &op, &access.addr, &access.size) != 4)
+                    continue;
+                access.write = !(op == 'R' || op == 'r');
+                return true;
+            }
+            return false;
+        case Format::ProsperoBinary:
+            if (fread(buffer, PROSPERO_RECORD_SIZE, 1, fp_) != 1)
+                return false;
+            decodeProsperoRecord(buffer, access);
+            return true;
+        case Format::ProsperoCompressed:
+#ifdef HAVE_LIBZ
+            if (gzread((gzFile)gz_, buffer, PROSPERO_RECORD_SIZE) != (int)PROSPERO_RECORD_SIZE)
+                return false;
+            decodeProsperoRecord(buffer, access);
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+/*******************************************************************************
+ * WarmupRegistry
+ *******************************************************************************/
+
+void WarmupRegistry::addTarget(const std::string &name, WarmupTarget* target) {
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.targets[name] = target;
+}
+
+void WarmupRegistry::removeTarget(const std::string &name, WarmupTarget* target) {
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    std::map<std::string, WarmupTarget*>::iterator it = registry.targets.find(name);
+    if (it != registry.targets.end() && it->second == target)
+        registry.targets.erase(it);
+}
+
+WarmupTarget* WarmupRegistry::findTarget(const std::string &name) {
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    std::map<std::string, WarmupTarget*>::iterator it = registry.targets.find(name);
+    return it == registry.targets.end() ? nullptr : it->second;
+}
+
+void WarmupRegistry::addTrace(const std::string &name, uint32_t lineSize, WarmupTraceReader* reader, uint64_t maxAccesses) {
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    Trace trace = { name, lineSize, reader, maxAccesses, 0 };
+    registry.traces.push_back(trace);
+}
+
+uint64_t WarmupRegistry::run(Output* out) {
+    Registry &registry = getRegistry();
+    {
+        std::lock_guard<std::mutex> guard(registry.lock);
+        if (registry.done)
+            return 0;
+        registry.done = true;
+    }
+
+    std::vector<WarmupTarget*> caches;
+    for (std::vector<Trace>::iterator it = registry.traces.begin(); it != registry.traces.end(); it++) {
+        WarmupTarget* cache = findTarget(it->name);
+        if (!cache)
+            out->fatal(CALL_INFO, -1, "%s, Error: cache has a warmup trace but does not support functional warmup.\n", it->name.c_str());
+        caches.push_back(cache);
+    }
+
+    uint64_t lineAccesses = 0;
+    bool active = !registry.traces.empty();
+    while (active) {
+        active = false;
+        for (size_t i = 0; i < registry.traces.size(); i++) {
+            Trace &trace = registry.traces[i];
+            if (!trace.reader)
+                continue;
+
+            WarmupAccess access;
+            if ((trace.maxAccesses != 0 && trace.accesses == trace.maxAccesses) || !trace.reader->next(access)) {
+                delete trace.reader;
+                trace.reader = nullptr;
+                continue;
+            }
+            active = true;
+            trace.accesses++;
+
+            Command cmd = access.write ? Command::GetX : Command::GetS;
+            Addr addr = access.addr - (access.addr % trace.lineSize);
+            Addr end = access.addr + (access.size ? access.size : 1);
+            for (; addr < end; addr += trace.lineSize) {
+                Payload data(trace.lineSize);
+                caches[i]->warmRequest(addr, cmd, "", data);
+                lineAccesses++;
+            }
+        }
+    }
+
+    for (std::vector<Trace>::iterator it = registry.traces.begin(); it != registry.traces.end(); it++) {
+        out->verbose(CALL_INFO, 1, 0, "%s: functional warmup replayed %" PRIu64 " accesses\n", it->name.c_str(), it->accesses);
+    }
+    return lineAccesses;
+}
@@ -0,0 +1,142 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_WARMUP_H
+#define MEMHIERARCHY_WARMUP_H
+
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sst/core/output.h>
+
+#include "sst/elements/memHierarchy/util.h"
+#include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/payload.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Functional cache warming
+ *
+ * A cache given a 'warmup_trace' replays the trace before timed simulation
+ * starts. Each access is applied to the cache and, on a miss or upgrade,
+ * to the components below it in turn, updating tags, coherence state,
+ * sharer/owner tracking and replacement state the same way the equivalent
+ * GetS/GetX, Put* and Inv/Fetch* events would. No events are sent, no time
+ * passes and no statistics are recorded.
+ *
+ * Components that take part implement WarmupTarget and register under
+ * their component name, which is the name their peers see as an event
+ * source or destination. Warming calls between components directly, so it
+ * is only possible when the whole hierarchy is in one process.
+ */
+class WarmupTarget {
+public:
+    virtual ~WarmupTarget() { }
+
+    /*
+     * Request a block on behalf of 'src' (GetS or GetX). Returns the state
+     * granted to src (S, E, or M) and fills 'data', which the caller sizes
+     * to a line, with the block contents.
+     */
+    virtual State warmRequest(Addr addr, Command cmd, const std::string &src, Payload &data) = 0;
+
+    /* 'src' evicted a block (PutS, PutE, or PutM) */
+    virtual void warmWriteback(Addr addr, Command cmd, const std::string &src) = 0;
+
+    /* Invalidate (Inv, FetchInv) or downgrade (FetchInvX) a block. Returns whether the block was dirty */
+    virtual bool warmInvalidate(Addr addr, Command cmd) = 0;
+};
+
+/* One access read from a warmup trace */
+struct WarmupAccess {
+    Addr addr;
+    uint32_t size;
+    bool write;
+};
+
+/*
+ * Reads warmup accesses from a trace file. Formats:
+ *  addr                - Text, one access per line: <address> [R|W] [<pc>]. Numbers may be
+ *                        decimal or 0x-prefixed hex. The pc is accepted but unused.
+ *  prospero_text       - Prospero/Ariel text trace: <cycle> <R|W> <address> <size>
+ *  prospero_binary     - Prospero/Ariel binary trace
+ *  prospero_compressed - Prospero/Ariel gzip-compressed binary trace (requires zlib)
+ * Addresses are used as is, without virtual-to-physical translation.
+ */
+class WarmupTraceReader {
+public:
+    WarmupTraceReader(std::string file, std::string format, std::string owner, Output* out);
+    ~WarmupTraceReader();
+
+    /* Returns false at the end of the trace */
+    bool next(WarmupAccess &access);
+
+private:
+    enum class Format { Addr, ProsperoText, ProsperoBinary, ProsperoCompressed };
+
+    Format format_;
+    std::string file_;
+    Output* out_;
+    FILE* fp_;
+    void* gz_;      // gzFile, kept opaque so zlib is not needed to include this header
+    uint64_t line_;
+};
+
+/* Table of warmup participants and traces. Traces are replayed once, by the first run() */
+class WarmupRegistry {
+public:
+    static void addTarget(const std::string &name, WarmupTarget* target);
+    static void removeTarget(const std::string &name, WarmupTarget* target);
+    static WarmupTarget* findTarget(const std::string &name);
+
+    /* Replay 'reader' into the cache 'name', stopping after maxAccesses (0: whole trace) */
+    static void addTrace(const std::string &name, uint32_t lineSize, WarmupTraceReader* reader, uint64_t maxAccesses);
+
+    /*
+     * Replay all traces, one access from each trace in turn, and return the number of
+     * line accesses made. Called by each cache's setup(); only the first call replays.
+     */
+    static uint64_t run(Output* out);
+
+private:
+    struct Trace {
+        std::string name;
+        uint32_t lineSize;
+        WarmupTraceReader* reader;
+        uint64_t maxAccesses;
+        uint64_t accesses;
+    };
+
+    struct Registry {
+        Registry() : done(false) { }
+        std::map<std::string, WarmupTarget*> targets;
+        std::vector<Trace> traces;
+        bool done;
+        std::mutex lock;
+    };
+
+    static Registry& getRegistry() {
+        static Registry registry;
+        return registry;
+    }
+};
+
+}}
+
+#endif
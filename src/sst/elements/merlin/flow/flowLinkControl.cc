@@ -0,0 +1,275 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include "flowLinkControl.h"
+
+#include <sst/core/output.h>
+
+#include "flow_network.h"
+#include "merlin.h"
+
+namespace SST {
+using namespace Interfaces;
+
+namespace Merlin {
+
+FlowLinkControl::FlowLinkControl(ComponentId_t cid, Params &params, int vns) :
+    SST::Interfaces::SimpleNetwork(cid),
+    rtr_link(nullptr), timer_link(nullptr), delivery_link(nullptr),
+    req_vns(vns), id(-1), network_initialized(false),
+    receiveFunctor(nullptr), sendFunctor(nullptr),
+    network(FlowNetwork::getInstance()),
+    output(getSimulationOutput())
+{
+    link_bw = params.find<UnitAlgebra>("link_bw");
+    if ( !link_bw.hasUnits("B/s") && !link_bw.hasUnits("b/s") ) {
+        merlin_abort.fatal(CALL_INFO,1,"Error: link_bw must be specified in either B/s or b/s (SI prefix also allowed)\n");
+    }
+    if ( link_bw.hasUnits("B/s") ) {
+        link_bw *= UnitAlgebra("8b/B");
+    }
+
+    outbuf_size = params.find<UnitAlgebra>("output_buf_size","1kB");
+    if ( !outbuf_size.hasUnits("b") && !outbuf_size.hasUnits("B") ) {
+        merlin_abort.fatal(CALL_INFO,-1,"out_buf_size must be specified in either "
+                           "bits or bytes: %s\n",outbuf_size.toStringBestSI().c_str());
+    }
+    if ( outbuf_size.hasUnits("B") ) outbuf_size *= UnitAlgebra("8b/B");
+    outbuf_bits = outbuf_size.getRoundedValue();
+
+    if ( params.find<bool>("use_nid_remap",false) ) {
+        merlin_abort.fatal(CALL_INFO,-1,"FlowLinkControl: use_nid_remap is not supported by the flow model\n");
+    }
+
+    std::string port_name("rtr_port");
+    if ( isAnonymous() ) {
+        port_name = params.find<std::string>("port_name");
+    }
+
+    rtr_link = configureLink(port_name, std::string("1GHz"), new Event::Handler<FlowLinkControl>(this,&FlowLinkControl::handle_input));
+
+    timer_link = configureSelfLink(port_name + "_flow_timer", getCoreTimeBase().toString(),
+            new Event::Handler<FlowLinkControl>(this,&FlowLinkControl::handle_timer));
+
+    delivery_link = configureSelfLink(port_name + "_flow_delivery", getCoreTimeBase().toString(),
+            new Event::Handler<FlowLinkControl>(this,&FlowLinkControl::handle_delivery));
+
+    outstanding.assign(req_vns, 0);
+    input_queues.resize(req_vns);
+
+    ns_tc = getTimeConverter("1ns");
+
+    packet_latency = registerStatistic<uint64_t>("packet_latency");
+    send_bit_count = registerStatistic<uint64_t>("send_bit_count");
+}
+
+FlowLinkControl::~FlowLinkControl()
+{
+}
+
+void FlowLinkControl::setup()
+{
+    while ( init_events.size() ) {
+        delete init_events.front();
+        init_events.pop_front();
+    }
+}
+
+RtrInitEvent* FlowLinkControl::checkInitProtocol(Event* ev, RtrInitEvent::Commands command, uint32_t line, const char* file, const char* func)
+{
+    bool good = true;
+    RtrInitEvent* init_ev = nullptr;
+    if ( nullptr == ev || static_cast<BaseRtrEvent*>(ev)->getType() != BaseRtrEvent::INITIALIZATION ) good = false;
+
+    if ( good ) {
+        init_ev = static_cast<RtrInitEvent*>(ev);
+        if ( init_ev->command != command ) {
+            good = false;
+        }
+    }
+
+    sst_assert(good, line, file, func, 1, "Error during FlowLinkControl protocol initialization.  FlowLinkControl must be connected to a merlin.flow_router.\n");
+    return init_ev;
+}
+
+void FlowLinkControl::collectUntimedData()
+{
+    Event* ev;
+    while ( ( ev = rtr_link->recvUntimedData() ) != nullptr ) {
+        BaseRtrEvent* bev = static_cast<BaseRtrEvent*>(ev);
+        if ( bev->getType() != BaseRtrEvent::PACKET ) {
+            merlin_abort_full.fatal(CALL_INFO, 1, "Reached state where a non-RtrEvent was not handled.");
+        }
+        init_events.push_back(static_cast<RtrEvent*>(ev));
+    }
+}
+
+void FlowLinkControl::init(unsigned int phase)
+{
+    switch ( phase ) {
+    case 0:
+    {
+        RtrInitEvent* init_ev = new RtrInitEvent();
+        init_ev->command = RtrInitEvent::REPORT_BW;
+        init_ev->ua_value = link_bw;
+        rtr_link->sendUntimedData(init_ev);
+    }
+        break;
+    case 1:
+    {
+        // The router sends its link bandwidth and my endpoint ID
+        Event* ev = rtr_link->recvUntimedData();
+        RtrInitEvent* init_ev = checkInitProtocol(ev, RtrInitEvent::REPORT_BW, CALL_INFO);
+        if ( link_bw > init_ev->ua_value ) link_bw = init_ev->ua_value;
+        delete ev;
+
+        ev = rtr_link->recvUntimedData();
+        init_ev = checkInitProtocol(ev, RtrInitEvent::REPORT_ID, CALL_INFO);
+        id = init_ev->int_value;
+        delete ev;
+
+        // Bandwidth in bits per core time unit
+        double bw = (link_bw * getCoreTimeBase()).getDoubleValue();
+        network->registerEndpoint(id, this, bw, timer_link);
+        network_initialized = true;
+
+        collectUntimedData();
+    }
+        break;
+    default:
+        collectUntimedData();
+        break;
+    }
+}
+
+void FlowLinkControl::complete(unsigned int phase)
+{
+    collectUntimedData();
+}
+
+void FlowLinkControl::finish()
+{
+    for ( auto& queue : input_queues ) {
+        while ( !queue.empty() ) {
+            delete queue.front();
+            queue.pop();
+        }
+    }
+}
+
+bool FlowLinkControl::send(SimpleNetwork::Request* req, int vn)
+{
+    if ( vn >= req_vns ) return false;
+    if ( !spaceToSend(vn, req->size_in_bits) ) return false;
+
+    req->vn = vn;
+    outstanding[vn] += req->size_in_bits;
+    send_bit_count->addData(req->size_in_bits);
+
+    if ( req->getTraceType() != SimpleNetwork::Request::NONE ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: Send on FlowLinkControl in NIC: %s\n",req->getTraceID(),
+                      getCurrentSimTimeNano(), getName().c_str());
+    }
+
+    network->startFlow(this, req, vn, getCurrentSimCycle());
+    return true;
+}
+
+// A single request larger than the buffer can always be sent once the
+// buffer has drained
+bool FlowLinkControl::spaceToSend(int vn, int bits)
+{
+    if ( outstanding[vn] == 0 ) return true;
+    return outstanding[vn] + bits <= outbuf_bits;
+}
+
+SimpleNetwork::Request* FlowLinkControl::recv(int vn)
+{
+    if ( input_queues[vn].empty() ) return nullptr;
+
+    SimpleNetwork::Request* req = input_queues[vn].front();
+    input_queues[vn].pop();
+
+    if ( req->getTraceType() != SimpleNetwork::Request::NONE ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: recv called on FlowLinkControl in NIC: %s\n",req->getTraceID(),
+                      getCurrentSimTimeNano(), getName().c_str());
+    }
+    return req;
+}
+
+void FlowLinkControl::sendUntimedData(SimpleNetwork::Request* req)
+{
+    rtr_link->sendUntimedData(new RtrEvent(req,id,0));
+}
+
+SimpleNetwork::Request* FlowLinkControl::recvUntimedData()
+{
+    if ( init_events.size() ) {
+        RtrEvent *ev = init_events.front();
+        init_events.pop_front();
+        SimpleNetwork::Request* ret = ev->takeRequest();
+        delete ev;
+        return ret;
+    } else {
+        return nullptr;
+    }
+}
+
+void FlowLinkControl::deliverFlow(SimpleNetwork::Request* req, int vn, SimTime_t start_time, SimTime_t latency)
+{
+    delivery_link->send(latency, new FlowDeliveryEvent(req, vn, start_time));
+}
+
+void FlowLinkControl::flowDone(int vn, int bits)
+{
+    outstanding[vn] -= bits;
+    if ( sendFunctor != nullptr ) {
+        if ( !(*sendFunctor)(vn) ) sendFunctor = nullptr;
+    }
+}
+
+void FlowLinkControl::handle_input(Event* ev)
+{
+    merlin_abort.fatal(CALL_INFO, 1, "FlowLinkControl: received an event from the router during the run\n");
+}
+
+void FlowLinkControl::handle_timer(Event* ev)
+{
+    network->handleTimer(static_cast<FlowTimerEvent*>(ev), getCurrentSimCycle());
+}
+
+void FlowLinkControl::handle_delivery(Event* ev)
+{
+    FlowDeliveryEvent* fev = static_cast<FlowDeliveryEvent*>(ev);
+    int vn = fev->vn;
+    if ( vn >= req_vns ) {
+        merlin_abort.fatal(CALL_INFO, 1, "FlowLinkControl: endpoint %lld received data on VN %d, but only has %d VNs\n",
+                           (long long)id, vn, req_vns);
+    }
+
+    input_queues[vn].push(fev->request);
+    packet_latency->addData(ns_tc->convertFromCoreTime(getCurrentSimCycle() - fev->start_time));
+    delete fev;
+
+    if ( receiveFunctor != nullptr ) {
+        if ( !(*receiveFunctor)(vn) ) receiveFunctor = nullptr;
+    }
+}
+
+}
+}
@@ -0,0 +1,153 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_FLOW_FLOWLINKCONTROL_H
+#define COMPONENTS_MERLIN_FLOW_FLOWLINKCONTROL_H
+
+#include <sst/core/subcomponent.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <sst/core/interfaces/simpleNetwork.h>
+
+#include <sst/core/statapi/statbase.h>
+
+#include "sst/elements/merlin/router.h"
+
+#include <deque>
+#include <queue>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+class FlowNetwork;
+
+// Network interface for the flow level network model.  Has the same
+// interface as LinkControl, but instead of sending packets to a
+// router, each send starts a flow in the shared FlowNetwork, which
+// delivers the request once the flow has finished.  Must be connected
+// to a merlin.flow_router.
+class FlowLinkControl : public SST::Interfaces::SimpleNetwork {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        FlowLinkControl,
+        "merlin",
+        "flowlinkcontrol",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Network interface for the flow level network model.  Connects to merlin.flow_router",
+        SST::Interfaces::SimpleNetwork
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"port_name",          "Port name to connect to.  Only used when loaded anonymously",""},
+        {"link_bw",            "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"output_buf_size",    "Amount of data that can be in flight from this endpoint on each VN, specified in b or B (can include SI prefix).", "1kB"},
+        {"input_buf_size",     "Ignored, accepted for compatibility with merlin.linkcontrol.", ""},
+        {"job_id",             "Ignored, accepted for compatibility with merlin.linkcontrol.", "" },
+        {"job_size",           "Ignored, accepted for compatibility with merlin.linkcontrol.", ""},
+        {"logical_nid",        "Ignored, accepted for compatibility with merlin.linkcontrol.", "" },
+        {"use_nid_remap",      "Not supported by the flow model.", "false" },
+        {"vn_remap",           "Ignored, accepted for compatibility with merlin.linkcontrol.", "" },
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "packet_latency",     "Histogram of latencies for received packets", "latency", 1},
+        { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"rtr_port", "Port that connects to router", { "merlin.RtrEvent", "merlin.RtrInitEvent", "" } },
+    )
+
+private:
+
+    Link* rtr_link;
+    // Self link the FlowNetwork uses as its timer
+    Link* timer_link;
+    // Self link to delay delivery of finished flows by the path latency
+    Link* delivery_link;
+
+    UnitAlgebra link_bw;
+    UnitAlgebra outbuf_size;
+
+    int req_vns;
+    nid_t id;
+    bool network_initialized;
+
+    // Bits in flight on each VN
+    std::vector<int64_t> outstanding;
+    int64_t outbuf_bits;
+
+    std::vector<std::queue<SST::Interfaces::SimpleNetwork::Request*> > input_queues;
+
+    // Untimed data received from the network
+    std::deque<RtrEvent*> init_events;
+
+    HandlerBase* receiveFunctor;
+    HandlerBase* sendFunctor;
+
+    // packet_latency is reported in ns, like LinkControl
+    TimeConverter* ns_tc;
+    Statistic<uint64_t>* packet_latency;
+    Statistic<uint64_t>* send_bit_count;
+
+    FlowNetwork* network;
+    Output& output;
+
+    RtrInitEvent* checkInitProtocol(Event* ev, RtrInitEvent::Commands command, uint32_t line, const char* file, const char* func);
+    void collectUntimedData();
+
+    void handle_input(Event* ev);
+    void handle_timer(Event* ev);
+    void handle_delivery(Event* ev);
+
+public:
+    FlowLinkControl(ComponentId_t cid, Params &params, int vns);
+    ~FlowLinkControl();
+
+    void setup();
+    void init(unsigned int phase);
+    void complete(unsigned int phase);
+    void finish();
+
+    bool send(SST::Interfaces::SimpleNetwork::Request* req, int vn);
+    bool spaceToSend(int vn, int bits);
+    SST::Interfaces::SimpleNetwork::Request* recv(int vn);
+    bool requestToReceive( int vn ) { return ! input_queues[vn].empty(); }
+
+    void sendUntimedData(SST::Interfaces::SimpleNetwork::Request* ev);
+    SST::Interfaces::SimpleNetwork::Request* recvUntimedData();
+
+    inline void setNotifyOnReceive(HandlerBase* functor) { receiveFunctor = functor; }
+    inline void setNotifyOnSend(HandlerBase* functor) { sendFunctor = functor; }
+
+    inline bool isNetworkInitialized() const { return network_initialized; }
+    inline nid_t getEndpointID() const { return id; }
+    inline const UnitAlgebra& getLinkBW() const { return link_bw; }
+
+    // Called by FlowNetwork
+    void deliverFlow(SST::Interfaces::SimpleNetwork::Request* req, int vn, SimTime_t start_time, SimTime_t latency);
+    void flowDone(int vn, int bits);
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOW_FLOWLINKCONTROL_H
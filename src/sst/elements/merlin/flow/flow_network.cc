@@ -0,0 +1,362 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "flow_network.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "flowLinkControl.h"
+#include "merlin.h"
+
+using namespace SST::Merlin;
+using SST::Interfaces::SimpleNetwork;
+
+FlowNetwork*
+FlowNetwork::getInstance()
+{
+    static FlowNetwork* instance = nullptr;
+    if ( instance == nullptr ) instance = new FlowNetwork();
+    return instance;
+}
+
+FlowNetwork::FlowNetwork() :
+    last_update(0),
+    timer(nullptr),
+    generation(0),
+    recompute_pending(false),
+    recompute_time(0),
+    flows_started(0),
+    rate_updates(0),
+    solver_seconds(0)
+{
+}
+
+void
+FlowNetwork::registerRouter(int id, Topology* topo, const std::vector<PortInfo>& ports, int num_vns,
+                            double bw, SimTime_t hop_latency, int flit_size)
+{
+    if ( id >= (int)routers.size() ) routers.resize(id + 1);
+    Router& rtr = routers[id];
+    if ( rtr.topo != nullptr ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: router %d registered twice\n", id);
+    }
+    rtr.topo = topo;
+    rtr.ports = ports;
+    rtr.port_links.assign(ports.size(), -1);
+    rtr.num_vns = num_vns;
+    rtr.bw = bw;
+    rtr.hop_latency = hop_latency;
+    rtr.flit_size = flit_size;
+
+    for ( size_t p = 0; p < ports.size(); ++p ) {
+        if ( ports[p].state != Topology::R2N ) continue;
+        int ep = ports[p].peer;
+        if ( ep >= (int)endpoints.size() ) endpoints.resize(ep + 1);
+        endpoints[ep].router = id;
+        endpoints[ep].port = p;
+    }
+}
+
+void
+FlowNetwork::registerEndpoint(int id, FlowLinkControl* nic, double bw, Link* timer_link)
+{
+    if ( id >= (int)endpoints.size() ) endpoints.resize(id + 1);
+    endpoints[id].nic = nic;
+    endpoints[id].bw = bw;
+
+    // All the endpoints share one timer.  Any self link will do since
+    // the model only runs serially.
+    if ( timer == nullptr ) timer = timer_link;
+}
+
+int
+FlowNetwork::getRouterLink(int rtr, int port)
+{
+    Router& r = routers[rtr];
+    if ( r.port_links[port] == -1 ) {
+        double bw = r.bw;
+        const PortInfo& info = r.ports[port];
+        if ( info.state == Topology::R2N && endpoints[info.peer].bw > 0 ) {
+            bw = std::min(bw, endpoints[info.peer].bw);
+        }
+        r.port_links[port] = link_capacity.size();
+        link_capacity.push_back(bw);
+    }
+    return r.port_links[port];
+}
+
+// Finds the path by handing a dummy packet from router to router and
+// letting each topology object route it, exactly as hr_router would.
+// Paths are cached, so topologies that pick among several paths will
+// use a single path for each source, destination and VN.
+const FlowNetwork::Path*
+FlowNetwork::getPath(int src, int dest, int vn, int size_in_bits)
+{
+    uint64_t key = ((uint64_t)src << 32) | ((uint64_t)dest << 8) | (uint64_t)vn;
+    auto it = path_cache.find(key);
+    if ( it != path_cache.end() ) return it->second;
+
+    if ( dest < 0 || dest >= (int)endpoints.size() || endpoints[dest].router == -1 || endpoints[dest].nic == nullptr ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: endpoint %d sent to unknown endpoint %d\n", src, dest);
+    }
+    Endpoint& ep = endpoints[src];
+    if ( ep.router == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: endpoint %d is not attached to a flow_router\n", src);
+    }
+    if ( ep.inject_link == -1 ) {
+        ep.inject_link = link_capacity.size();
+        link_capacity.push_back(std::min(ep.bw, routers[ep.router].bw));
+    }
+
+    Path* path = new Path();
+    path->latency = 0;
+    path->links.push_back(ep.inject_link);
+
+    int rtr = ep.router;
+    int in_port = ep.port;
+    if ( vn >= routers[rtr].num_vns ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: endpoint %d sent on VN %d, but the network only has %d VNs\n",
+                           src, vn, routers[rtr].num_vns);
+    }
+
+    SimpleNetwork::Request* req = new SimpleNetwork::Request(dest, src, size_in_bits, true, true);
+    RtrEvent* rev = new RtrEvent(req, src, vn);
+    rev->computeSizeInFlits(routers[rtr].flit_size);
+    internal_router_event* ire = routers[rtr].topo->process_input(rev);
+
+    for ( size_t hops = 0; ; ++hops ) {
+        if ( hops > routers.size() ) {
+            merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: route from endpoint %d to %d loops\n", src, dest);
+        }
+        Router& r = routers[rtr];
+        r.topo->route_packet(in_port, ire->getVC(), ire);
+        int out_port = ire->getNextPort();
+        if ( out_port < 0 || out_port >= (int)r.ports.size() ) {
+            merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: router %d routed endpoint %d to invalid port %d\n",
+                               rtr, dest, out_port);
+        }
+        path->links.push_back(getRouterLink(rtr, out_port));
+        path->latency += r.hop_latency;
+
+        const PortInfo& info = r.ports[out_port];
+        if ( info.state == Topology::R2N ) {
+            if ( info.peer != dest ) {
+                merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: packet for endpoint %d delivered to endpoint %d\n",
+                                   dest, info.peer);
+            }
+            break;
+        }
+        if ( info.peer < 0 ) {
+            merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: router %d routed endpoint %d to unconnected port %d\n",
+                               rtr, dest, out_port);
+        }
+        rtr = info.peer;
+        in_port = info.peer_port;
+    }
+    delete ire;
+
+    path_cache[key] = path;
+    return path;
+}
+
+void
+FlowNetwork::startFlow(FlowLinkControl* src, SimpleNetwork::Request* req, int vn, SimTime_t now)
+{
+    advance(now);
+
+    Flow flow;
+    flow.req = req;
+    flow.src = src;
+    flow.vn = vn;
+    flow.path = getPath(src->getEndpointID(), req->dest, vn, req->size_in_bits);
+    flow.remaining = req->size_in_bits;
+    flow.rate = 0;
+    flow.start_time = now;
+    flows.push_back(flow);
+    flows_started++;
+
+    scheduleRecompute(now);
+}
+
+void
+FlowNetwork::advance(SimTime_t now)
+{
+    double elapsed = now - last_update;
+    if ( elapsed > 0 ) {
+        for ( auto& flow : flows ) {
+            flow.remaining -= flow.rate * elapsed;
+        }
+    }
+    last_update = now;
+}
+
+// Max-min fair rates by progressive filling: repeatedly find the link
+// that gives the smallest equal share to the flows not yet fixed, fix
+// those flows at that share and remove the bandwidth they use from
+// the rest of their path.
+void
+FlowNetwork::solve()
+{
+    auto start = std::chrono::steady_clock::now();
+
+    if ( link_remaining.size() < link_capacity.size() ) {
+        link_remaining.resize(link_capacity.size());
+        link_unfixed.resize(link_capacity.size(), 0);
+        link_index.resize(link_capacity.size(), -1);
+    }
+
+    // Flows on each touched link, stored as one flat array indexed
+    // by link_flow_start
+    std::vector<int> link_flow_start;
+    std::vector<int> link_flows;
+
+    for ( auto& flow : flows ) {
+        flow.fixed = false;
+        for ( int l : flow.path->links ) {
+            if ( link_index[l] == -1 ) {
+                link_index[l] = link_touched.size();
+                link_touched.push_back(l);
+                link_remaining[l] = link_capacity[l];
+                link_unfixed[l] = 0;
+            }
+            link_unfixed[l]++;
+        }
+    }
+
+    link_flow_start.assign(link_touched.size() + 1, 0);
+    for ( size_t i = 0; i < link_touched.size(); ++i ) {
+        link_flow_start[i + 1] = link_flow_start[i] + link_unfixed[link_touched[i]];
+    }
+    link_flows.resize(link_flow_start.back());
+    std::vector<int> fill(link_flow_start.begin(), link_flow_start.end() - 1);
+    for ( size_t f = 0; f < flows.size(); ++f ) {
+        for ( int l : flows[f].path->links ) {
+            link_flows[fill[link_index[l]]++] = f;
+        }
+    }
+
+    size_t unfixed = flows.size();
+    while ( unfixed > 0 ) {
+        int bottleneck = -1;
+        double share = 0;
+        for ( size_t i = 0; i < link_touched.size(); ++i ) {
+            int l = link_touched[i];
+            if ( link_unfixed[l] == 0 ) continue;
+            double s = link_remaining[l] / link_unfixed[l];
+            if ( bottleneck == -1 || s < share ) {
+                bottleneck = i;
+                share = s;
+            }
+        }
+        if ( share < 0 ) share = 0;
+
+        for ( int j = link_flow_start[bottleneck]; j < link_flow_start[bottleneck + 1]; ++j ) {
+            Flow& flow = flows[link_flows[j]];
+            if ( flow.fixed ) continue;
+            flow.fixed = true;
+            flow.rate = share;
+            unfixed--;
+            for ( int l : flow.path->links ) {
+                link_remaining[l] -= share;
+                link_unfixed[l]--;
+            }
+        }
+    }
+
+    for ( int l : link_touched ) link_index[l] = -1;
+    link_touched.clear();
+    rate_updates++;
+    solver_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void
+FlowNetwork::scheduleRecompute(SimTime_t now)
+{
+    // Flows that start at the same time share one recompute
+    if ( recompute_pending && recompute_time == now ) return;
+    generation++;
+    recompute_pending = true;
+    recompute_time = now;
+    timer->send(0, new FlowTimerEvent(generation));
+}
+
+void
+FlowNetwork::scheduleNextFinish(SimTime_t now)
+{
+    if ( flows.empty() ) return;
+
+    double next = -1;
+    for ( auto& flow : flows ) {
+        if ( flow.rate <= 0 ) continue;
+        double t = flow.remaining / flow.rate;
+        if ( next < 0 || t < next ) next = t;
+    }
+    if ( next < 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: %zu flows active, but none are making progress\n", flows.size());
+    }
+
+    SimTime_t delay = (SimTime_t)std::ceil(next);
+    if ( delay == 0 ) delay = 1;
+    generation++;
+    timer->send(delay, new FlowTimerEvent(generation));
+}
+
+void
+FlowNetwork::handleTimer(FlowTimerEvent* ev, SimTime_t now)
+{
+    uint64_t gen = ev->generation;
+    delete ev;
+    if ( gen != generation ) return;
+    recompute_pending = false;
+
+    advance(now);
+
+    // Pull out the finished flows before telling anyone, since the
+    // notifications can start new flows
+    std::vector<Flow> done;
+    for ( size_t i = 0; i < flows.size(); ) {
+        if ( flows[i].remaining <= 0.5 ) {
+            done.push_back(flows[i]);
+            flows[i] = flows.back();
+            flows.pop_back();
+        }
+        else {
+            ++i;
+        }
+    }
+
+    for ( auto& flow : done ) {
+        int bits = flow.req->size_in_bits;
+        endpoints[flow.req->dest].nic->deliverFlow(flow.req, flow.vn, flow.start_time, flow.path->latency);
+        flow.src->flowDone(flow.vn, bits);
+    }
+
+    // If a new flow started during the notifications, the rates will
+    // be recomputed by the pending timer
+    if ( recompute_pending ) return;
+
+    solve();
+    scheduleNextFinish(now);
+}
+
+void
+FlowNetwork::printReport(Output& out)
+{
+    out.output("Flow network: %" PRIu64 " flows, %" PRIu64 " rate updates, %zu paths, %.3f s computing rates\n",
+               flows_started, rate_updates, path_cache.size(), solver_seconds);
+}
@@ -0,0 +1,192 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_FLOW_FLOW_NETWORK_H
+#define COMPONENTS_MERLIN_FLOW_FLOW_NETWORK_H
+
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/interfaces/simpleNetwork.h>
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Merlin {
+
+class FlowLinkControl;
+
+// Event used by the flow model to wake itself up when the next flow
+// finishes.  Stale timers are recognized by their generation.
+class FlowTimerEvent : public Event {
+public:
+    uint64_t generation;
+
+    FlowTimerEvent() : Event() {}
+    FlowTimerEvent(uint64_t generation) : Event(), generation(generation) {}
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & generation;
+    }
+
+private:
+    ImplementSerializable(SST::Merlin::FlowTimerEvent)
+};
+
+// Event that carries a completed flow to the destination endpoint
+class FlowDeliveryEvent : public Event {
+public:
+    SST::Interfaces::SimpleNetwork::Request* request;
+    int vn;
+    SimTime_t start_time;
+
+    FlowDeliveryEvent() : Event() {}
+    FlowDeliveryEvent(SST::Interfaces::SimpleNetwork::Request* req, int vn, SimTime_t start) :
+        Event(), request(req), vn(vn), start_time(start) {}
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & request;
+        ser & vn;
+        ser & start_time;
+    }
+
+private:
+    ImplementSerializable(SST::Merlin::FlowDeliveryEvent)
+};
+
+
+/*
+  Shared state for the flow level network model.  Every flow_router
+  registers its topology object and port wiring, and every
+  FlowLinkControl registers itself as an endpoint.  Each send() starts
+  a flow along the path the topology objects choose.  Whenever flows
+  start or finish, link bandwidth is divided among the active flows
+  using max-min fairness, and the next finish time is scheduled.
+
+  Because the bandwidth shares are global, the model only works in a
+  serial simulation.
+*/
+class FlowNetwork {
+
+public:
+    struct PortInfo {
+        Topology::PortState state;
+        int peer;           // Peer router for R2R ports, endpoint ID for R2N ports
+        int peer_port;      // Port on the peer router
+    };
+
+    static FlowNetwork* getInstance();
+
+    void registerRouter(int id, Topology* topo, const std::vector<PortInfo>& ports, int num_vns,
+                        double bw, SimTime_t hop_latency, int flit_size);
+    void registerEndpoint(int id, FlowLinkControl* nic, double bw, Link* timer);
+
+    // Starts a flow for the request.  Ownership of the request passes
+    // to the flow model.
+    void startFlow(FlowLinkControl* src, SST::Interfaces::SimpleNetwork::Request* req, int vn, SimTime_t now);
+
+    void handleTimer(FlowTimerEvent* ev, SimTime_t now);
+
+    void printReport(Output& out);
+
+private:
+    FlowNetwork();
+
+    struct Router {
+        Topology* topo;
+        std::vector<PortInfo> ports;
+        std::vector<int> port_links;    // Link ID for each output port
+        int num_vns;
+        double bw;
+        SimTime_t hop_latency;
+        int flit_size;
+
+        Router() : topo(nullptr), num_vns(0), bw(0), hop_latency(0), flit_size(1) {}
+    };
+
+    struct Endpoint {
+        FlowLinkControl* nic;
+        int router;
+        int port;
+        int inject_link;
+        double bw;
+
+        Endpoint() : nic(nullptr), router(-1), port(-1), inject_link(-1), bw(0) {}
+    };
+
+    struct Path {
+        std::vector<int> links;
+        SimTime_t latency;
+    };
+
+    struct Flow {
+        SST::Interfaces::SimpleNetwork::Request* req;
+        FlowLinkControl* src;
+        int vn;
+        const Path* path;
+        double remaining;       // bits
+        double rate;            // bits per core time unit
+        SimTime_t start_time;
+        bool fixed;
+    };
+
+    std::vector<Router> routers;
+    std::vector<Endpoint> endpoints;
+
+    // Capacity of each directed link in bits per core time unit
+    std::vector<double> link_capacity;
+    int getRouterLink(int rtr, int port);
+
+    std::unordered_map<uint64_t, Path*> path_cache;
+    const Path* getPath(int src, int dest, int vn, int size_in_bits);
+
+    std::vector<Flow> flows;
+    SimTime_t last_update;
+
+    // Scratch space for the solver, indexed by link ID
+    std::vector<double> link_remaining;
+    std::vector<int> link_unfixed;
+    std::vector<int> link_index;
+    std::vector<int> link_touched;
+
+    Link* timer;
+    uint64_t generation;
+    bool recompute_pending;
+    SimTime_t recompute_time;
+
+    // Summary counters
+    uint64_t flows_started;
+    uint64_t rate_updates;
+    double solver_seconds;
+
+    void advance(SimTime_t now);
+    void solve();
+    void scheduleRecompute(SimTime_t now);
+    void scheduleNextFinish(SimTime_t now);
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOW_FLOW_NETWORK_H
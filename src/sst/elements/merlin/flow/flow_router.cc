@@ -0,0 +1,224 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "flow_router.h"
+
+#include "merlin.h"
+
+using namespace SST::Merlin;
+using namespace SST::Interfaces;
+
+flow_router::flow_router(ComponentId_t cid, Params& params) :
+    Component(cid),
+    topo(nullptr)
+{
+    if ( getNumRanks().rank > 1 || getNumRanks().thread > 1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router: the flow network model only runs in serial simulations\n");
+    }
+
+    id = params.find<int>("id",-1);
+    if ( id == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires id to be specified\n");
+    }
+
+    num_ports = params.find<int>("num_ports",-1);
+    if ( num_ports == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires num_ports to be specified\n");
+    }
+
+    num_vns = params.find<int>("num_vns",2);
+    report = params.find<bool>("report",false);
+
+    link_bw = params.find<UnitAlgebra>("link_bw");
+    if ( !link_bw.hasUnits("B/s") && !link_bw.hasUnits("b/s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router: link_bw must be specified in either B/s or b/s (SI prefix also allowed)\n");
+    }
+    if ( link_bw.hasUnits("B/s") ) link_bw *= UnitAlgebra("8b/B");
+
+    UnitAlgebra flit_size_ua = params.find<UnitAlgebra>("flit_size","8B");
+    if ( flit_size_ua.hasUnits("B") ) flit_size_ua *= UnitAlgebra("8b/B");
+    flit_size = flit_size_ua.getRoundedValue();
+
+    UnitAlgebra latency = params.find<UnitAlgebra>("input_latency","0ns");
+    latency += params.find<UnitAlgebra>("output_latency","0ns");
+    latency += params.find<UnitAlgebra>("link_latency","0ns");
+    hop_latency = (latency / getCoreTimeBase()).getRoundedValue();
+
+    topo = loadUserSubComponent<SST::Merlin::Topology>
+        ("topology", ComponentInfo::SHARE_NONE, num_ports, id, num_vns);
+    if ( !topo ) {
+        merlin_abort.fatal(CALL_INFO_LONG, 1, "flow_router requires topology to be specified in input file\n");
+    }
+
+    std::vector<int> vcs_per_vn(num_vns);
+    topo->getVCsPerVN(vcs_per_vn);
+    num_vcs = 0;
+    for ( int vcs : vcs_per_vn ) num_vcs += vcs;
+
+    output_queue_lengths.assign(num_ports * num_vcs, 0);
+    output_credits.assign(num_ports * num_vcs, 0x7FFFFFFF);
+    topo->setOutputBufferCreditArray(output_credits.data(), num_vcs);
+    topo->setOutputQueueLengthsArray(output_queue_lengths.data(), num_vcs);
+
+    ports.resize(num_ports);
+    port_info.resize(num_ports);
+    for ( int i = 0; i < num_ports; i++ ) {
+        std::string port_name("port");
+        port_name += std::to_string(i);
+        ports[i] = configureLink(port_name, "1GHz", new Event::Handler<flow_router>(this,&flow_router::handle_input));
+
+        port_info[i].state = ports[i] == nullptr ? Topology::UNCONNECTED : topo->getPortState(i);
+        port_info[i].peer = -1;
+        port_info[i].peer_port = -1;
+        if ( port_info[i].state == Topology::R2N ) {
+            port_info[i].peer = topo->getEndpointID(i);
+        }
+    }
+}
+
+flow_router::~flow_router()
+{
+    delete topo;
+}
+
+void
+flow_router::init(unsigned int phase)
+{
+    if ( phase == 0 ) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( ports[i] == nullptr ) continue;
+            if ( port_info[i].state == Topology::R2N ) {
+                RtrInitEvent* ev = new RtrInitEvent();
+                ev->command = RtrInitEvent::REPORT_BW;
+                ev->ua_value = link_bw;
+                ports[i]->sendUntimedData(ev);
+
+                ev = new RtrInitEvent();
+                ev->command = RtrInitEvent::REPORT_ID;
+                ev->int_value = port_info[i].peer;
+                ports[i]->sendUntimedData(ev);
+            }
+            else {
+                RtrInitEvent* ev = new RtrInitEvent();
+                ev->command = RtrInitEvent::REPORT_ID;
+                ev->int_value = id;
+                ports[i]->sendUntimedData(ev);
+
+                ev = new RtrInitEvent();
+                ev->command = RtrInitEvent::REPORT_PORT;
+                ev->int_value = i;
+                ports[i]->sendUntimedData(ev);
+            }
+        }
+        return;
+    }
+
+    if ( phase == 1 ) {
+        // Finish the exchange started in phase 0, then hand the
+        // wiring to the flow model
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( ports[i] == nullptr ) continue;
+            if ( port_info[i].state == Topology::R2N ) {
+                Event* ev = ports[i]->recvUntimedData();
+                RtrInitEvent* init_ev = dynamic_cast<RtrInitEvent*>(ev);
+                if ( init_ev == nullptr || init_ev->command != RtrInitEvent::REPORT_BW ) {
+                    merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: endpoint on port %d is not a merlin.flowlinkcontrol\n", id, i);
+                }
+                delete ev;
+            }
+            else {
+                Event* ev = ports[i]->recvUntimedData();
+                RtrInitEvent* init_ev = dynamic_cast<RtrInitEvent*>(ev);
+                if ( init_ev == nullptr || init_ev->command != RtrInitEvent::REPORT_ID ) {
+                    merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: port %d is not connected to a flow_router\n", id, i);
+                }
+                port_info[i].peer = init_ev->int_value;
+                delete ev;
+
+                ev = ports[i]->recvUntimedData();
+                init_ev = static_cast<RtrInitEvent*>(ev);
+                port_info[i].peer_port = init_ev->int_value;
+                delete ev;
+            }
+        }
+
+        double bw = (link_bw * getCoreTimeBase()).getDoubleValue();
+        FlowNetwork::getInstance()->registerRouter(id, topo, port_info, num_vns, bw, hop_latency, flit_size);
+    }
+
+    for ( int i = 0; i < num_ports; i++ ) {
+        if ( ports[i] == nullptr ) continue;
+        Event *ev = nullptr;
+        while ( (ev = ports[i]->recvUntimedData()) != nullptr ) {
+            routeUntimedData(i, ev);
+        }
+    }
+}
+
+void
+flow_router::complete(unsigned int phase)
+{
+    for ( int i = 0; i < num_ports; i++ ) {
+        if ( ports[i] == nullptr ) continue;
+        Event *ev = nullptr;
+        while ( (ev = ports[i]->recvUntimedData()) != nullptr ) {
+            routeUntimedData(i, ev);
+        }
+    }
+}
+
+// Same as the untimed routing in hr_router
+void
+flow_router::routeUntimedData(int port, Event* ev)
+{
+    internal_router_event *ire = dynamic_cast<internal_router_event*>(ev);
+    if ( ire == nullptr ) {
+        ire = topo->process_UntimedData_input(static_cast<RtrEvent*>(ev));
+    }
+    std::vector<int> outPorts;
+    topo->routeUntimedData(port, ire, outPorts);
+    for ( int out : outPorts ) {
+        switch ( port_info[out].state ) {
+        case Topology::R2N:
+            ports[out]->sendUntimedData(ire->getEncapsulatedEvent()->clone());
+            break;
+        case Topology::R2R:
+        case Topology::FAILED: {
+            internal_router_event *new_ire = ire->clone();
+            new_ire->setEncapsulatedEvent(ire->getEncapsulatedEvent()->clone());
+            ports[out]->sendUntimedData(new_ire);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    delete ire;
+}
+
+void
+flow_router::handle_input(Event* ev)
+{
+    merlin_abort.fatal(CALL_INFO, -1, "flow_router %d: received an event during the run\n", id);
+}
+
+void
+flow_router::finish()
+{
+    if ( report && id == 0 ) {
+        FlowNetwork::getInstance()->printReport(getSimulationOutput());
+    }
+}
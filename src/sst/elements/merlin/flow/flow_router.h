@@ -0,0 +1,109 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_FLOW_FLOW_ROUTER_H
+#define COMPONENTS_MERLIN_FLOW_FLOW_ROUTER_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/params.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+#include "flow_network.h"
+
+namespace SST {
+namespace Merlin {
+
+// Stand-in for hr_router when using the flow level network model.  It
+// loads the same topology object and is wired the same way, but only
+// takes part in init: it learns who is on the other side of each
+// port, registers its topology and wiring with the FlowNetwork, and
+// routes untimed data.  No events pass through it during the run.
+class flow_router : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        flow_router,
+        "merlin",
+        "flow_router",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Router for the flow level network model.  Use with merlin.flowlinkcontrol.",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"id",              "ID of the router."},
+        {"num_ports",       "Number of ports that the router has"},
+        {"num_vns",         "Number of requested virtual networks", "2"},
+        {"link_bw",         "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"flit_size",       "Flit size specified in either b or B (can include SI prefix).  Only used to size the packets handed to the topology."},
+        {"input_latency",   "Latency of packets entering the router.  Added to the path latency of each flow.", "0ns"},
+        {"output_latency",  "Latency of packets leaving the router.  Added to the path latency of each flow.", "0ns"},
+        {"link_latency",    "Latency of the links leaving the router.  Added to the path latency of each flow.", "0ns"},
+        {"report",          "If true, router 0 prints a summary of the flow model at the end of the simulation.", "false"}
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port%(num_ports)d",  "Ports which connect to endpoints or other routers.", { "merlin.RtrEvent", "merlin.internal_router_event", "merlin.RtrInitEvent"} }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"topology", "Topology object used to find the path of each flow", "SST::Merlin::Topology"}
+    )
+
+private:
+    int id;
+    int num_ports;
+    int num_vns;
+    int num_vcs;
+    bool report;
+
+    UnitAlgebra link_bw;
+    int flit_size;
+    SimTime_t hop_latency;
+
+    Topology* topo;
+    std::vector<Link*> ports;
+    std::vector<FlowNetwork::PortInfo> port_info;
+
+    // The topology sees empty output queues and full credits, so
+    // adaptive routing falls back to its minimal choice
+    std::vector<int> output_queue_lengths;
+    std::vector<int> output_credits;
+
+    void routeUntimedData(int port, Event* ev);
+    void handle_input(Event* ev);
+
+public:
+    flow_router(ComponentId_t cid, Params& params);
+    ~flow_router();
+
+    void init(unsigned int phase);
+    void complete(unsigned int phase);
+    void setup() {}
+    void finish();
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOW_FLOW_ROUTER_H
@@ -26,6 +26,7 @@
 #include <signal.h>
 
 #include "merlin.h"
+#include "sst/elements/merlin/topology/table.h"
 
 using namespace SST::Merlin;
 using namespace SST::Interfaces;
@@ -138,6 +139,14 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
 
     // Get the number of VNs
     num_vns = params.find<int>("num_vns",2);
+
+    dump_route_table = params.find<std::string>("dump_route_table","");
+    dump_route_table_endpoints = params.find<int>("dump_route_table_endpoints",0);
+    dump_route_table_samples = params.find<int>("dump_route_table_samples",1);
+    if ( dump_route_table != "" && dump_route_table_endpoints <= 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "hr_router requires dump_route_table_endpoints to be specified with dump_route_table\n");
+    }
+    if ( dump_route_table_samples < 1 ) dump_route_table_samples = 1;
     vcs_per_vn.resize(num_vns);
 
     // Get the topology
@@ -449,6 +458,97 @@ void hr_router::setup()
     for ( int i = 0; i < num_ports; i++ ) {
     	ports[i]->setup();
     }
+
+    if ( dump_route_table != "" ) dumpRouteTable();
+}
+
+// Writes one router section of a merlin.table file (see
+// topology/table.h) with the routes the topology object chooses for a
+// packet injected at this router.
+void
+hr_router::dumpRouteTable()
+{
+    int num_endpoints = dump_route_table_endpoints;
+
+    // Route as if injected from the first host port.  Routers without
+    // endpoints route as if the packet arrived on port 0.
+    int inject_port = 0;
+    for ( int i = 0; i < num_ports; i++ ) {
+        if ( topo->isHostPort(i) ) {
+            inject_port = i;
+            break;
+        }
+    }
+    int local_src = topo->isHostPort(inject_port) ? topo->getEndpointID(inject_port) : 0;
+
+    std::vector<table_port_info> port_info(num_ports);
+    for ( int i = 0; i < num_ports; i++ ) {
+        switch ( topo->getPortState(i) ) {
+        case Topology::R2N:
+            port_info[i].type = TABLE_PORT_HOST;
+            port_info[i].id = topo->getEndpointID(i);
+            port_info[i].peer_port = -1;
+            break;
+        case Topology::R2R:
+        case Topology::FAILED: {
+            std::pair<int,int> remote = ports[i]->getRemotePort();
+            port_info[i].type = TABLE_PORT_ROUTER;
+            port_info[i].id = remote.first;
+            port_info[i].peer_port = remote.second;
+            break;
+        }
+        default:
+            port_info[i].type = TABLE_PORT_UNCONNECTED;
+            port_info[i].id = -1;
+            port_info[i].peer_port = -1;
+            break;
+        }
+    }
+
+    std::vector<uint32_t> entry_start;
+    std::vector<table_candidate> candidates;
+    for ( int dest = 0; dest < num_endpoints; dest++ ) {
+        entry_start.push_back(candidates.size());
+        for ( int s = 0; s < dump_route_table_samples; s++ ) {
+            int src = s == 0 ? local_src : (int)(((int64_t)s * num_endpoints) / dump_route_table_samples);
+
+            SimpleNetwork::Request* req = new SimpleNetwork::Request(dest, src, 64, true, true);
+            RtrEvent* ev = new RtrEvent(req, src, 0);
+            ev->computeSizeInFlits(64);
+            internal_router_event* ire = topo->process_input(ev);
+            topo->route_packet(inject_port, ire->getVC(), ire);
+
+            table_candidate cand;
+            cand.port = ire->getNextPort();
+            // The table has no notion of the topology's VC rules, so
+            // use hop count VCs between routers
+            cand.vc = topo->isHostPort(cand.port) ? TABLE_VC_SAME : TABLE_VC_HOP;
+            delete ire;
+
+            bool found = false;
+            for ( size_t i = entry_start.back(); i < candidates.size(); i++ ) {
+                if ( candidates[i].port == cand.port ) found = true;
+            }
+            if ( !found ) candidates.push_back(cand);
+        }
+    }
+    entry_start.push_back(candidates.size());
+
+    std::string filename = dump_route_table + "." + std::to_string(id);
+    FILE* fp = fopen(filename.c_str(), "wb");
+    if ( fp == NULL ) {
+        merlin_abort.fatal(CALL_INFO, -1, "hr_router: unable to open %s for writing\n", filename.c_str());
+    }
+    // The file is little-endian (see topology/table.h)
+    uint32_t table_ports = table_le((uint32_t)num_ports);
+    for ( auto& info : port_info ) table_le(info);
+    for ( auto& start : entry_start ) start = table_le(start);
+    for ( auto& cand : candidates ) table_le(cand);
+    fwrite(&table_ports, sizeof(table_ports), 1, fp);
+    fwrite(port_info.data(), sizeof(table_port_info), port_info.size(), fp);
+    fwrite(entry_start.data(), sizeof(uint32_t), entry_start.size(), fp);
+    fwrite(candidates.data(), sizeof(table_candidate), candidates.size(), fp);
+    fclose(fp);
 }
 
 void hr_router::finish()
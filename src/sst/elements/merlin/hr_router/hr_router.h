@@ -68,7 +68,12 @@ public:
         {"num_vns",            "Number of VNs.","2"},
         {"vn_remap",           "Array that specifies the vn remapping for each node in the systsm."},
         {"vn_remap_shm",       "Name of shared memory region for vn remapping.  If empty, no remapping is done", ""},
-        {"debug",              "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"}
+        {"debug",              "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"},
+        {"dump_route_table",   "If set, each router writes the routes chosen by its topology to <value>.<router id> during setup.  "
+                               "Combine the files with merlin/tools/merlin_table.py to get a table for merlin.table.", ""},
+        {"dump_route_table_endpoints", "Number of endpoints in the network.  Required if dump_route_table is set.", "0"},
+        {"dump_route_table_samples",   "Number of source endpoints to route from for each destination when dumping routes.  "
+                                       "Use more than one to capture multipath choices that depend on the source.", "1"}
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -137,6 +142,11 @@ private:
 
     Shared::SharedArray<int> shared_array;
 
+    std::string dump_route_table;
+    int dump_route_table_endpoints;
+    int dump_route_table_samples;
+    void dumpRouteTable();
+
 public:
     hr_router(ComponentId_t cid, Params& params);
     ~hr_router();
@@ -341,6 +341,8 @@ public:
     void dumpState(std::ostream& stream);
     void printStatus(Output& out, int out_port_busy, int in_port_busy);
 
+    std::pair<int,int> getRemotePort() { return std::make_pair(remote_rtr_id, remote_port_number); }
+
 	bool decreaseLinkWidth();
 	bool increaseLinkWidth();
 
@@ -34,8 +34,13 @@ class LinkControl(NetworkInterface):
             sst.addGlobalParam(set_name,"job_size",job_size)
             sst.addGlobalParam(set_name,"use_nid_remap",use_nid_remap)
 
+        # Endpoints go with the router they attach to
+        placeComponent(comp)
 
-        sub = comp.setSubComponent(slot,"merlin.linkcontrol",slot_num)
+        if getNetworkFidelity() == "flow":
+            sub = comp.setSubComponent(slot,"merlin.flowlinkcontrol",slot_num)
+        else:
+            sub = comp.setSubComponent(slot,"merlin.linkcontrol",slot_num)
         self._applyStatisticsSettings(sub)
         sub.addGlobalParamSet("params_%s"%self._instance_name)
         sub.addParam("logical_nid",logical_nid)
@@ -68,6 +73,7 @@ class ReorderLinkControl(NetworkInterface):
         self.network_interface = interface
 
     def build(self,comp,slot,slot_num,job_id,job_size,nid,use_nid_map = False, link = None):
+        placeComponent(comp)
         sub = comp.setSubComponent(slot,"merlin.reorderlinkcontrol",slot_num)
         #self._applyStatisticsSettings(sub)
         #sub.addParams(self._params)
@@ -30,6 +30,14 @@ ReorderLinkControl::ReorderLinkControl(ComponentId_t cid, Params &params, int vn
     receiveFunctor(NULL),
     vns(vns)
 {
+    // Round the window up to a power of 2 so the slot is a mask
+    uint32_t requested = params.find<uint32_t>("window_size", 64);
+    window_size = 1;
+    while ( window_size < requested ) window_size <<= 1;
+
+    reorder_occupancy = registerStatistic<uint64_t>("reorder_occupancy");
+    reorder_peak_occupancy = registerStatistic<uint64_t>("reorder_peak_occupancy");
+
     if ( isUser() ) {
         // Need to see if the network_if was loaded as a user subcomponent
         link_control = loadUserSubComponent<SimpleNetwork>("networkIF", ComponentInfo::SHARE_NONE, vns);
@@ -110,7 +118,14 @@ void ReorderLinkControl::finish(void)
     //     }
     // }
 
-    // TODO: Need to delete reordered data as well
+    for ( auto& info : reorder_info ) {
+        if ( info.peak > 0 ) reorder_peak_occupancy->addData(info.peak);
+        for ( auto& req : info.window ) {
+            delete req;
+            req = nullptr;
+        }
+        info.count = 0;
+    }
 
     link_control->finish();
 }
@@ -125,14 +140,7 @@ bool ReorderLinkControl::send(SimpleNetwork::Request* req, int vn) {
     delete req;
 
     // Need to put in the sequence number
-
-    // See if we already have reorder_info for this dest
-    if ( reorder_info.find(my_req->dest) == reorder_info.end() ) {
-        ReorderInfo* info = new ReorderInfo();
-        reorder_info[my_req->dest] = info;
-    }
-    ReorderInfo* info = reorder_info[my_req->dest];
-    my_req->seq = info->send++;
+    my_req->seq = getReorderInfo(my_req->dest).send++;
 
     // // To test, just going to switch order
     // uint32_t my_seq = info->send % 2 == 0 ? info->send + 1 : info->send - 1;
@@ -207,26 +215,17 @@ bool ReorderLinkControl::handle_event(int vn) {
 
     // std::cout << id << ": recieved packet with sequence number " << my_req->seq << std::endl;
 
-    if ( reorder_info.find(my_req->src) == reorder_info.end() ) {
-        ReorderInfo* info = new ReorderInfo();
-        reorder_info[my_req->src] = info;
-    }
-
-    ReorderInfo* info = reorder_info[my_req->src];
+    ReorderInfo& info = getReorderInfo(my_req->src);
 
-    // See if this is the expected sequence number, if not, put it
-    // into the ReorderInfo.queue.
-    if ( my_req->seq == info->recv ) {
+    // See if this is the expected sequence number, if not, hold it in
+    // the window until the ones before it arrive.
+    if ( my_req->seq == info.recv ) {
         input_buf[vn].push(my_req);
-        info->recv++;
+        info.recv++;
         // Need to also see if we have any other fragments which are
         // now ready to be delivered
-        my_req = info->queue.top();
-        while ( my_req->seq == info->recv ) {
+        while ( (my_req = info.next()) != nullptr ) {
             input_buf[vn].push(my_req);
-            info->queue.pop();
-            my_req = info->queue.top();
-            info->recv++;
         }
 
         // If there is a recv functor, need to notify parent
@@ -240,8 +239,13 @@ bool ReorderLinkControl::handle_event(int vn) {
         }
 
     }
+    else if ( info.insert(my_req, window_size) ) {
+        reorder_occupancy->addData(info.count);
+    }
     else {
-        info->queue.push(my_req);
+        merlin_abort.fatal(CALL_INFO, 1, "ReorderLinkControl: received sequence number %u from endpoint %" PRIi64
+                           ", which was already delivered or is already held (next expected is %u)\n",
+                           my_req->seq, my_req->src, info.recv);
     }
 
     return true;
@@ -27,7 +27,7 @@
 #include "sst/elements/merlin/router.h"
 
 #include <queue>
-#include <unordered_map>
+#include <vector>
 
 namespace SST {
 
@@ -64,19 +64,6 @@ public:
 
     ~ReorderRequest() {}
 
-
-    // This is here just for the priority_queue insertion, so is
-    // sorting based on what comes out of queue first (i.e. lowest
-    // number, which makes this look backwards)
-    class Priority {
-    public:
-        bool operator()(ReorderRequest* const& lhs, ReorderRequest* const& rhs) {
-            return lhs->seq > rhs->seq;
-        }
-    };
-
-    typedef std::priority_queue<ReorderRequest*, std::vector<ReorderRequest*>, Priority> PriorityQueue;
-
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         SST::Interfaces::SimpleNetwork::Request::serialize_order(ser);
         ser & seq;
@@ -88,22 +75,73 @@ private:
 
 
 
+// Reorder state for one remote endpoint.  Out of order requests are
+// held in a circular window indexed by (seq mod window size), so
+// inserting a request and draining the requests that are now in order
+// are both O(1).  Sequence numbers are compared as distances from
+// recv, so they can wrap.  The window is only allocated once a
+// request arrives out of order, and is doubled if a request arrives
+// too far ahead of recv to fit.
 struct ReorderInfo {
     uint32_t send;
     uint32_t recv;
-    ReorderRequest::PriorityQueue queue;
+    // Number of requests held in window and the most ever held
+    uint32_t count;
+    uint32_t peak;
+    uint32_t mask;
+    std::vector<ReorderRequest*> window;
 
     ReorderInfo() :
         send(0),
-        recv(0)
-    {
-        // Put a dummy entry into queue to avoid checks for NULL later
-        // on when looking for fragments to deliver.  This does mean
-        // we can't handle more than 4 billion fragments to each host
-        // with overflow.
-        ReorderRequest* req = new ReorderRequest();
-        req->seq = 0xffffffff;
-        queue.push(req);
+        recv(0),
+        count(0),
+        peak(0),
+        mask(0)
+    {}
+
+    void initWindow(uint32_t size) {
+        window.assign(size, nullptr);
+        mask = size - 1;
+    }
+
+    void grow(uint32_t distance, uint32_t initial_size) {
+        uint32_t size = window.empty() ? initial_size : window.size();
+        while ( distance >= size ) size *= 2;
+        std::vector<ReorderRequest*> old;
+        old.swap(window);
+        initWindow(size);
+        for ( ReorderRequest* req : old ) {
+            if ( req != nullptr ) window[req->seq & mask] = req;
+        }
+    }
+
+    // Holds a request that arrived ahead of recv.  Returns false,
+    // without holding it, if seq is not ahead of recv (it was already
+    // delivered) or a request with the same seq is already held.
+    bool insert(ReorderRequest* req, uint32_t initial_size) {
+        uint32_t distance = req->seq - recv;
+        // Distances of 2^31 or more are sequence numbers behind recv;
+        // growing the window to fit them would never terminate
+        if ( distance == 0 || distance >= 0x80000000u ) return false;
+        if ( distance >= window.size() ) grow(distance, initial_size);
+        ReorderRequest*& slot = window[req->seq & mask];
+        if ( slot != nullptr ) return false;
+        slot = req;
+        if ( ++count > peak ) peak = count;
+        return true;
+    }
+
+    // Returns the held request with sequence number recv, or nullptr
+    // if it hasn't arrived yet.  Advances recv on success.
+    ReorderRequest* next() {
+        if ( count == 0 ) return nullptr;
+        ReorderRequest*& slot = window[recv & mask];
+        ReorderRequest* req = slot;
+        if ( req == nullptr ) return nullptr;
+        slot = nullptr;
+        count--;
+        recv++;
+        return req;
     }
 };
 
@@ -125,7 +163,13 @@ public:
 
     SST_ELI_DOCUMENT_PARAMS(
         {"rlc.networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"},
-        {"networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"}
+        {"networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"},
+        {"window_size","Initial number of out of order packets that can be held for each source.  Rounded up to a power of 2.  The window grows if a packet arrives too far ahead.", "64"}
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "reorder_occupancy", "Number of packets held for reordering from the same source, recorded each time a packet is held", "packets", 1},
+        { "reorder_peak_occupancy", "Most packets held for reordering at once, recorded at the end of the simulation for each source that sent to this endpoint", "packets", 1},
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -146,7 +190,13 @@ private:
     UnitAlgebra link_bw;
     int id;
 
-    std::unordered_map<SST::Interfaces::SimpleNetwork::nid_t, ReorderInfo*> reorder_info;
+    // Indexed by endpoint id, used as destination on send and as
+    // source on receive
+    std::vector<ReorderInfo> reorder_info;
+    uint32_t window_size;
+
+    Statistic<uint64_t>* reorder_occupancy;
+    Statistic<uint64_t>* reorder_peak_occupancy;
 
     // One buffer for each virtual network.  At the NIC level, we just
     // provide a virtual channel abstraction.  Don't need output
@@ -200,6 +250,13 @@ public:
 
 private:
 
+    inline ReorderInfo& getReorderInfo(SST::Interfaces::SimpleNetwork::nid_t nid) {
+        if ( nid >= (SST::Interfaces::SimpleNetwork::nid_t)reorder_info.size() ) {
+            reorder_info.resize(nid + 1);
+        }
+        return reorder_info[nid];
+    }
+
     bool handle_event(int vn);
 };
 
@@ -18,12 +18,65 @@
 import sst
 import random
 import copy
+import os
 import re
 from collections import deque
 
 # Need import_module to load platform files
 from importlib import import_module
 
+# Network fidelity used when building routers and network interfaces.
+# "packet" uses hr_router and LinkControl.  "flow" uses flow_router and
+# FlowLinkControl, which model bandwidth sharing between messages
+# without simulating individual packets.  Can also be set with the
+# SST_MERLIN_FIDELITY environment variable so existing configurations
+# can be switched without editing them.
+_network_fidelity = os.environ.get("SST_MERLIN_FIDELITY", "packet")
+
+def setNetworkFidelity(fidelity):
+    global _network_fidelity
+    if fidelity not in ("packet", "flow"):
+        print("setNetworkFidelity: unknown fidelity %s, must be packet or flow"%fidelity)
+        sst.exit()
+    _network_fidelity = fidelity
+
+def getNetworkFidelity():
+    return _network_fidelity
+
+
+# Partition aware placement.  When enabled (with
+# Topology.setPartition() or by setting the SST_MERLIN_PARTITION
+# environment variable to 1), the topologies that support it assign
+# each router and the endpoints attached to it a rank and thread along
+# natural boundaries of the topology (dragonfly groups, fat tree pods,
+# slices of the last dimension of a mesh, torus or HyperX) and switch
+# SST to the sst.self partitioner.  Components created by jobs outside
+# of the network interface (e.g. memory components of an endpoint)
+# need to be placed by the job using placeComponent().
+_partition_from_env = os.environ.get("SST_MERLIN_PARTITION", "0") not in ("", "0")
+
+# (rank, thread) of the router currently being built, or None if
+# placement is not being done
+_current_placement = None
+
+def getCurrentPlacement():
+    return _current_placement
+
+# Puts comp on the rank and thread of the router currently being built
+def placeComponent(comp):
+    if _current_placement and isinstance(comp, sst.Component):
+        comp.setRank(_current_placement[0], _current_placement[1])
+
+_latency_units = { "s" : 1.0, "ms" : 1e-3, "us" : 1e-6, "ns" : 1e-9, "ps" : 1e-12, "fs" : 1e-15 }
+
+def _latencyInSeconds(latency):
+    m = re.match(r"\s*([0-9.eE+-]+)\s*([munpf]?s)\s*$", str(latency))
+    if not m:
+        print("Unable to parse latency %s, must be a time such as 20ns"%latency)
+        sst.exit()
+    return float(m.group(1)) * _latency_units[m.group(2)]
+
+
 class PlatformDefinition:
 
     _platforms = dict()
@@ -616,6 +669,14 @@ class Topology(TemplateBase):
         self.endPointLinks = []
         self.built = False
 
+        # Partition aware placement state, see setPartition()
+        self._addDirectAttribute("_partition",None)
+        self._addDirectAttribute("_cut_link_latency",None)
+        self._addDirectAttribute("_placement",dict())
+        self._addDirectAttribute("_router_links",[])
+        if _partition_from_env:
+            self.setPartition()
+
     def _network_name_callback(self, variable_name, value):
         self._lockVariable(variable_name)
 
@@ -631,11 +692,119 @@ class Topology(TemplateBase):
     # function.  If you want to control this yourself, overload the
     # build() function.
     def build(self, endpoint):
+        global _current_placement
         sst.pushNamePrefix(self.network_name)
         self._build_impl(endpoint)
         sst.popNamePrefix()
+        _current_placement = None
+        self._finishPartition()
     def _build_impl(self, endpoint):
         pass
+
+    # Place routers and their endpoints on ranks and threads along the
+    # natural boundaries of the topology.  ranks and threads default to
+    # the values sst was started with.  If cut_link_latency is set,
+    # links that cross a partition boundary get at least this latency,
+    # which sets the lookahead of the parallel simulation.  Must be
+    # called before build().
+    def setPartition(self, ranks=None, threads=None, cut_link_latency=None):
+        if ranks is None: ranks = sst.getMPIRankCount()
+        if threads is None: threads = sst.getThreadCount()
+        self._partition = (int(ranks), int(threads))
+        self._cut_link_latency = cut_link_latency
+
+    # Topologies that support placement override this to return
+    # (block, num_blocks, index, block_size) for the router: the
+    # natural block the router belongs to, the number of blocks, the
+    # position of the router in the block and the number of routers in
+    # each block.  Return block = None for routers that are shared
+    # between blocks (e.g. fat tree core routers).  Returns None if
+    # placement is not supported.
+    def _getPartitionBlock(self, rtr_id):
+        return None
+
+    def _getPlacement(self, rtr_id):
+        ranks, threads = self._partition
+        parts = ranks * threads
+        info = self._getPartitionBlock(rtr_id)
+        if info is None:
+            print("%s: partition aware placement is not supported, leaving placement to the partitioner"%self.getName())
+            self._partition = None
+            return None
+        block, num_blocks, index, block_size = info
+        if block is None:
+            # Shared routers are spread round robin
+            part = rtr_id % parts
+        elif num_blocks >= parts:
+            # Keep whole blocks together
+            part = block * parts // num_blocks
+        else:
+            # Fewer blocks than partitions, split each block into
+            # contiguous pieces
+            part = (block * block_size + index) * parts // (num_blocks * block_size)
+        return (part // threads, part % threads)
+
+    # Sets the placement used for the router and the endpoints built
+    # after this call.  _instanceRouter() calls this, topologies that
+    # build endpoints before their router need to call it first.
+    def _setPlacement(self, rtr_id):
+        global _current_placement
+        if not self._partition:
+            return
+        if rtr_id not in self._placement:
+            placement = self._getPlacement(rtr_id)
+            if placement is None: return
+            self._placement[rtr_id] = placement
+            sst.setProgramOption("partitioner", "sst.self")
+        _current_placement = self._placement[rtr_id]
+
+    # Topologies that support placement use this instead of
+    # rtr.addLink() for router to router links so that links cut by
+    # the partition can be counted and given cut_link_latency
+    def _addRouterLink(self, rtr, rtr_id, link, port_name, latency):
+        if not self._partition:
+            rtr.addLink(link, port_name, latency)
+            return
+        self._router_links.append((rtr, rtr_id, link, port_name, latency))
+
+    def _finishPartition(self):
+        if not self._partition or not self._placement:
+            return
+
+        ends = dict()
+        for entry in self._router_links:
+            ends.setdefault(id(entry[2]), []).append(entry)
+
+        total = 0
+        cut_rank = 0
+        cut_thread = 0
+        lookahead = None
+        for link_ends in ends.values():
+            latency = link_ends[0][4]
+            cut = False
+            if len(link_ends) == 2:
+                total += 1
+                a = self._placement[link_ends[0][1]]
+                b = self._placement[link_ends[1][1]]
+                if a[0] != b[0]:
+                    cut_rank += 1
+                    cut = True
+                elif a[1] != b[1]:
+                    cut_thread += 1
+                    cut = True
+            if cut:
+                if self._cut_link_latency and _latencyInSeconds(self._cut_link_latency) > _latencyInSeconds(latency):
+                    latency = self._cut_link_latency
+                if lookahead is None or _latencyInSeconds(latency) < _latencyInSeconds(lookahead):
+                    lookahead = latency
+            for (rtr, rtr_id, link, port_name, lat) in link_ends:
+                rtr.addLink(link, port_name, latency)
+
+        ranks, threads = self._partition
+        print("%s: placed %d routers on %d ranks x %d threads, %d of %d router links cut (%d between ranks, %d between threads), lookahead %s"%
+              (self.getName(), len(self._placement), ranks, threads, cut_rank + cut_thread, total,
+               cut_rank, cut_thread, lookahead if lookahead else "unlimited"))
+        self._router_links = []
     def getEndPointLinks(self):
         pass
     def getNumNodes(self):
@@ -645,7 +814,16 @@ class Topology(TemplateBase):
     def findRouterById(self,rtr_id):
         return sst.findComponentByName(self.getRouterNameForId(rtr_id))
     def _instanceRouter(self,radix,rtr_id):
-        return self.router.instanceRouter(self.getRouterNameForId(rtr_id), radix, rtr_id)
+        self._setPlacement(rtr_id)
+        rtr = self.router.instanceRouter(self.getRouterNameForId(rtr_id), radix, rtr_id)
+        placeComponent(rtr)
+        if getNetworkFidelity() == "flow":
+            # The flow model adds link latency to the path latency
+            try:
+                if self.link_latency: rtr.addParam("link_latency",self.link_latency)
+            except KeyError:
+                pass
+        return rtr
 
 class NetworkInterface(TemplateBase):
     def __init__(self):
@@ -695,6 +873,8 @@ class NetworkInterface(TemplateBase):
     @staticmethod
     def _instanceNetworkInterfaceBackCompat(
             netif,comp,slot,slot_num,job_id,job_size,logical_nid,use_nid_remap,link):
+        # Endpoints go with the router they attach to
+        placeComponent(comp)
         if not link:
             # If link is None, then we are using the old method.
             # This will return (subcomp, port_name)
@@ -826,7 +1006,8 @@ class hr_router(RouterTemplate):
         RouterTemplate.__init__(self)
 
         self._declareParams("params",["link_bw","flit_size","xbar_bw","input_latency","output_latency","input_buf_size","output_buf_size",
-                                      "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm"])
+                                      "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm",
+                                      "dump_route_table","dump_route_table_endpoints","dump_route_table_samples"])
 
         self._declareParams("params",["qos_settings"],"portcontrol.arbitration.")
         self._declareParams("params",["output_arb", "enable_congestion_management", "cm_outstanding_threshold", "cm_incast_threshold"],"portcontrol.")
@@ -848,7 +1029,10 @@ class hr_router(RouterTemplate):
         if self._check_first_build():
             sst.addGlobalParams("%s_params"%self._instance_name, self._getGroupParams("params"))
 
-        rtr = sst.Component(name, "merlin.hr_router")
+        if getNetworkFidelity() == "flow":
+            rtr = sst.Component(name, "merlin.flow_router")
+        else:
+            rtr = sst.Component(name, "merlin.hr_router")
         self._applyStatisticsSettings(rtr)
         rtr.addGlobalParamSet("%s_params"%self._instance_name)
         rtr.addParam("num_ports",radix)
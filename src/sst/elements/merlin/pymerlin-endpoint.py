@@ -70,6 +70,28 @@ class OfferedLoadJob(Job):
         return (networkif, port_name)
 
 
+class TraceReplayJob(Job):
+    def __init__(self,job_id,size):
+        Job.__init__(self,job_id,size)
+        self._declareParams("main",["trace","num_vns","packet_size","lookahead","time_scale","report"])
+
+    def getName(self):
+        return "Trace Replay Job"
+
+    def build(self, nID, extraKeys, link = None):
+        nic = sst.Component("trace_replay_%d"%nID, "merlin.trace_replay")
+        self._applyStatisticsSettings(nic)
+        nic.addParams(self._getGroupParams("main"))
+        nic.addParams(extraKeys)
+        # Trace node ids are logical ids
+        id = self._nid_map[nID]
+        nic.addParam("id", id)
+
+        #  Add the linkcontrol
+        return NetworkInterface._instanceNetworkInterfaceBackCompat(
+            self.network_interface,nic,"networkIF",0,self.job_id,self.size,id,True,link)
+
+
 class IncastJob(Job):
     def __init__(self,job_id,size):
         Job.__init__(self,job_id,size)
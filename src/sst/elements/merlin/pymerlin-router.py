@@ -23,7 +23,8 @@ class hr_router(RouterTemplate):
     def __init__(self):
         RouterTemplate.__init__(self)
         self._declareParams("params",["link_bw","flit_size","xbar_bw","input_latency","output_latency","input_buf_size","output_buf_size",
-                                      "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm"])
+                                      "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm",
+                                      "dump_route_table","dump_route_table_endpoints","dump_route_table_samples"])
 
         self._declareParams("params",["qos_settings"],"portcontrol.arbitration.")
         self._declareParams("params",["output_arb"],"portcontrol.")
@@ -37,7 +38,10 @@ class hr_router(RouterTemplate):
         if not self.output_arb: self.output_arb = "merlin.arb.output.qos.multi"
         
     def instanceRouter(self, name, radix, rtr_id):
-        rtr = sst.Component(name, "merlin.hr_router")
+        if getNetworkFidelity() == "flow":
+            rtr = sst.Component(name, "merlin.flow_router")
+        else:
+            rtr = sst.Component(name, "merlin.hr_router")
         self._applyStatisticsSettings(rtr)
         rtr.addParams(self._getGroupParams("params"))
         rtr.addParam("num_ports",radix)
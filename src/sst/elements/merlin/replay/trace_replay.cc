@@ -0,0 +1,345 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "replay/trace_replay.h"
+
+#include <string.h>
+
+#include <sst/core/params.h>
+#include <sst/core/unitAlgebra.h>
+
+using namespace SST::Merlin;
+using namespace SST::Interfaces;
+
+std::string
+TraceReader::open(const std::string& filename, int node, size_t lookahead_records)
+{
+    lookahead = lookahead_records > 0 ? lookahead_records : 1;
+
+    fp = fopen(filename.c_str(), "rb");
+    if ( fp == nullptr ) return "unable to open " + filename;
+
+    trace_file_header header;
+    if ( fread(&header, sizeof(header), 1, fp) != 1 ||
+         strncmp(header.magic, TRACE_FILE_MAGIC, sizeof(header.magic)) != 0 ) {
+        return filename + " is not a merlin trace file";
+    }
+    header.version = trace_le(header.version);
+    header.num_nodes = trace_le(header.num_nodes);
+    if ( header.version != TRACE_FILE_VERSION ) {
+        return filename + " has version " + std::to_string(header.version) +
+            ", expected " + std::to_string(TRACE_FILE_VERSION);
+    }
+
+    // Nodes past the end of the trace neither send nor receive
+    if ( node >= (int)header.num_nodes ) return "";
+
+    trace_node_index index;
+    if ( fseek(fp, sizeof(header) + node * sizeof(index), SEEK_SET) != 0 ||
+         fread(&index, sizeof(index), 1, fp) != 1 ||
+         fseek(fp, trace_le(index.offset), SEEK_SET) != 0 ) {
+        return filename + " is truncated";
+    }
+    remaining = trace_le(index.num_records);
+    num_recv = trace_le(index.num_recv);
+    return "";
+}
+
+bool
+TraceReader::fill()
+{
+    if ( remaining == 0 ) return false;
+    size_t count = remaining < lookahead ? remaining : lookahead;
+    buffer.resize(count);
+    size_t got = fread(buffer.data(), sizeof(trace_record), count, fp);
+    buffer.resize(got);
+    pos = 0;
+    if ( got == 0 ) {
+        remaining = 0;
+        return false;
+    }
+    remaining -= got;
+    return true;
+}
+
+
+TraceReplay::TraceReplay(ComponentId_t cid, Params& params) :
+    Component(cid),
+    waiting_for_send(false),
+    have_next(false),
+    next_time(0),
+    next_msg_id(0),
+    messages_sent(0),
+    messages_recd(0),
+    expected_recv(0),
+    done(false),
+    out(getSimulationOutput())
+{
+    id = params.find<int>("id",-1);
+    if ( id == -1 ) {
+        out.fatal(CALL_INFO, -1, "%s: id must be set!\n", getName().c_str());
+    }
+
+    std::string trace = params.find<std::string>("trace");
+    if ( trace.empty() ) {
+        out.fatal(CALL_INFO, -1, "%s: trace must be set!\n", getName().c_str());
+    }
+
+    num_vns = params.find<int>("num_vns",1);
+    if ( num_vns < 1 || num_vns > TRACE_VN_MASK + 1 ) {
+        out.fatal(CALL_INFO, -1, "%s: num_vns must be between 1 and %d\n", getName().c_str(), TRACE_VN_MASK + 1);
+    }
+
+    UnitAlgebra pkt_size = params.find<UnitAlgebra>("packet_size","2kB");
+    if ( pkt_size.hasUnits("B") ) pkt_size *= UnitAlgebra("8b/B");
+    if ( !pkt_size.hasUnits("b") ) {
+        out.fatal(CALL_INFO, -1, "%s: packet_size must be specified in either b or B\n", getName().c_str());
+    }
+    packet_bits = pkt_size.getRoundedValue();
+
+    time_scale = params.find<double>("time_scale",1.0);
+    report = params.find<bool>("report",false);
+
+    std::string error = reader.open(trace, id, params.find<size_t>("lookahead",1024));
+    if ( !error.empty() ) {
+        out.fatal(CALL_INFO, -1, "%s: %s\n", getName().c_str(), error.c_str());
+    }
+    expected_recv = reader.getNumRecv();
+
+    // First see if the network interface is defined in the python
+    link_if = loadUserSubComponent<SST::Interfaces::SimpleNetwork>
+        ("networkIF", ComponentInfo::SHARE_NONE, num_vns);
+
+    if ( !link_if ) {
+        // Not in python, just load the default
+        Params if_params;
+
+        if_params.insert("link_bw",params.find<std::string>("link_bw"));
+        if_params.insert("input_buf_size",params.find<std::string>("buffer_size","1kB"));
+        if_params.insert("output_buf_size",params.find<std::string>("buffer_size","1kB"));
+        if_params.insert("port_name","rtr");
+
+        link_if = loadAnonymousSubComponent<SST::Interfaces::SimpleNetwork>
+            ("merlin.linkcontrol", "networkIF", 0,
+             ComponentInfo::SHARE_PORTS | ComponentInfo::INSERT_STATS, if_params, num_vns);
+    }
+
+    send_notify_functor = new SST::Interfaces::SimpleNetwork::Handler<TraceReplay>(this, &TraceReplay::send_notify);
+    link_if->setNotifyOnReceive(new SST::Interfaces::SimpleNetwork::Handler<TraceReplay>(this, &TraceReplay::handle_receive));
+
+    ps_tc = registerTimeBase("1ps",false);
+    timer_link = configureSelfLink("timer_link", ps_tc, new Event::Handler<TraceReplay>(this, &TraceReplay::handle_timer));
+
+    send_queues.resize(num_vns);
+
+    message_latency = registerStatistic<uint64_t>("message_latency");
+    message_delay = registerStatistic<uint64_t>("message_delay");
+    injection_delay = registerStatistic<uint64_t>("injection_delay");
+    message_size = registerStatistic<uint64_t>("message_size");
+
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+}
+
+
+TraceReplay::~TraceReplay()
+{
+    delete link_if;
+    delete send_notify_functor;
+}
+
+
+void TraceReplay::init(unsigned int phase)
+{
+    link_if->init(phase);
+}
+
+void TraceReplay::complete(unsigned int phase)
+{
+    link_if->complete(phase);
+}
+
+void TraceReplay::setup()
+{
+    link_if->setup();
+
+    readNext();
+    if ( have_next ) timer_link->send(next_time, nullptr);
+    checkDone();
+}
+
+void TraceReplay::finish()
+{
+    link_if->finish();
+
+    uint64_t queued = 0;
+    for ( auto& queue : send_queues ) queued += queue.size();
+    if ( queued > 0 || have_next || messages_recd != expected_recv ) {
+        out.output("%s: sent %" PRIu64 " messages (%" PRIu64 " still queued), received %" PRIu64 " of %" PRIu64 "\n",
+                   getName().c_str(), messages_sent, queued, messages_recd, expected_recv);
+    }
+
+    if ( report && messages_recd > 0 ) {
+        out.output("%s: latency of %" PRIu64 " messages received\n", getName().c_str(), messages_recd);
+        for ( size_t i = 0; i < latency_hist.size(); ++i ) {
+            if ( latency_hist[i] == 0 ) continue;
+            uint64_t low = i == 0 ? 0 : (uint64_t)1 << (i - 1);
+            uint64_t high = ((uint64_t)1 << i) - 1;
+            out.output("  %10" PRIu64 " - %10" PRIu64 " ns: %" PRIu64 "\n", low, high, latency_hist[i]);
+        }
+    }
+}
+
+void TraceReplay::readNext()
+{
+    have_next = reader.next(next_rec);
+    if ( !have_next ) return;
+    next_time = (SimTime_t)(next_rec.time * time_scale);
+    if ( (int)(next_rec.size_vn & TRACE_VN_MASK) >= num_vns ) {
+        out.fatal(CALL_INFO, -1, "%s: trace sends on VN %u, but only %d VNs were requested\n",
+                  getName().c_str(), next_rec.size_vn & TRACE_VN_MASK, num_vns);
+    }
+}
+
+void TraceReplay::handle_timer(Event* ev)
+{
+    SimTime_t now = getCurrentSimTime(ps_tc);
+
+    // Queue everything that is due, then wait for the next record
+    while ( have_next && next_time <= now ) {
+        PendingMessage msg;
+        msg.msg_id = next_msg_id++;
+        msg.bytes = next_rec.size_vn >> TRACE_VN_BITS;
+        msg.dest = next_rec.dest;
+        msg.vn = next_rec.size_vn & TRACE_VN_MASK;
+        msg.bits_left = msg.bytes * 8;
+        msg.num_packets = msg.bytes == 0 ? 1 : (msg.bits_left + packet_bits - 1) / packet_bits;
+        msg.started = false;
+        msg.trace_time = next_time;
+        msg.send_time = 0;
+        send_queues[msg.vn].push_back(msg);
+        readNext();
+    }
+    if ( have_next ) timer_link->send(next_time - now, nullptr);
+
+    sendMessages();
+}
+
+void TraceReplay::sendMessages()
+{
+    SimTime_t now = getCurrentSimTime(ps_tc);
+
+    for ( int vn = 0; vn < num_vns; ++vn ) {
+        auto& queue = send_queues[vn];
+        while ( !queue.empty() ) {
+            PendingMessage& msg = queue.front();
+            int bits = msg.bits_left < packet_bits ? msg.bits_left : packet_bits;
+            if ( !link_if->spaceToSend(vn, bits) ) {
+                if ( !waiting_for_send ) {
+                    link_if->setNotifyOnSend(send_notify_functor);
+                    waiting_for_send = true;
+                }
+                break;
+            }
+
+            if ( !msg.started ) {
+                msg.started = true;
+                msg.send_time = now;
+                injection_delay->addData((now - msg.trace_time) / 1000);
+            }
+
+            SimpleNetwork::Request* req = new SimpleNetwork::Request();
+            req->dest = msg.dest;
+            req->src = id;
+            req->vn = vn;
+            req->size_in_bits = bits;
+            req->head = true;
+            req->tail = true;
+            req->givePayload(new trace_replay_event(msg.msg_id, msg.bytes, msg.num_packets, msg.trace_time, msg.send_time));
+            link_if->send(req, vn);
+
+            msg.bits_left -= bits;
+            if ( msg.bits_left <= 0 ) {
+                queue.pop_front();
+                messages_sent++;
+            }
+        }
+    }
+    checkDone();
+}
+
+bool TraceReplay::send_notify(int vn)
+{
+    waiting_for_send = false;
+    sendMessages();
+    // sendMessages() registers again if it needs to
+    return false;
+}
+
+bool TraceReplay::handle_receive(int vn)
+{
+    SimpleNetwork::Request* req = link_if->recv(vn);
+    while ( req != nullptr ) {
+        trace_replay_event* ev = static_cast<trace_replay_event*>(req->takePayload());
+
+        bool complete = true;
+        if ( ev->num_packets > 1 ) {
+            uint64_t key = ((uint64_t)req->src << 40) ^ ev->msg_id;
+            auto it = partial.find(key);
+            if ( it == partial.end() ) {
+                partial[key] = 1;
+                complete = false;
+            }
+            else if ( ++it->second < ev->num_packets ) {
+                complete = false;
+            }
+            else {
+                partial.erase(it);
+            }
+        }
+
+        if ( complete ) {
+            SimTime_t now = getCurrentSimTime(ps_tc);
+            uint64_t latency = (now - ev->send_time) / 1000;
+            message_latency->addData(latency);
+            message_delay->addData((now - ev->trace_time) / 1000);
+            message_size->addData(ev->bytes);
+            messages_recd++;
+
+            if ( report ) {
+                size_t bucket = 0;
+                while ( latency >> bucket ) bucket++;
+                if ( bucket >= latency_hist.size() ) latency_hist.resize(bucket + 1, 0);
+                latency_hist[bucket]++;
+            }
+        }
+        delete ev;
+        delete req;
+        req = link_if->recv(vn);
+    }
+    checkDone();
+    return true;
+}
+
+void TraceReplay::checkDone()
+{
+    if ( done || have_next || messages_recd < expected_recv ) return;
+    for ( auto& queue : send_queues ) {
+        if ( !queue.empty() ) return;
+    }
+    done = true;
+    primaryComponentOKToEndSim();
+}
@@ -0,0 +1,280 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_REPLAY_TRACE_REPLAY_H
+#define COMPONENTS_MERLIN_REPLAY_TRACE_REPLAY_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/timeConverter.h>
+#include <sst/core/interfaces/simpleNetwork.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+/*
+  On-disk layout of a merlin trace file.  All values are
+  little-endian; trace_le() converts them to host byte order.
+
+    trace_file_header
+    trace_node_index index[num_nodes]
+    trace_record     records[]
+
+  The records sent by node n are index[n].num_records records starting
+  at file offset index[n].offset, sorted by time.  index[n].num_recv is
+  the number of messages node n will receive, so it knows when it is
+  done.  tools/merlin_trace.py writes these files.
+*/
+struct trace_file_header {
+    char     magic[8];       // TRACE_FILE_MAGIC
+    uint32_t version;        // TRACE_FILE_VERSION
+    uint32_t num_nodes;
+};
+
+struct trace_node_index {
+    uint64_t offset;
+    uint64_t num_records;
+    uint64_t num_recv;
+};
+
+struct trace_record {
+    uint64_t time;           // Time to send the message in ps
+    uint32_t dest;           // Logical id of the destination
+    uint32_t size_vn;        // Message size in bytes << 4 | VN
+};
+
+#define TRACE_FILE_MAGIC    "MRLNTRC"
+#define TRACE_FILE_VERSION  1
+
+#define TRACE_VN_BITS  4
+#define TRACE_VN_MASK  0xf
+
+template<typename T>
+inline T trace_le(T val)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(&val);
+    std::reverse(bytes, bytes + sizeof(T));
+#endif
+    return val;
+}
+
+
+// Reads the records of one node from a trace file, lookahead records
+// at a time, so traces much larger than memory can be replayed
+class TraceReader {
+public:
+    TraceReader() : fp(nullptr), remaining(0), num_recv(0), pos(0) {}
+    ~TraceReader() { if ( fp ) fclose(fp); }
+
+    // Returns an empty string on success, otherwise the error
+    std::string open(const std::string& filename, int node, size_t lookahead);
+
+    inline bool next(trace_record& rec) {
+        if ( pos == buffer.size() && !fill() ) return false;
+        rec = buffer[pos++];
+        rec.time = trace_le(rec.time);
+        rec.dest = trace_le(rec.dest);
+        rec.size_vn = trace_le(rec.size_vn);
+        return true;
+    }
+
+    uint64_t getNumRecv() const { return num_recv; }
+
+private:
+    FILE* fp;
+    uint64_t remaining;
+    uint64_t num_recv;
+    size_t lookahead;
+    std::vector<trace_record> buffer;
+    size_t pos;
+
+    bool fill();
+};
+
+
+class trace_replay_event : public Event {
+public:
+    uint64_t  msg_id;
+    uint64_t  bytes;
+    uint32_t  num_packets;
+    SimTime_t trace_time;
+    SimTime_t send_time;
+
+    trace_replay_event() : Event() {}
+    trace_replay_event(uint64_t msg_id, uint64_t bytes, uint32_t num_packets, SimTime_t trace_time, SimTime_t send_time) :
+        Event(),
+        msg_id(msg_id),
+        bytes(bytes),
+        num_packets(num_packets),
+        trace_time(trace_time),
+        send_time(send_time)
+    {}
+
+    virtual ~trace_replay_event() {}
+
+    virtual trace_replay_event* clone(void) override {
+        return new trace_replay_event(*this);
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & msg_id;
+        ser & bytes;
+        ser & num_packets;
+        ser & trace_time;
+        ser & send_time;
+    }
+
+private:
+    ImplementSerializable(SST::Merlin::trace_replay_event)
+};
+
+
+// Endpoint that replays a captured trace.  Each message in the trace
+// is sent at its recorded time (scaled by time_scale), split into
+// packets of at most packet_size.  Messages that can't be sent at
+// their time because the network is backed up wait in a queue for
+// their VN, so the statistics separate the time spent waiting to
+// inject from the time spent in the network.
+class TraceReplay : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        TraceReplay,
+        "merlin",
+        "trace_replay",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Endpoint that replays network traffic from a merlin trace file.  See tools/merlin_trace.py to create trace files.",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"id",              "Logical network ID of endpoint."},
+        {"trace",           "Name of the trace file."},
+        {"num_vns",         "Number of VNs to request from the network interface.  Trace VNs must be less than this.","1"},
+        {"packet_size",     "Largest packet to send, specified in either b or B (can include SI prefix).  Larger messages are split.","2kB"},
+        {"lookahead",       "Number of trace records read from the file at a time.","1024"},
+        {"time_scale",      "Factor applied to the times in the trace.  Values less than 1 compress the trace.","1.0"},
+        {"report",          "If true, print a histogram of message latencies for this endpoint at the end of the simulation.","false"},
+        {"link_bw",         "Bandwidth of the router link specified in either b/s or B/s (can include SI prefix).  Only used if networkIF is not set."},
+        {"buffer_size",     "Size of input and output buffers.  Only used if networkIF is not set.","1kB"},
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "message_latency",    "Time from sending the first packet of a message to receiving its last packet","ns",1},
+        { "message_delay",      "Time from the trace time of a message to receiving its last packet","ns",1},
+        { "injection_delay",    "Time from the trace time of a message to sending its first packet","ns",1},
+        { "message_size",       "Size of the messages received","bytes",1},
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"rtr",  "Port that hooks up to router.", { "merlin.RtrEvent", "merlin.credit_event" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"networkIF", "Network interface", "SST::Interfaces::SimpleNetwork" }
+    )
+
+private:
+
+    struct PendingMessage {
+        uint64_t  msg_id;
+        uint64_t  bytes;
+        uint32_t  dest;
+        uint32_t  num_packets;
+        int64_t   bits_left;
+        int       vn;
+        bool      started;
+        SimTime_t trace_time;
+        SimTime_t send_time;
+    };
+
+    int id;
+    int num_vns;
+    int packet_bits;
+    double time_scale;
+    bool report;
+
+    SST::Interfaces::SimpleNetwork* link_if;
+    SST::Interfaces::SimpleNetwork::Handler<TraceReplay>* send_notify_functor;
+    bool waiting_for_send;
+
+    Link* timer_link;
+    // All times are kept in ps
+    TimeConverter* ps_tc;
+
+    TraceReader reader;
+    bool have_next;
+    trace_record next_rec;
+    SimTime_t next_time;
+
+    uint64_t next_msg_id;
+    std::vector<std::deque<PendingMessage> > send_queues;
+
+    // Packets received so far for multi-packet messages, keyed by
+    // source and message id
+    std::unordered_map<uint64_t, uint32_t> partial;
+
+    uint64_t messages_sent;
+    uint64_t messages_recd;
+    uint64_t expected_recv;
+    bool done;
+
+    // Power of 2 buckets of message latency in ns, for report
+    std::vector<uint64_t> latency_hist;
+
+    Statistic<uint64_t>* message_latency;
+    Statistic<uint64_t>* message_delay;
+    Statistic<uint64_t>* injection_delay;
+    Statistic<uint64_t>* message_size;
+
+    Output& out;
+
+public:
+    TraceReplay(ComponentId_t cid, Params& params);
+    ~TraceReplay();
+
+    void init(unsigned int phase);
+    void setup();
+    void complete(unsigned int phase);
+    void finish();
+
+private:
+    void readNext();
+    void handle_timer(Event* ev);
+    bool send_notify(int vn);
+    bool handle_receive(int vn);
+    void sendMessages();
+    void checkDone();
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif // COMPONENTS_MERLIN_REPLAY_TRACE_REPLAY_H
@@ -609,6 +609,11 @@ public:
     virtual void dumpState(std::ostream& stream) {}
     virtual void printStatus(Output& out, int out_port_busy, int in_port_busy) {}
 
+    // Returns the router ID and port number on the other side of a
+    // router to router link, once init has exchanged them.  Returns
+    // (-1,-1) if unknown.
+    virtual std::pair<int,int> getRemotePort() { return std::make_pair(-1,-1); }
+
     // void setupVCs(int vcs, internal_router_event** vc_heads
 	virtual bool decreaseLinkWidth() = 0;
 	virtual bool increaseLinkWidth() = 0;
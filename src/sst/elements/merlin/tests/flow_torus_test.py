@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Runs a small torus of test NICs with the network model selected by
+# --fidelity, so the same traffic can be checked under merlin.hr_router
+# and merlin.flow_router.
+
+import argparse
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--fidelity", default="flow", help="packet or flow")
+    args = parser.parse_args()
+
+    setNetworkFidelity(args.fidelity)
+
+    ### Setup the topology
+    topo = topoTorus()
+    topo.shape = "4x4"
+    topo.width = "1x1"
+    topo.local_ports = 2
+    topo.link_latency = "20ns"
+
+    # Set up the routers
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 1
+    router.xbar_arb = "merlin.xbar_arb_lru"
+
+    topo.router = router
+
+    ### set up the endpoint
+    networkif = LinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "1kB"
+    networkif.output_buf_size = "1kB"
+
+    ep = TestJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
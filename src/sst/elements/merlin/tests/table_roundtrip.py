@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Dumps the route table of a 3x3 torus.  With --table, the network is
+# instead rebuilt from a merged table file (see tools/merlin_table.py)
+# and the dump is taken from merlin.table, so the two dumps should
+# describe the same routes.
+
+import argparse
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--dump", required=True, help="prefix for the per-router route table dumps")
+    parser.add_argument("--table", help="table file to build the network from")
+    args = parser.parse_args()
+
+    ### Setup the topology
+    if args.table:
+        topo = topoTable()
+        topo.filename = args.table
+    else:
+        topo = topoTorus()
+        topo.shape = "3x3"
+        topo.width = "1x1"
+        topo.local_ports = 2
+    topo.link_latency = "20ns"
+
+    # Set up the routers
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 1
+    router.xbar_arb = "merlin.xbar_arb_lru"
+    router.dump_route_table = args.dump
+    router.dump_route_table_endpoints = topo.getNumNodes()
+
+    topo.router = router
+
+    ### set up the endpoint
+    networkif = LinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "1kB"
+    networkif.output_buf_size = "1kB"
+
+    ep = TestJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+    ep.send_untimed_bcast = False
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
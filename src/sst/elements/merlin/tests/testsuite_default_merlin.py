@@ -3,6 +3,10 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import filecmp
+import re
+import subprocess
+
 try:
     from sympy.polys.domains import ZZ
 except:
@@ -77,6 +81,15 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_hyperx_128(self):
          self.merlin_test_template("hyperx_128_test")
 
+    def test_merlin_table_roundtrip(self):
+        self.merlin_table_roundtrip_template("table_roundtrip")
+
+    def test_merlin_trace_replay(self):
+        self.merlin_trace_replay_template("trace_replay_test", "trace_replay_8")
+
+    def test_merlin_flow_torus(self):
+        self.merlin_flow_template("flow_torus_test")
+
     def test_merlin_dragon_128_platform(self):
         self.merlin_test_template("dragon_128_platform_test", True)
 
@@ -135,3 +148,135 @@ class testcase_merlin_Component(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+    # Dumps a torus's routes, merges them into a table file, runs
+    # merlin.table from that file, and checks that dumping its routes
+    # gives back the same file.
+    def merlin_table_roundtrip_template(self, testcase):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        testDataFileName="test_merlin_{0}".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        tool = "{0}/../tools/merlin_table.py".format(test_path)
+        num_routers = 9
+        num_endpoints = 18
+
+        tables = []
+        for run in ["torus", "table"]:
+            outfile = "{0}/{1}_{2}.out".format(outdir, testDataFileName, run)
+            errfile = "{0}/{1}_{2}.err".format(outdir, testDataFileName, run)
+            mpioutfiles = "{0}/{1}_{2}.testfile".format(outdir, testDataFileName, run)
+            prefix = "{0}/{1}_{2}".format(tmpdir, testDataFileName, run)
+            tblfile = "{0}.tbl".format(prefix)
+
+            options = "--dump={0}".format(prefix)
+            if tables:
+                options += " --table={0}".format(tables[0])
+            otherargs = '--model-options="{0}"'.format(options)
+            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, other_args=otherargs)
+
+            if os_test_file(errfile, "-s"):
+                log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+            merge = subprocess.run([sys.executable, tool, "merge", prefix, str(num_routers),
+                                    "--endpoints", str(num_endpoints), "-o", tblfile],
+                                   stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+            self.assertEqual(merge.returncode, 0, "merlin_table.py merge failed:\n{0}".format(merge.stdout))
+            check = subprocess.run([sys.executable, tool, "check", tblfile],
+                                   stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+            self.assertEqual(check.returncode, 0, "merlin_table.py check failed:\n{0}".format(check.stdout))
+            tables.append(tblfile)
+
+        compare = subprocess.run([sys.executable, tool, "compare", tables[0], tables[1]],
+                                 stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+        self.assertEqual(compare.returncode, 0, "Routes differ after reading back {0}:\n{1}".format(tables[0], compare.stdout))
+        self.assertTrue(filecmp.cmp(tables[0], tables[1], shallow=False),
+                        "Table file {0} does not match {1} after a round trip".format(tables[1], tables[0]))
+
+    # Replays a checked-in trace and checks that each endpoint received
+    # the messages the trace sends it.  The expected counts come from the
+    # text the trace was built from.
+    def merlin_trace_replay_template(self, testcase, trace):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="test_merlin_{0}".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        tracefile = "{0}/{1}.trc".format(test_path, trace)
+        textfile = "{0}/{1}.txt".format(test_path, trace)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        otherargs = '--model-options="--trace={0}"'.format(tracefile)
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, other_args=otherargs)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        expected = dict()
+        with open(textfile, 'r') as fp:
+            for line in fp:
+                fields = line.split("#")[0].split()
+                if fields:
+                    dest = int(fields[2])
+                    expected[dest] = expected.get(dest, 0) + 1
+
+        received = dict()
+        histogram = dict()
+        node = None
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                m = re.match(r"\s*trace_replay_(\d+): latency of (\d+) messages received", line)
+                if m:
+                    node = int(m.group(1))
+                    received[node] = int(m.group(2))
+                    histogram[node] = 0
+                    continue
+                m = re.match(r"\s*\d+ -\s+\d+ ns: (\d+)", line)
+                if m and node is not None:
+                    histogram[node] += int(m.group(1))
+                    continue
+                node = None
+                self.assertFalse("still queued" in line, "Trace replay did not finish: {0}".format(line.strip()))
+
+        self.assertEqual(received, expected, "Messages received per endpoint do not match {0}; see {1}".format(textfile, outfile))
+        self.assertEqual(histogram, expected, "Latency histograms do not cover all received messages; see {0}".format(outfile))
+
+    # Runs the same traffic with the packet and the flow network models
+    # and checks that every NIC receives all of its packets in both.
+    # Timing differs between the models, so no reference file is used.
+    def merlin_flow_template(self, testcase):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="test_merlin_{0}".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        num_endpoints = 32
+
+        for fidelity in ["packet", "flow"]:
+            outfile = "{0}/{1}_{2}.out".format(outdir, testDataFileName, fidelity)
+            errfile = "{0}/{1}_{2}.err".format(outdir, testDataFileName, fidelity)
+            mpioutfiles = "{0}/{1}_{2}.testfile".format(outdir, testDataFileName, fidelity)
+
+            otherargs = '--model-options="--fidelity={0}"'.format(fidelity)
+            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, other_args=otherargs)
+
+            if os_test_file(errfile, "-s"):
+                log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+            with open(outfile, 'r') as fp:
+                lines = fp.read().splitlines()
+
+            received = [l for l in lines if "received all packets" in l]
+            missing = [l for l in lines if "didn't receive all" in l]
+            self.assertEqual(len(received), num_endpoints,
+                             "{0} NICs received all packets in {1} mode, expected {2}; see {3}".format(len(received), fidelity, num_endpoints, outfile))
+            self.assertEqual(missing, [], "Incomplete init traffic in {0} mode: {1}".format(fidelity, missing))
+            self.assertTrue(any("Simulation is complete" in l for l in lines),
+                            "Simulation did not complete in {0} mode; see {1}".format(fidelity, outfile))
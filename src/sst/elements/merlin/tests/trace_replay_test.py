@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Replays a merlin trace file (see tools/merlin_trace.py) on a 2x2
+# torus with two endpoints per router.  Each endpoint prints how many
+# messages it received and their latencies at the end of the run.
+
+import argparse
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--trace", default="trace_replay_8.trc", help="trace file to replay")
+    args = parser.parse_args()
+
+    ### Setup the topology
+    topo = topoTorus()
+    topo.shape = "2x2"
+    topo.width = "1x1"
+    topo.local_ports = 2
+    topo.link_latency = "20ns"
+
+    # Set up the routers
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 1
+    router.xbar_arb = "merlin.xbar_arb_lru"
+
+    topo.router = router
+
+    ### set up the endpoint
+    networkif = LinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "1kB"
+    networkif.output_buf_size = "1kB"
+
+    ep = TraceReplayJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+    ep.trace = args.trace
+    ep.packet_size = "2kB"
+    ep.report = True
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Runs pymerlin configurations in both packet and flow fidelity and
+# reports the wall clock speedup of the flow model and its error in
+# simulated time.  The fidelity is selected with SST_MERLIN_FIDELITY,
+# so configurations do not need to be changed.
+#
+#   flow_compare.py ../tests/dragon_128_test.py ../tests/fattree_256_test.py
+#
+# With no arguments, runs the merlin tests that are built with pymerlin.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+DEFAULT_TESTS = [
+    "dragon_128_test.py",
+    "dragon_72_test.py",
+    "fattree_128_test.py",
+    "fattree_256_test.py",
+    "hyperx_128_test.py",
+    "torus_128_test.py",
+    "torus_64_test.py",
+]
+
+UNITS = { "s" : 1.0, "ms" : 1e-3, "us" : 1e-6, "ns" : 1e-9, "ps" : 1e-12, "fs" : 1e-15 }
+
+def run(sst, config, fidelity, cwd):
+    env = dict(os.environ)
+    env["SST_MERLIN_FIDELITY"] = fidelity
+    start = time.time()
+    result = subprocess.run([sst, config], cwd=cwd, env=env, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    wall = time.time() - start
+    if result.returncode != 0:
+        print(result.stdout)
+        sys.exit("%s failed in %s mode"%(config, fidelity))
+    m = re.search(r"simulated time: ([0-9.]+) (\w+)", result.stdout)
+    if not m:
+        sys.exit("could not find simulated time in output of %s"%config)
+    return wall, float(m.group(1)) * UNITS[m.group(2)]
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare merlin packet and flow fidelity")
+    parser.add_argument("configs", nargs="*", help="pymerlin configuration files")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    args = parser.parse_args()
+
+    configs = args.configs
+    if not configs:
+        test_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "tests")
+        configs = [os.path.join(test_dir, t) for t in DEFAULT_TESTS]
+
+    print("%-24s %10s %10s %8s %12s %12s %8s"%("config", "packet(s)", "flow(s)", "speedup", "packet sim", "flow sim", "error"))
+    for config in configs:
+        config = os.path.abspath(config)
+        cwd = os.path.dirname(config)
+        packet_wall, packet_sim = run(args.sst, config, "packet", cwd)
+        flow_wall, flow_sim = run(args.sst, config, "flow", cwd)
+        error = (flow_sim - packet_sim) / packet_sim if packet_sim else 0
+        print("%-24s %10.2f %10.2f %7.1fx %10.3fus %10.3fus %7.1f%%"%(
+            os.path.basename(config), packet_wall, flow_wall, packet_wall / max(flow_wall, 1e-6),
+            packet_sim * 1e6, flow_sim * 1e6, error * 100))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,264 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Tool for merlin.table forwarding table files (see topology/table.h).
+#
+# To get tables for an existing topology, run it once with hr_router's
+# dump_route_table set, which writes one file per router:
+#
+#   router.dump_route_table = "dfly"
+#   router.dump_route_table_endpoints = topo.getNumNodes()
+#
+# then combine them and check them:
+#
+#   merlin_table.py merge dfly 72 --endpoints 72 -o dfly.tbl
+#   merlin_table.py check dfly.tbl
+#   merlin_table.py print dfly.tbl --router 3
+#   merlin_table.py compare dfly.tbl other.tbl
+#
+# The combined file can be used with pymerlin's topoTable, or directly
+# as the filename parameter of merlin.table.
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"MRLNTBL\0"
+VERSION = 1
+
+PORT_UNCONNECTED = 0
+PORT_HOST = 1
+PORT_ROUTER = 2
+
+VC_SAME = 0xFFFF
+VC_HOP = 0xFFFE
+
+PORT_TYPES = { PORT_UNCONNECTED : "unconnected", PORT_HOST : "host", PORT_ROUTER : "router" }
+
+
+class RouterSection:
+    def __init__(self, ports, entry_start, candidates):
+        self.ports = ports              # list of (type, id, peer_port)
+        self.entry_start = entry_start
+        self.candidates = candidates    # list of (port, vc)
+
+    def routes(self, dest):
+        return self.candidates[self.entry_start[dest]:self.entry_start[dest+1]]
+
+    def pack(self):
+        data = struct.pack("<I", len(self.ports))
+        for p in self.ports:
+            data += struct.pack("<iii", *p)
+        data += struct.pack("<%dI"%len(self.entry_start), *self.entry_start)
+        for c in self.candidates:
+            data += struct.pack("<HH", *c)
+        return data
+
+
+def readSection(f, num_endpoints):
+    (num_ports,) = struct.unpack("<I", f.read(4))
+    ports = [struct.unpack("<iii", f.read(12)) for p in range(num_ports)]
+    entry_start = list(struct.unpack("<%dI"%(num_endpoints + 1), f.read(4 * (num_endpoints + 1))))
+    candidates = [struct.unpack("<HH", f.read(4)) for c in range(entry_start[-1])]
+    return RouterSection(ports, entry_start, candidates)
+
+
+class Table:
+    def __init__(self, routers, num_endpoints, num_vcs):
+        self.routers = routers
+        self.num_endpoints = num_endpoints
+        self.num_vcs = num_vcs
+
+    @staticmethod
+    def read(filename):
+        with open(filename, "rb") as f:
+            magic, version, num_routers, num_endpoints, num_vcs = struct.unpack("<8sIIII", f.read(24))
+            if magic != MAGIC:
+                sys.exit("%s is not a forwarding table file"%filename)
+            if version != VERSION:
+                sys.exit("%s has version %d, expected %d"%(filename, version, VERSION))
+            offsets = struct.unpack("<%dQ"%num_routers, f.read(8 * num_routers))
+            routers = []
+            for offset in offsets:
+                f.seek(offset)
+                routers.append(readSection(f, num_endpoints))
+        return Table(routers, num_endpoints, num_vcs)
+
+    def write(self, filename):
+        header = struct.pack("<8sIIII", MAGIC, VERSION, len(self.routers), self.num_endpoints, self.num_vcs)
+        offset = len(header) + 8 * len(self.routers)
+        sections = []
+        offsets = []
+        for r in self.routers:
+            offsets.append(offset)
+            sections.append(r.pack())
+            offset += len(sections[-1])
+        with open(filename, "wb") as f:
+            f.write(header)
+            f.write(struct.pack("<%dQ"%len(offsets), *offsets))
+            for s in sections:
+                f.write(s)
+
+    def endpointLocations(self):
+        loc = dict()
+        for r, section in enumerate(self.routers):
+            for p, (ptype, pid, peer) in enumerate(section.ports):
+                if ptype == PORT_HOST:
+                    loc[pid] = (r, p)
+        return loc
+
+    # Follows every candidate from every router toward dest and
+    # returns the most router to router hops taken by any path.
+    # Reports loops and dead ends as errors.
+    def maxHops(self, dest, errors):
+        hops = dict()
+        active = set()
+
+        def walk(r):
+            if r in hops: return hops[r]
+            if r in active:
+                errors.append("loop through router %d routing to endpoint %d"%(r, dest))
+                return 0
+            active.add(r)
+            section = self.routers[r]
+            most = 0
+            routes = section.routes(dest)
+            if not routes:
+                errors.append("router %d has no route to endpoint %d"%(r, dest))
+            for port, vc in routes:
+                ptype, pid, peer = section.ports[port]
+                if ptype == PORT_HOST:
+                    if pid != dest:
+                        errors.append("router %d sends endpoint %d to endpoint %d"%(r, dest, pid))
+                elif ptype == PORT_ROUTER and 0 <= pid < len(self.routers):
+                    most = max(most, 1 + walk(pid))
+                else:
+                    errors.append("router %d routes endpoint %d to unconnected port %d"%(r, dest, port))
+            active.discard(r)
+            hops[r] = most
+            return most
+
+        return max(walk(r) for r in range(len(self.routers)))
+
+
+def merge(args):
+    routers = []
+    for r in range(args.num_routers):
+        with open("%s.%d"%(args.prefix, r), "rb") as f:
+            routers.append(readSection(f, args.endpoints))
+    table = Table(routers, args.endpoints, args.vcs)
+
+    # Hop count VCs need one VC per router to router hop
+    if args.vcs == 0:
+        errors = []
+        table.num_vcs = max(1, max(table.maxHops(d, errors) for d in range(args.endpoints)))
+        for e in errors[:20]:
+            print(e)
+        if errors:
+            sys.exit("%d errors found in routes"%len(errors))
+    table.write(args.output)
+    print("Wrote %s: %d routers, %d endpoints, %d VCs"%(args.output, len(routers), args.endpoints, table.num_vcs))
+
+
+def check(args):
+    table = Table.read(args.file)
+    errors = []
+    loc = table.endpointLocations()
+    for d in range(table.num_endpoints):
+        if d not in loc:
+            errors.append("endpoint %d is not attached to any router"%d)
+        table.maxHops(d, errors)
+    for e in errors:
+        print(e)
+    if errors:
+        sys.exit("%d errors found"%len(errors))
+    print("%s: no errors"%args.file)
+
+
+def printTable(args):
+    table = Table.read(args.file)
+    print("routers: %d  endpoints: %d  VCs per VN: %d"%(len(table.routers), table.num_endpoints, table.num_vcs))
+    def vcName(vc):
+        if vc == VC_SAME: return "same"
+        if vc == VC_HOP: return "hop"
+        return str(vc)
+    for r, section in enumerate(table.routers):
+        if args.router is not None and r != args.router: continue
+        print("router %d"%r)
+        for p, (ptype, pid, peer) in enumerate(section.ports):
+            if ptype == PORT_ROUTER:
+                print("  port %d: router %d port %d"%(p, pid, peer))
+            else:
+                print("  port %d: %s %d"%(p, PORT_TYPES.get(ptype, "?"), pid))
+        for d in range(table.num_endpoints):
+            print("  %d -> %s"%(d, " ".join("%d:%s"%(port, vcName(vc)) for port, vc in section.routes(d))))
+
+
+def compare(args):
+    a = Table.read(args.a)
+    b = Table.read(args.b)
+    if len(a.routers) != len(b.routers) or a.num_endpoints != b.num_endpoints:
+        sys.exit("tables have different shapes: %d/%d routers, %d/%d endpoints"%(
+            len(a.routers), len(b.routers), a.num_endpoints, b.num_endpoints))
+    diffs = 0
+    for r in range(len(a.routers)):
+        for d in range(a.num_endpoints):
+            pa = set(port for port, vc in a.routers[r].routes(d))
+            pb = set(port for port, vc in b.routers[r].routes(d))
+            if pa != pb:
+                diffs += 1
+                if diffs <= args.limit:
+                    print("router %d, endpoint %d: %s vs %s"%(r, d, sorted(pa), sorted(pb)))
+    total = len(a.routers) * a.num_endpoints
+    print("%d of %d routes differ"%(diffs, total))
+    if diffs: sys.exit(1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build and inspect merlin.table forwarding table files")
+    sub = parser.add_subparsers(dest="command")
+    sub.required = True
+
+    p = sub.add_parser("merge", help="combine per-router dumps from hr_router into one table file")
+    p.add_argument("prefix", help="value of hr_router's dump_route_table")
+    p.add_argument("num_routers", type=int)
+    p.add_argument("--endpoints", type=int, required=True, help="value of dump_route_table_endpoints")
+    p.add_argument("--vcs", type=int, default=0, help="VCs per VN (default: longest path in hops)")
+    p.add_argument("-o", "--output", required=True)
+    p.set_defaults(func=merge)
+
+    p = sub.add_parser("check", help="check that every route reaches its destination without loops")
+    p.add_argument("file")
+    p.set_defaults(func=check)
+
+    p = sub.add_parser("print", help="print a table file")
+    p.add_argument("file")
+    p.add_argument("--router", type=int)
+    p.set_defaults(func=printTable)
+
+    p = sub.add_parser("compare", help="compare the output ports chosen in two table files")
+    p.add_argument("a")
+    p.add_argument("b")
+    p.add_argument("--limit", type=int, default=20, help="maximum number of differences to print")
+    p.set_defaults(func=compare)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,339 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Tool for merlin trace files replayed by merlin.trace_replay (see
+# replay/trace_replay.h).
+#
+# From a text file with one message per line, "src time dest size
+# [vn]", where time is in ps or has units (e.g. 1.5us) and size is in
+# bytes:
+#
+#   merlin_trace.py from-text msgs.txt -o app.trc
+#
+# From ember motif logs (the motifLog parameter of ember), using a
+# communication pattern for each motif, spread over the time the motif
+# took:
+#
+#   merlin_trace.py from-ember motif.log -o app.trc \
+#       --pattern Allreduce=allreduce:8 --pattern Halo3D=halo:4096
+#
+# From merlin statistics written with the csv statistics output.  The
+# send_bit_count of each network interface gives the packets and bits
+# each endpoint sent in each statistics period.  The statistics don't
+# record destinations, so those come from --pattern:
+#
+#   merlin_trace.py from-stats stats.csv -o app.trc --pattern uniform
+#
+# To look at a trace:
+#
+#   merlin_trace.py print app.trc --node 3
+
+import argparse
+import csv
+import random
+import re
+import struct
+import sys
+
+MAGIC = b"MRLNTRC\0"
+VERSION = 1
+
+VN_BITS = 4
+VN_MASK = 0xf
+
+HEADER = struct.Struct("<8sII")
+INDEX = struct.Struct("<QQQ")
+RECORD = struct.Struct("<QII")
+
+UNITS = { "s" : 1e12, "ms" : 1e9, "us" : 1e6, "ns" : 1e3, "ps" : 1.0, "fs" : 1e-3 }
+
+def parseTime(text, unit=None):
+    m = re.match(r"\s*([0-9.eE+-]+)\s*([munpf]?s)?\s*$", text)
+    if not m:
+        sys.exit("unable to parse time %s"%text)
+    scale = UNITS[m.group(2) or unit or "ps"]
+    return int(round(float(m.group(1)) * scale))
+
+
+class Trace:
+    def __init__(self):
+        self.sends = dict()
+
+    def add(self, src, time, dest, size, vn=0):
+        if vn > VN_MASK:
+            sys.exit("VN %d is too large, at most %d VNs are supported"%(vn, VN_MASK + 1))
+        if size >= (1 << (32 - VN_BITS)):
+            sys.exit("message of %d bytes is too large"%size)
+        self.sends.setdefault(src, []).append((time, dest, size, vn))
+
+    def write(self, filename, num_nodes=None):
+        nodes = set(self.sends.keys())
+        for msgs in self.sends.values():
+            nodes.update(m[1] for m in msgs)
+        if num_nodes is None:
+            num_nodes = max(nodes) + 1 if nodes else 0
+        elif nodes and max(nodes) >= num_nodes:
+            sys.exit("trace uses node %d, but --nodes is %d"%(max(nodes), num_nodes))
+
+        recv = [0] * num_nodes
+        for msgs in self.sends.values():
+            msgs.sort()
+            for m in msgs:
+                recv[m[1]] += 1
+
+        with open(filename, "wb") as f:
+            f.write(HEADER.pack(MAGIC, VERSION, num_nodes))
+            offset = HEADER.size + INDEX.size * num_nodes
+            for n in range(num_nodes):
+                count = len(self.sends.get(n, []))
+                f.write(INDEX.pack(offset, count, recv[n]))
+                offset += RECORD.size * count
+            for n in range(num_nodes):
+                for (time, dest, size, vn) in self.sends.get(n, []):
+                    f.write(RECORD.pack(time, dest, (size << VN_BITS) | vn))
+
+        total = sum(len(m) for m in self.sends.values())
+        print("wrote %d messages for %d nodes to %s"%(total, num_nodes, filename))
+
+
+def readTrace(filename):
+    with open(filename, "rb") as f:
+        data = f.read()
+    magic, version, num_nodes = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        sys.exit("%s is not a merlin trace file"%filename)
+    if version != VERSION:
+        sys.exit("%s has version %d, expected %d"%(filename, version, VERSION))
+    nodes = []
+    for n in range(num_nodes):
+        offset, count, num_recv = INDEX.unpack_from(data, HEADER.size + INDEX.size * n)
+        records = []
+        for i in range(count):
+            time, dest, size_vn = RECORD.unpack_from(data, offset + RECORD.size * i)
+            records.append((time, dest, size_vn >> VN_BITS, size_vn & VN_MASK))
+        nodes.append((records, num_recv))
+    return nodes
+
+
+def fromText(args):
+    trace = Trace()
+    with open(args.input) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split("#")[0].split()
+            if not line: continue
+            if len(line) < 4:
+                sys.exit("%s:%d: expected src time dest size [vn]"%(args.input, lineno))
+            vn = int(line[4]) if len(line) > 4 else 0
+            trace.add(int(line[0]), parseTime(line[1]), int(line[2]), int(line[3]), vn)
+    trace.write(args.output, args.nodes)
+
+
+# Messages sent by each rank for one instance of a collective pattern,
+# as a list of steps, each a list of (src, dest) pairs
+def patternSteps(kind, ranks):
+    steps = []
+    if kind == "ring":
+        steps.append([(r, (r + 1) % ranks) for r in range(ranks)])
+    elif kind == "halo":
+        steps.append([(r, (r + 1) % ranks) for r in range(ranks)] +
+                     [(r, (r - 1) % ranks) for r in range(ranks)])
+    elif kind == "alltoall":
+        for s in range(1, ranks):
+            steps.append([(r, (r + s) % ranks) for r in range(ranks)])
+    elif kind == "allreduce":
+        # Recursive doubling
+        dist = 1
+        while dist < ranks:
+            steps.append([(r, r ^ dist) for r in range(ranks) if r ^ dist < ranks])
+            dist *= 2
+    elif kind == "bcast":
+        # Binomial tree from rank 0
+        dist = 1
+        while dist < ranks:
+            steps.append([(r, r + dist) for r in range(dist) if r + dist < ranks])
+            dist *= 2
+    elif kind != "none":
+        sys.exit("unknown pattern %s"%kind)
+    return steps
+
+def fromEmber(args):
+    patterns = dict()
+    for p in args.pattern:
+        m = re.match(r"([^=]+)=(\w+)(?::(\d+))?$", p)
+        if not m:
+            sys.exit("pattern must be motif=kind[:bytes], got %s"%p)
+        patterns[m.group(1)] = (m.group(2), int(m.group(3) or args.size))
+
+    time_re = r"([0-9.eE+-]+)\s*([munpf]?s)"
+    line_re = re.compile(r"\s*(\d+)\s+(\d+)\s+(\d+)\s+(\S+)\s+" + time_re + r"\s+" + time_re + r"\s*$")
+
+    # (job, motif number) -> name, list of (rank, start, end)
+    motifs = dict()
+    ranks = dict()
+    for log in args.input:
+        with open(log) as f:
+            for lineno, line in enumerate(f, 1):
+                if not line.strip(): continue
+                m = line_re.match(line)
+                if not m:
+                    sys.exit("%s:%d: not an ember motif log line"%(log, lineno))
+                job, rank, num = int(m.group(1)), int(m.group(2)), int(m.group(3))
+                start = parseTime(m.group(5), m.group(6))
+                end = parseTime(m.group(7), m.group(8))
+                entry = motifs.setdefault((job, num), (m.group(4), []))
+                entry[1].append((rank, start, end))
+                ranks[job] = max(ranks.get(job, 0), rank + 1)
+
+    base = dict()
+    for b in args.job_base:
+        job, node = b.split("=")
+        base[int(job)] = int(node)
+
+    trace = Trace()
+    skipped = set()
+    for (job, num), (name, entries) in sorted(motifs.items()):
+        if name not in patterns:
+            skipped.add(name)
+            continue
+        kind, size = patterns[name]
+        steps = patternSteps(kind, ranks[job])
+        if not steps: continue
+        times = dict((rank, (start, end)) for (rank, start, end) in entries)
+        offset = base.get(job, 0)
+        for i, step in enumerate(steps):
+            for (src, dest) in step:
+                if src not in times: continue
+                start, end = times[src]
+                time = start + (end - start) * i // len(steps)
+                trace.add(src + offset, time, dest + offset, size, args.vn)
+
+    if skipped:
+        print("no pattern given for motifs: %s"%", ".join(sorted(skipped)))
+    trace.write(args.output, args.nodes)
+
+
+def fromStats(args):
+    id_re = re.compile(args.id_regex)
+
+    # node -> list of (time, count, bits)
+    samples = dict()
+    with open(args.input) as f:
+        reader = csv.reader(f)
+        header = [h.strip() for h in next(reader)]
+        try:
+            comp_col = header.index("ComponentName")
+            name_col = header.index("StatisticName")
+            time_col = header.index("SimTime")
+            sum_col = [i for i, h in enumerate(header) if h.startswith("Sum.")][0]
+            count_col = [i for i, h in enumerate(header) if h.startswith("Count.")][0]
+        except (ValueError, IndexError):
+            sys.exit("%s does not look like sst csv statistics output"%args.input)
+
+        for row in reader:
+            row = [r.strip() for r in row]
+            if row[name_col] != args.stat: continue
+            m = id_re.search(row[comp_col])
+            if not m:
+                sys.exit("unable to find a node id in component %s, use --id-regex"%row[comp_col])
+            node = int(m.group(1))
+            samples.setdefault(node, []).append((int(row[time_col]), int(row[count_col]), int(row[sum_col])))
+
+    num_nodes = args.nodes if args.nodes else max(samples.keys()) + 1
+    rng = random.Random(args.seed)
+    trace = Trace()
+    for node, rows in sorted(samples.items()):
+        rows.sort()
+        prev_time = 0
+        prev_count = 0
+        prev_bits = 0
+        for (time, count, bits) in rows:
+            if not args.reset_on_output:
+                count, bits, prev_count, prev_bits = count - prev_count, bits - prev_bits, count, bits
+            if count > 0:
+                size = max(1, bits // count // 8)
+                # SimTime is in the core time base, assumed to be ps
+                for i in range(count):
+                    t = prev_time + (time - prev_time) * i // count
+                    if args.pattern == "uniform":
+                        dest = rng.randrange(num_nodes - 1)
+                        if dest >= node: dest += 1
+                    else:
+                        m = re.match(r"shift:(-?\d+)$", args.pattern)
+                        if not m:
+                            sys.exit("pattern must be uniform or shift:N")
+                        dest = (node + int(m.group(1))) % num_nodes
+                    trace.add(node, t, dest, size, args.vn)
+            prev_time = time
+    trace.write(args.output, num_nodes)
+
+
+def printTrace(args):
+    nodes = readTrace(args.input)
+    for n, (records, num_recv) in enumerate(nodes):
+        if args.node is not None and n != args.node: continue
+        print("node %d: sends %d, receives %d"%(n, len(records), num_recv))
+        for (time, dest, size, vn) in records[:args.limit]:
+            print("  %14d ps -> %6d  %10d B  vn %d"%(time, dest, size, vn))
+        if len(records) > args.limit:
+            print("  ...")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create and inspect merlin trace files")
+    sub = parser.add_subparsers(dest="command")
+    sub.required = True
+
+    p = sub.add_parser("from-text", help="convert a text file of messages")
+    p.add_argument("input")
+    p.add_argument("-o", "--output", required=True)
+    p.add_argument("--nodes", type=int, help="number of nodes in the trace (default: largest id used + 1)")
+    p.set_defaults(func=fromText)
+
+    p = sub.add_parser("from-ember", help="convert ember motif logs")
+    p.add_argument("input", nargs="+")
+    p.add_argument("-o", "--output", required=True)
+    p.add_argument("--pattern", action="append", default=[],
+                   help="motif=kind[:bytes], kind is one of ring, halo, alltoall, allreduce, bcast, none")
+    p.add_argument("--size", type=int, default=8, help="message size for patterns that don't give one")
+    p.add_argument("--job-base", action="append", default=[], help="job=node, first node used by a job (default 0)")
+    p.add_argument("--vn", type=int, default=0)
+    p.add_argument("--nodes", type=int)
+    p.set_defaults(func=fromEmber)
+
+    p = sub.add_parser("from-stats", help="convert merlin csv statistics")
+    p.add_argument("input")
+    p.add_argument("-o", "--output", required=True)
+    p.add_argument("--stat", default="send_bit_count", help="statistic counting the packets sent")
+    p.add_argument("--id-regex", default=r"_(\d+)(?::|$)", help="regex finding the node id in the component name")
+    p.add_argument("--pattern", default="uniform", help="uniform or shift:N")
+    p.add_argument("--seed", type=int, default=1)
+    p.add_argument("--reset-on-output", action="store_true", help="statistics were reset after each output")
+    p.add_argument("--vn", type=int, default=0)
+    p.add_argument("--nodes", type=int)
+    p.set_defaults(func=fromStats)
+
+    p = sub.add_parser("print", help="print a trace file")
+    p.add_argument("input")
+    p.add_argument("--node", type=int)
+    p.add_argument("--limit", type=int, default=20)
+    p.set_defaults(func=printTrace)
+
+    args = parser.parse_args()
+    args.func(args)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Runs pymerlin configurations on 1, 2, 4 and 8 ranks, once with the
+# default partitioner and once with the topology aware placement done
+# by pymerlin (SST_MERLIN_PARTITION=1), and reports the wall clock
+# time of each run and the cut links reported by pymerlin.
+#
+#   partition_scaling.py ../tests/dragon_128_test.py --ranks 1 2 4 8
+#
+# With no configuration arguments, runs the larger merlin tests that
+# are built with pymerlin.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+DEFAULT_TESTS = [
+    "dragon_128_test.py",
+    "fattree_256_test.py",
+    "hyperx_128_test.py",
+    "torus_128_test.py",
+]
+
+def run(args, config, ranks, placement, cwd):
+    env = dict(os.environ)
+    env["SST_MERLIN_PARTITION"] = "1" if placement else "0"
+    cmd = [args.sst, config]
+    if ranks > 1:
+        cmd = [args.mpirun, "-np", str(ranks)] + cmd
+    start = time.time()
+    result = subprocess.run(cmd, cwd=cwd, env=env, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    wall = time.time() - start
+    if result.returncode != 0:
+        print(result.stdout)
+        sys.exit("%s failed on %d ranks"%(config, ranks))
+    m = re.search(r"(\d+) of (\d+) router links cut", result.stdout)
+    cut = "%s/%s"%(m.group(1), m.group(2)) if m else "-"
+    return wall, cut
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure merlin parallel scaling with and without topology aware placement")
+    parser.add_argument("configs", nargs="*", help="pymerlin configuration files")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    parser.add_argument("--mpirun", default="mpirun", help="MPI launcher")
+    parser.add_argument("--ranks", type=int, nargs="+", default=[1, 2, 4, 8], help="rank counts to run")
+    args = parser.parse_args()
+
+    configs = args.configs
+    if not configs:
+        test_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "tests")
+        configs = [os.path.join(test_dir, t) for t in DEFAULT_TESTS]
+
+    print("%-24s %6s %12s %12s %10s %8s"%("config", "ranks", "default(s)", "placed(s)", "cut links", "speedup"))
+    for config in configs:
+        config = os.path.abspath(config)
+        cwd = os.path.dirname(config)
+        base = None
+        for ranks in args.ranks:
+            default_wall, _ = run(args, config, ranks, False, cwd)
+            placed_wall, cut = run(args, config, ranks, True, cwd)
+            if base is None: base = default_wall
+            print("%-24s %6d %12.2f %12.2f %10s %7.2fx"%(
+                os.path.basename(config), ranks, default_wall, placed_wall, cut, base / max(placed_wall, 1e-6)))
+
+if __name__ == "__main__":
+    main()
@@ -63,6 +63,11 @@ class topoDragonFly(Topology):
     def findRouterByLocation(self,group,rtr):
         return sst.findComponentByName(self.getRouterNameForLocation(group,rtr))
 
+    # Partition along groups so that only global links are cut
+    def _getPartitionBlock(self, rtr_id):
+        return (rtr_id // self.routers_per_group, self.num_groups,
+                rtr_id % self.routers_per_group, self.routers_per_group)
+
 
     def _build_impl(self, endpoint):
         if self._check_first_build():
@@ -188,13 +193,13 @@ class topoDragonFly(Topology):
                         src = min(p,r)
                         dst = max(p,r)
                         for s in range(self.intragroup_links):
-                            rtr.addLink(getLink("link_g%dr%dr%ds%d"%(g, src, dst, s)), "port%d"%port, self.link_latency)
+                            self._addRouterLink(rtr, router_num, getLink("link_g%dr%dr%ds%d"%(g, src, dst, s)), "port%d"%port, self.link_latency)
                             port = port + 1
 
                 for p in range(igpr):
                     link = getGlobalLink(g,r,p)
                     if link is not None:
-                        rtr.addLink(link,"port%d"%port, self.link_latency)
+                        self._addRouterLink(rtr, router_num, link, "port%d"%port, self.link_latency)
                     port = port +1
 
                 router_num = router_num + 1
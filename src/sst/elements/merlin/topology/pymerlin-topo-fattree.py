@@ -83,6 +83,9 @@ class topoFatTree(Topology):
 
 
     def getRouterNameForId(self,rtr_id):
+        return self.getRouterNameForLocation(self._idToLocation(rtr_id))
+
+    def _idToLocation(self,rtr_id):
         num_levels = len(self._start_ids)
 
         # Check to make sure the index is in range
@@ -102,7 +105,27 @@ class topoFatTree(Topology):
         routers_per_group = self._routers_per_level[level] // self._groups_per_level[level]
         group = remainder // routers_per_group
         router = remainder % routers_per_group
-        return self.getRouterNameForLocation((level,group,router))
+        return (level,group,router)
+
+    # Partition along pods.  The blocks are the subtrees rooted at the
+    # highest level that still has at least one subtree per partition,
+    # so only links above that level are cut.  Routers above that
+    # level are shared by all the blocks.
+    def _getPartitionBlock(self, rtr_id):
+        (level, group, router) = self._idToLocation(rtr_id)
+        top = len(self._ups)
+        if top == 0:
+            return (0, 1, 0, 1)
+        parts = self._partition[0] * self._partition[1]
+        block_level = 0
+        for l in range(top-1, -1, -1):
+            if self._groups_per_level[l] >= parts:
+                block_level = l
+                break
+        if level > block_level:
+            return (None, self._groups_per_level[block_level], 0, 1)
+        block = group // (self._groups_per_level[level] // self._groups_per_level[block_level])
+        return (block, self._groups_per_level[block_level], 0, 1)
             
     
     def getRouterNameForLocation(self,location):
@@ -125,6 +148,9 @@ class topoFatTree(Topology):
 
             host_links = []
             if level == 0:
+                # The endpoints are built before their router, so set
+                # their placement first
+                self._setPlacement(id)
                 # create all the nodes
                 for i in range(self._downs[0]):
                     node_id = id * self._downs[0] + i
@@ -148,7 +174,7 @@ class topoFatTree(Topology):
                 for l in range(len(host_links)):
                     rtr.addLink(host_links[l],"port%d"%l, self.link_latency)
                 for l in range(len(links)):
-                    rtr.addLink(links[l],"port%d"%(l+self._downs[0]), self.link_latency)
+                    self._addRouterLink(rtr, rtr_id, links[l],"port%d"%(l+self._downs[0]), self.link_latency)
                 return
 
             rtrs_in_group = self._routers_per_level[level] // self._groups_per_level[level]
@@ -181,7 +207,7 @@ class topoFatTree(Topology):
                 topology.addParams(self._getGroupParams("main"))
                 # Add links
                 for l in range(len(rtr_links[i])):
-                    rtr.addLink(rtr_links[i][l],"port%d"%l, self.link_latency)
+                    self._addRouterLink(rtr, rtr_id, rtr_links[i][l],"port%d"%l, self.link_latency)
         #  End recursive function
 
         level = len(self._ups)
@@ -216,7 +242,7 @@ class topoFatTree(Topology):
                 topology.addParams(self._getGroupParams("main"))
 
                 for l in range(len(rtr_links[i])):
-                    rtr.addLink(rtr_links[i][l], "port%d"%l, self.link_latency)
+                    self._addRouterLink(rtr, rtr_id, rtr_links[i][l], "port%d"%l, self.link_latency)
 
         else: # Single level case
             # create all the nodes
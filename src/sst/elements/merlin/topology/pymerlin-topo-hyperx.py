@@ -105,6 +105,13 @@ class topoHyperX(Topology):
     
     def findRouterByLocation(self,location):
         return sst.findComponentByName(self.getRouterNameForLocation(location))
+
+    # Partition along slices of the last dimension
+    def _getPartitionBlock(self, rtr_id):
+        slice_size = 1
+        for x in self._dim_size[:-1]:
+            slice_size = slice_size * x
+        return (rtr_id // slice_size, self._dim_size[-1], rtr_id % slice_size, slice_size)
         
     
     def _build_impl(self, endpoint):
@@ -165,7 +172,7 @@ class topoHyperX(Topology):
                         theirlocstr = self._formatShape(theirdims)
                         # Hook up "width" number of links for this dimension
                         for num in range(self._dim_width[dim]):
-                            rtr.addLink(getLink(mylocstr, theirlocstr, num), "port%d"%port, self.link_latency)
+                            self._addRouterLink(rtr, i, getLink(mylocstr, theirlocstr, num), "port%d"%port, self.link_latency)
                             #print("Wired up port %d"%port)
                             port = port + 1
 
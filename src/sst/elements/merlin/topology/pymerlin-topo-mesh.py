@@ -105,6 +105,13 @@ class _topoMeshBase(Topology):
     
     def findRouterByLocation(self,location):
         return sst.findComponentByName(self.getRouterNameForLocation(location))
+
+    # Partition along slices of the last dimension
+    def _getPartitionBlock(self, rtr_id):
+        slice_size = 1
+        for x in self._dim_size[:-1]:
+            slice_size = slice_size * x
+        return (rtr_id // slice_size, self._dim_size[-1], rtr_id % slice_size, slice_size)
         
     def _build_impl(self, endpoint):
         if self.host_link_latency is None:
@@ -156,7 +163,7 @@ class _topoMeshBase(Topology):
                     theirdims[dim] = (mydims[dim] +1 ) % self._dim_size[dim]
                     theirlocstr = self._formatShape(theirdims)
                     for num in range(self._dim_width[dim]):
-                        rtr.addLink(getLink(mylocstr, theirlocstr, num), "port%d"%port, self.link_latency)
+                        self._addRouterLink(rtr, i, getLink(mylocstr, theirlocstr, num), "port%d"%port, self.link_latency)
                         port = port+1
                 else:
                     port += self._dim_width[dim]
@@ -166,7 +173,7 @@ class _topoMeshBase(Topology):
                     theirdims[dim] = ((mydims[dim] -1) + self._dim_size[dim]) % self._dim_size[dim]
                     theirlocstr = self._formatShape(theirdims)
                     for num in range(self._dim_width[dim]):
-                        rtr.addLink(getLink(theirlocstr, mylocstr, num), "port%d"%port, self.link_latency)
+                        self._addRouterLink(rtr, i, getLink(theirlocstr, mylocstr, num), "port%d"%port, self.link_latency)
                         port = port+1
                 else:
                     port += self._dim_width[dim]
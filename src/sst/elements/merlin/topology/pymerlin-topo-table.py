@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+from sst.merlin.base import *
+import struct
+
+# Builds the network described by a merlin.table forwarding table
+# file.  The wiring comes from the port records in the file, so any
+# topology whose tables were dumped with hr_router's dump_route_table
+# option can be rebuilt and run with table routing.
+class topoTable(Topology):
+
+    def __init__(self):
+        Topology.__init__(self)
+        self._declareClassVariables(["link_latency","host_link_latency","bundleEndpoints","_routers","_num_endpoints"])
+        self._declareParams("main",["filename","algorithm"])
+        self._setCallbackOnWrite("filename",self._filename_callback)
+        self._subscribeToPlatformParamSet("topology")
+
+    def _filename_callback(self,variable_name,value):
+        self._lockVariable(variable_name)
+        self._readTable(value)
+
+    # Reads the header and port records of each router section.  The
+    # routes themselves are only read by the topology objects.
+    def _readTable(self,filename):
+        with open(filename, "rb") as f:
+            magic, version, num_routers, num_endpoints, num_vcs = struct.unpack("<8sIIII", f.read(24))
+            if magic.rstrip(b'\0') != b"MRLNTBL" or version != 1:
+                print("topo%s: %s is not a version 1 forwarding table file."%(self.getName(),filename))
+                exit(1)
+            offsets = struct.unpack("<%dQ"%num_routers, f.read(8 * num_routers))
+            self._routers = []
+            for offset in offsets:
+                f.seek(offset)
+                (num_ports,) = struct.unpack("<I", f.read(4))
+                ports = [struct.unpack("<iii", f.read(12)) for p in range(num_ports)]
+                self._routers.append(ports)
+            self._num_endpoints = num_endpoints
+
+    def getName(self):
+        return "Table"
+
+    def getNumNodes(self):
+        if self._num_endpoints is None:
+            print("topo%s: calling getNumNodes before filename was set."%self.getName())
+            exit(1)
+        return self._num_endpoints
+
+    def getRouterNameForId(self,rtr_id):
+        return "rtr%d"%rtr_id
+
+    def findRouterById(self,rtr_id):
+        return sst.findComponentByName(self.getRouterNameForId(rtr_id))
+
+    def _build_impl(self, endpoint):
+        if self.host_link_latency is None:
+            self.host_link_latency = self.link_latency
+
+        links = dict()
+        def getLink(rtr_a, port_a, rtr_b, port_b):
+            if (rtr_a, port_a) > (rtr_b, port_b):
+                rtr_a, port_a, rtr_b, port_b = rtr_b, port_b, rtr_a, port_a
+            name = "link_%d_%d_%d_%d"%(rtr_a, port_a, rtr_b, port_b)
+            if name not in links:
+                links[name] = sst.Link(name)
+            return links[name]
+
+        for i, ports in enumerate(self._routers):
+            rtr = self._instanceRouter(len(ports),i)
+
+            topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.table")
+            self._applyStatisticsSettings(topology)
+            topology.addParams(self._getGroupParams("main"))
+
+            for port, (ptype, pid, peer_port) in enumerate(ports):
+                if ptype == 1:
+                    (ep, port_name) = endpoint.build(pid, {})
+                    if ep:
+                        nicLink = sst.Link("nic.%d:%d"%(i, port))
+                        if self.bundleEndpoints:
+                            nicLink.setNoCut()
+                        nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
+                elif ptype == 2:
+                    if pid < 0:
+                        print("topo%s: router %d port %d has no peer in the table file."%(self.getName(),i,port))
+                        exit(1)
+                    rtr.addLink(getLink(i, port, pid, peer_port), "port%d"%port, self.link_latency)
@@ -0,0 +1,240 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "table.h"
+
+#include <stdio.h>
+#include <string.h>
+
+using namespace SST::Merlin;
+
+topo_table::topo_table(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns) :
+    Topology(cid),
+    router_id(rtr_id),
+    num_vns(num_vns),
+    output_queue_lengths(NULL),
+    num_vcs(0)
+{
+    std::string filename = params.find<std::string>("filename");
+    if ( filename == "" ) {
+        output.fatal(CALL_INFO, -1, "topo_table requires filename to be specified\n");
+    }
+
+    std::string algo = params.find<std::string>("algorithm", "first");
+    if ( algo == "first" ) algorithm = FIRST;
+    else if ( algo == "hash" ) algorithm = HASH;
+    else if ( algo == "adaptive" ) algorithm = ADAPTIVE;
+    else {
+        output.fatal(CALL_INFO, -1, "Unknown routing mode specified: %s\n", algo.c_str());
+    }
+
+    loadTable(filename, num_ports);
+}
+
+topo_table::~topo_table()
+{
+}
+
+// Only the section for this router is read, so memory use per router
+// is proportional to the number of endpoints, not the whole fabric.
+void
+topo_table::loadTable(const std::string& filename, int num_ports)
+{
+    FILE* fp = fopen(filename.c_str(), "rb");
+    if ( fp == NULL ) {
+        output.fatal(CALL_INFO, -1, "topo_table: unable to open %s\n", filename.c_str());
+    }
+
+    table_file_header header;
+    if ( fread(&header, sizeof(header), 1, fp) != 1 ||
+         strncmp(header.magic, TABLE_FILE_MAGIC, sizeof(header.magic)) != 0 ) {
+        output.fatal(CALL_INFO, -1, "topo_table: %s is not a forwarding table file\n", filename.c_str());
+    }
+    table_le(header);
+    if ( header.version != TABLE_FILE_VERSION ) {
+        output.fatal(CALL_INFO, -1, "topo_table: %s has version %u, expected %d\n",
+                     filename.c_str(), header.version, TABLE_FILE_VERSION);
+    }
+    if ( router_id < 0 || (uint32_t)router_id >= header.num_routers ) {
+        output.fatal(CALL_INFO, -1, "topo_table: router %d is not in %s, which has %u routers\n",
+                     router_id, filename.c_str(), header.num_routers);
+    }
+
+    num_endpoints = header.num_endpoints;
+    num_table_vcs = header.num_vcs;
+
+    uint64_t offset;
+    bool ok = fseek(fp, sizeof(header) + (long)router_id * sizeof(uint64_t), SEEK_SET) == 0;
+    ok = ok && fread(&offset, sizeof(offset), 1, fp) == 1;
+    ok = ok && fseek(fp, (long)table_le(offset), SEEK_SET) == 0;
+
+    uint32_t table_ports = 0;
+    ok = ok && fread(&table_ports, sizeof(table_ports), 1, fp) == 1;
+    table_ports = table_le(table_ports);
+    if ( ok && table_ports > (uint32_t)num_ports ) {
+        output.fatal(CALL_INFO, -1, "topo_table: router %d has %u ports in %s, but only %d ports in the router\n",
+                     router_id, table_ports, filename.c_str(), num_ports);
+    }
+
+    port_info.resize(table_ports);
+    entry_start.resize(num_endpoints + 1);
+    ok = ok && fread(port_info.data(), sizeof(table_port_info), table_ports, fp) == table_ports;
+    ok = ok && fread(entry_start.data(), sizeof(uint32_t), num_endpoints + 1, fp) == num_endpoints + 1;
+    for ( auto& info : port_info ) table_le(info);
+    for ( auto& start : entry_start ) start = table_le(start);
+    if ( ok ) {
+        candidates.resize(entry_start[num_endpoints]);
+        ok = fread(candidates.data(), sizeof(table_candidate), candidates.size(), fp) == candidates.size();
+        for ( auto& cand : candidates ) table_le(cand);
+    }
+    fclose(fp);
+
+    if ( !ok ) {
+        output.fatal(CALL_INFO, -1, "topo_table: section for router %d in %s is truncated\n", router_id, filename.c_str());
+    }
+
+    for ( auto& cand : candidates ) {
+        if ( cand.port >= table_ports ) {
+            output.fatal(CALL_INFO, -1, "topo_table: router %d in %s routes to port %u, which doesn't exist\n",
+                         router_id, filename.c_str(), cand.port);
+        }
+    }
+}
+
+void
+topo_table::setOutputQueueLengthsArray(int const* array, int vcs)
+{
+    output_queue_lengths = array;
+    num_vcs = vcs;
+}
+
+int
+topo_table::candidateVC(const table_candidate& cand, int in_vc, int in_port)
+{
+    if ( cand.vc == TABLE_VC_SAME ) return in_vc;
+    if ( cand.vc == TABLE_VC_HOP ) return isHostPort(in_port) ? 0 : in_vc + 1;
+    return cand.vc;
+}
+
+void
+topo_table::checkRoute(int dest)
+{
+    if ( dest < 0 || (uint32_t)dest >= num_endpoints || entry_start[dest] == entry_start[dest+1] ) {
+        output.fatal(CALL_INFO, -1, "topo_table: router %d has no route to endpoint %d\n", router_id, dest);
+    }
+}
+
+const table_candidate&
+topo_table::chooseCandidate(int src, int dest, int vn_start, int in_vc, int in_port, int& out_vc)
+{
+    checkRoute(dest);
+
+    uint32_t first = entry_start[dest];
+    uint32_t count = entry_start[dest+1] - first;
+    uint32_t choice = 0;
+
+    if ( count > 1 ) {
+        if ( algorithm == HASH ) {
+            uint32_t hash = (uint32_t)src * 2654435761u ^ (uint32_t)dest * 40503u;
+            choice = (hash ^ (hash >> 16)) % count;
+        }
+        else if ( algorithm == ADAPTIVE && output_queue_lengths != NULL ) {
+            int min = 0x7FFFFFFF;
+            for ( uint32_t i = 0; i < count; ++i ) {
+                const table_candidate& cand = candidates[first + i];
+                int weight = output_queue_lengths[cand.port * num_vcs + vn_start + candidateVC(cand, in_vc, in_port)];
+                if ( weight < min ) {
+                    min = weight;
+                    choice = i;
+                }
+            }
+        }
+    }
+
+    const table_candidate& cand = candidates[first + choice];
+    out_vc = candidateVC(cand, in_vc, in_port);
+    if ( out_vc >= num_table_vcs ) {
+        output.fatal(CALL_INFO, -1, "topo_table: route to endpoint %d at router %d needs VC %d, but the table only has %d VCs per VN\n",
+                     dest, router_id, out_vc, num_table_vcs);
+    }
+    return cand;
+}
+
+void
+topo_table::route_packet(int port, int vc, internal_router_event* ev)
+{
+    int vn_start = ev->getVN() * num_table_vcs;
+    int out_vc;
+    const table_candidate& cand = chooseCandidate(ev->getSrc(), ev->getDest(), vn_start, vc - vn_start, port, out_vc);
+    ev->setNextPort(cand.port);
+    ev->setVC(vn_start + out_vc);
+}
+
+internal_router_event*
+topo_table::process_input(RtrEvent* ev)
+{
+    internal_router_event* ire = new internal_router_event(ev);
+    ire->setVC(ire->getVN() * num_table_vcs);
+    return ire;
+}
+
+void
+topo_table::routeUntimedData(int port, internal_router_event* ev, std::vector<int> &outPorts)
+{
+    if ( ev->getDest() == UNTIMED_BROADCAST_ADDR ) {
+        // The table says nothing about broadcast trees, so flood to
+        // every port and drop repeat visits.
+        topo_table_event* tt_ev = static_cast<topo_table_event*>(ev);
+        if ( !broadcasts_seen.insert(tt_ev->id).second ) return;
+
+        for ( int p = 0; p < (int)port_info.size(); ++p ) {
+            if ( p != port && port_info[p].type != TABLE_PORT_UNCONNECTED ) {
+                outPorts.push_back(p);
+            }
+        }
+    }
+    else {
+        // Untimed data ignores VCs, so just take the first candidate
+        checkRoute(ev->getDest());
+        outPorts.push_back(candidates[entry_start[ev->getDest()]].port);
+    }
+}
+
+internal_router_event*
+topo_table::process_UntimedData_input(RtrEvent* ev)
+{
+    return new topo_table_event(ev);
+}
+
+Topology::PortState
+topo_table::getPortState(int port) const
+{
+    if ( port >= (int)port_info.size() ) return UNCONNECTED;
+    switch ( port_info[port].type ) {
+    case TABLE_PORT_HOST:
+        return R2N;
+    case TABLE_PORT_ROUTER:
+        return R2R;
+    default:
+        return UNCONNECTED;
+    }
+}
+
+int
+topo_table::getEndpointID(int port)
+{
+    if ( !isHostPort(port) ) return -1;
+    return port_info[port].id;
+}
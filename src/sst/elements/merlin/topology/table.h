@@ -0,0 +1,223 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TOPOLOGY_TABLE_H
+#define COMPONENTS_MERLIN_TOPOLOGY_TABLE_H
+
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/params.h>
+#include <sst/core/rng/rng.h>
+
+#include <stdint.h>
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Merlin {
+
+/*
+  On-disk layout of a merlin.table routing file.  All values are
+  little-endian; table_le() converts to and from host byte order.
+
+    table_file_header
+    uint64_t section_offset[num_routers]  (file offset of each router section)
+
+  Each router section:
+
+    uint32_t        num_ports
+    table_port_info port[num_ports]
+    uint32_t        entry_start[num_endpoints + 1]
+    table_candidate candidate[entry_start[num_endpoints]]
+
+  The candidates for destination endpoint d are
+  candidate[entry_start[d]] through candidate[entry_start[d+1] - 1],
+  in order of preference.
+*/
+struct table_file_header {
+    char     magic[8];       // TABLE_FILE_MAGIC
+    uint32_t version;        // TABLE_FILE_VERSION
+    uint32_t num_routers;
+    uint32_t num_endpoints;
+    uint32_t num_vcs;        // VCs needed per VN
+};
+
+struct table_port_info {
+    int32_t type;            // One of TABLE_PORT_*
+    int32_t id;              // Endpoint ID for host ports, peer router ID (or -1 if unknown) for router ports
+    int32_t peer_port;       // Port on the peer router (or -1 if unknown)
+};
+
+struct table_candidate {
+    uint16_t port;
+    uint16_t vc;             // VC within the VN, or one of TABLE_VC_*
+};
+
+#define TABLE_FILE_MAGIC    "MRLNTBL"
+#define TABLE_FILE_VERSION  1
+
+#define TABLE_PORT_UNCONNECTED 0
+#define TABLE_PORT_HOST        1
+#define TABLE_PORT_ROUTER      2
+
+// Keep the VC the packet arrived on
+#define TABLE_VC_SAME 0xFFFF
+// Use the first VC on injection and the next higher VC on every
+// router to router hop after that (hop count VCs)
+#define TABLE_VC_HOP  0xFFFE
+
+// Converts a value between host byte order and the file's little-endian
+// byte order.  The conversion is its own inverse, so it is used for both
+// reading and writing.
+template<typename T>
+inline T table_le(T val)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(&val);
+    std::reverse(bytes, bytes + sizeof(T));
+#endif
+    return val;
+}
+
+inline void table_le(table_file_header& header)
+{
+    header.version = table_le(header.version);
+    header.num_routers = table_le(header.num_routers);
+    header.num_endpoints = table_le(header.num_endpoints);
+    header.num_vcs = table_le(header.num_vcs);
+}
+
+inline void table_le(table_port_info& info)
+{
+    info.type = table_le(info.type);
+    info.id = table_le(info.id);
+    info.peer_port = table_le(info.peer_port);
+}
+
+inline void table_le(table_candidate& cand)
+{
+    cand.port = table_le(cand.port);
+    cand.vc = table_le(cand.vc);
+}
+
+
+class topo_table_event : public internal_router_event {
+public:
+    id_type id;
+
+    topo_table_event() : internal_router_event() {}
+    topo_table_event(RtrEvent* ev) :
+        internal_router_event(ev)
+    {
+        id = generateUniqueId();
+    }
+    virtual ~topo_table_event() {}
+    virtual internal_router_event* clone(void) override
+    {
+        return new topo_table_event(*this);
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        internal_router_event::serialize_order(ser);
+        ser & id;
+    }
+
+private:
+    ImplementSerializable(SST::Merlin::topo_table_event)
+
+};
+
+
+class topo_table: public Topology {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        topo_table,
+        "merlin",
+        "table",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Topology object that routes using forwarding tables loaded from a file",
+        SST::Merlin::Topology
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"filename",  "Binary forwarding table file (see merlin/tools/merlin_table.py)."},
+        {"algorithm", "How to choose among the candidates for a destination: first, hash or adaptive.  "
+                      "first always uses the first candidate, hash spreads flows using the source and destination, "
+                      "and adaptive picks the candidate with the shortest output queue.", "first"}
+    )
+
+    enum RouteAlgo {
+        FIRST,
+        HASH,
+        ADAPTIVE
+    };
+
+private:
+    int router_id;
+    int num_vns;
+    int num_table_vcs;      // VCs per VN
+    uint32_t num_endpoints;
+    RouteAlgo algorithm;
+
+    std::vector<table_port_info> port_info;
+    std::vector<uint32_t> entry_start;
+    std::vector<table_candidate> candidates;
+
+    int const* output_queue_lengths;
+    int num_vcs;            // VCs in the router, across all VNs
+
+    // Untimed broadcasts are flooded, so drop copies that have
+    // already been seen
+    std::set<Event::id_type> broadcasts_seen;
+
+    void loadTable(const std::string& filename, int num_ports);
+    void checkRoute(int dest);
+    const table_candidate& chooseCandidate(int src, int dest, int vn_start, int in_vc, int in_port, int& out_vc);
+    int candidateVC(const table_candidate& cand, int in_vc, int in_port);
+
+public:
+    topo_table(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns);
+    ~topo_table();
+
+    virtual void route_packet(int port, int vc, internal_router_event* ev);
+    virtual internal_router_event* process_input(RtrEvent* ev);
+
+    virtual void routeUntimedData(int port, internal_router_event* ev, std::vector<int> &outPorts);
+    virtual internal_router_event* process_UntimedData_input(RtrEvent* ev);
+
+    virtual PortState getPortState(int port) const;
+    virtual int getEndpointID(int port);
+
+    virtual void setOutputQueueLengthsArray(int const* array, int vcs);
+
+    virtual void getVCsPerVN(std::vector<int>& vcs_per_vn) {
+        for ( int i = 0; i < num_vns; ++i ) {
+            vcs_per_vn[i] = num_table_vcs;
+        }
+    }
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TOPOLOGY_TABLE_H
@@ -149,7 +149,11 @@ Messier::Messier(SST::ComponentId_t id, SST::Params& params): Component(id) {
         event_link->setDefaultTimeBase(tc);
 
 
-    registerClock( cpu_clock, new Clock::Handler<Messier>(this, &Messier::tick ) );
+    Clock::Handler<Messier> * clock_handler = new Clock::Handler<Messier>(this, &Messier::tick );
+    TimeConverter* clock_tc = registerClock( cpu_clock, clock_handler );
+
+    // The DIMM stops the clock while idle and reregisters it when work arrives
+    DIMM->setClock(clock_tc, clock_handler);
 
 }
 
@@ -162,7 +166,5 @@ Messier::Messier() : Component(-1)
 bool Messier::tick(SST::Cycle_t x)
 {
     // We tick the MMU hierarchy of each core
-    DIMM->tick();
-
-    return false;
+    return DIMM->tick(x);
 }
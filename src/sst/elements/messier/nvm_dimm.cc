@@ -21,6 +21,8 @@
 #include <cstddef>
 #include <iostream>
 #include <list>
+#include <vector>
+#include <algorithm>
 
 #include "rank.h"
 #include "writeBuffer.h"
@@ -89,6 +91,25 @@ NVM_DIMM::NVM_DIMM(ComponentId_t id, NVM_PARAMS par) : ComponentExtension(id)
     curr_reads = 0;
     curr_writes = 0;
 
+    // Size the completion wheels to cover the longest read activation or write
+    long long int horizon = std::max(params->tCMD + params->tRCD, params->tCMD + params->tCL_W + params->tBURST) + 1;
+    long long int wheel_size = 1;
+    while(wheel_size < horizon)
+        wheel_size <<= 1;
+    completion_mask = wheel_size - 1;
+    READS_COMPLETE.assign(wheel_size, 0);
+    WRITES_COMPLETE.assign(wheel_size, 0);
+
+    ready_at_NVM.resize(params->num_ranks * params->num_banks);
+    ready_count = 0;
+
+    bank_hist.assign(params->num_banks, 0);
+
+    clock_tc = NULL;
+    clock_handler = NULL;
+    clock_on = true;
+    clock_base = 0;
+
     gs = params->group_size;
     lg = group_locked;
 
@@ -121,30 +142,30 @@ int NVM_DIMM::WhichBank(long long int add)
 
 unsigned long int last_empty = 0;
 
-bool NVM_DIMM::tick()
+bool NVM_DIMM::tick(SST::Cycle_t x)
 {
 
 
     if(!enabled)
-        return false;
+    {
+        // Nothing has arrived yet, handleRequest restarts the clock
+        clock_on = false;
+        return true;
+    }
 
 
-    // Incrementing the cycles count
+    // Cycles count the clock ticks since the controller was enabled, including any skipped while idle
 
-    cycles++;
+    cycles = x - clock_base;
 
 
-    if(READS_COMPLETE.find(cycles)!=READS_COMPLETE.end())
-    {
-        curr_reads = curr_reads - READS_COMPLETE[cycles];
-        READS_COMPLETE.erase(cycles);
-    }
+    int & reads_done = READS_COMPLETE[cycles & completion_mask];
+    curr_reads = curr_reads - reads_done;
+    reads_done = 0;
 
-    if(WRITES_COMPLETE.find(cycles)!=WRITES_COMPLETE.end())
-    {
-        curr_writes = curr_writes - WRITES_COMPLETE[cycles];
-        WRITES_COMPLETE.erase(cycles);
-    }
+    int & writes_done = WRITES_COMPLETE[cycles & completion_mask];
+    curr_writes = curr_writes - writes_done;
+    writes_done = 0;
 
 
 
@@ -209,6 +230,12 @@ bool NVM_DIMM::tick()
     }
 
 
+    // Stop clocking until the next request or event brings in work
+    if(idle())
+    {
+        clock_on = false;
+        return true;
+    }
 
     return false;
 
@@ -216,53 +243,80 @@ bool NVM_DIMM::tick()
 }
 
 
-void NVM_DIMM::schedule_delivery()
+void NVM_DIMM::sync_clock()
 {
 
-    std::map<NVM_Request *, long long int>::iterator st_1, en_1;
-    st_1 = ready_at_NVM.begin();
-    en_1 = ready_at_NVM.end();
+    if(clock_on)
+        return;
 
-    while (st_1 != en_1)
-    {
+    // Clock handlers run before events at the same time, so every tick up to now would already have executed
+    long long int now = getCurrentSimTime(clock_tc) - clock_base;
 
-        bool ready = false;
+    // An idle tick in modulo mode still counts towards the modulo unit
+    if(params->modulo)
+        read_count += now - cycles;
 
-        if(st_1->second <= cycles)
-        {
+    cycles = now;
 
+}
 
-            bool ready = false;
-            // Check if the bank and rank are free to submit the command there
-            long long int add = (st_1->first)->Address;
-            if (getRank(add)->getBusyUntil() < cycles)
-            {
-                if(getBank(add)->getBusyUntil() < cycles)
-                    ready = true;
-            }
 
-            if(ready) // This means that the request is ready and the data is ready to be ready by internal controller
-            {
+void NVM_DIMM::wake_clock()
+{
 
-                // Occuping the rank and back for reading the ready data
-                getRank(add)->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
-                (getBank(add))->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
-                (getBank(add))->set_last(true);
-                ready_trans[st_1->first] = cycles + params->tCMD + params->tCL + params->tBURST;
-                (st_1->first)->meta_data = EventType::READ_COMPLETION;
-                                m_EventChan->send(params->tCMD + params->tCL + params->tBURST, new MessierEvent(st_1->first, EventType::READ_COMPLETION));
-                ready_at_NVM.erase(st_1);
-                break;
-            }
+    if(clock_on || idle())
+        return;
 
-        }
+    reregisterClock(clock_tc, clock_handler);
+    clock_on = true;
+
+}
+
+
+void NVM_DIMM::schedule_delivery()
+{
+
+    if(ready_count == 0)
+        return;
+
+    // Among the banks that are free, deliver the ready request with the lowest req_ID
+    NVM_Request * next = NULL;
+    int next_queue = -1;
+
+    for(int q = 0; q < (int) ready_at_NVM.size(); q++)
+    {
+        if(ready_at_NVM[q].empty())
+            continue;
+
+        NVM_Request * head = ready_at_NVM[q].front();
 
-        if(!ready)
-            st_1++;
+        if(next != NULL && next->req_ID < head->req_ID)
+            continue;
 
+        // Check if the bank and rank are free to submit the command there
+        long long int add = head->Address;
+        if ((getRank(add)->getBusyUntil() < cycles) && (getBank(add)->getBusyUntil() < cycles))
+        {
+            next = head;
+            next_queue = q;
+        }
     }
 
+    if(next != NULL) // This means that the request is ready and the data is ready to be ready by internal controller
+    {
+
+        long long int add = next->Address;
+
+        // Occuping the rank and back for reading the ready data
+        getRank(add)->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
+        (getBank(add))->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
+        (getBank(add))->set_last(true);
+        next->meta_data = EventType::READ_COMPLETION;
+        m_EventChan->send(params->tCMD + params->tCL + params->tBURST, new MessierEvent(next, EventType::READ_COMPLETION));
+        ready_at_NVM[next_queue].erase(ready_at_NVM[next_queue].begin());
+        ready_count--;
 
+    }
 
 }
 
@@ -296,9 +350,9 @@ bool NVM_DIMM::try_flush_wb()
     {
 
 
-        std::list<NVM_Request *> writes_list = WB->getList();
+        const std::list<NVM_Request *> & writes_list = WB->getList();
 
-        std::list<NVM_Request *>::iterator st_wl, en_wl;
+        std::list<NVM_Request *>::const_iterator st_wl, en_wl;
 
         st_wl = writes_list.begin();
         en_wl = writes_list.end();
@@ -343,9 +397,9 @@ bool NVM_DIMM::try_flush_wb()
                 temp_bank->set_last(false); // setting it to write
                 temp_bank->set_last_address(temp->Address);
                 curr_writes++;
-                WRITES_COMPLETE[cycles + params->tCMD + params->tCL_W + params->tBURST]++;
+                WRITES_COMPLETE[(cycles + params->tCMD + params->tCL_W + params->tBURST) & completion_mask]++;
 
-                delete temp;
+                free_request(temp);
 
                 return true;
 
@@ -377,7 +431,6 @@ bool NVM_DIMM::find_in_wb(NVM_Request * temp)
         {
 
             m_memChan->send(respEvent); //(SST::Event *)NVM_EVENT_MAP[temp]);
-            TIME_STAMP.erase(temp);
 
 
         }
@@ -390,7 +443,7 @@ bool NVM_DIMM::find_in_wb(NVM_Request * temp)
         bank_hist[WhichBank(temp->Address)]--;
         delete NVM_EVENT_MAP[temp->req_ID];
         NVM_EVENT_MAP.erase(temp->req_ID);
-        delete temp;
+        free_request(temp);
     }
 
     return removed;
@@ -438,7 +491,7 @@ bool NVM_DIMM::pop_optimal()
             SQUASHED.erase(temp->req_ID);
             transactions.erase(st);
             delete NVM_EVENT_MAP[temp->req_ID];
-            delete temp;
+            free_request(temp);
             break;
         }
 
@@ -504,7 +557,7 @@ bool NVM_DIMM::submit_request_opt()
                 SQUASHED.erase(temp->req_ID);
                 transactions.erase(st);
                 delete NVM_EVENT_MAP[temp->req_ID];
-                delete temp;
+                free_request(temp);
                 break;
             }
 
@@ -516,7 +569,7 @@ bool NVM_DIMM::submit_request_opt()
 
                     last_write = cycles;
 
-                    NVM_Request * write_req = new NVM_Request();
+                    NVM_Request * write_req = alloc_request();
                     write_req->req_ID = 0;
                     write_req->Read = false;
                     write_req->Address = temp->Address;
@@ -542,7 +595,7 @@ bool NVM_DIMM::submit_request_opt()
                     delete NVM_EVENT_MAP[temp->req_ID];
 
                     NVM_EVENT_MAP.erase(temp->req_ID);
-                    delete temp;
+                    free_request(temp);
                     removed = true;
                     break;
                 }
@@ -576,7 +629,7 @@ bool NVM_DIMM::submit_request_opt()
                         // Write cancellation business
                         corresp_bank->setLocked(false, cycles);
                         // Put the request back in the write buffer
-                        NVM_Request * evicted = new NVM_Request();
+                        NVM_Request * evicted = alloc_request();
                                                 evicted->req_ID = 0;
                                                 evicted->Read = false;
                                                 evicted->Address = corresp_bank->get_last_address();;
@@ -605,7 +658,7 @@ bool NVM_DIMM::submit_request_opt()
                             corresp_bank->set_last(true);
                             time_ready = cycles + params->tRCD + params->tCMD;
                             curr_reads++;
-                            READS_COMPLETE[cycles + params->tRCD + params->tCMD]++;
+                            READS_COMPLETE[(cycles + params->tRCD + params->tCMD) & completion_mask]++;
                             corresp_bank->setRB(temp->Address/params->row_buffer_size);
                             issued = true;
                         }
@@ -659,6 +712,7 @@ NVM_Request * NVM_DIMM::pop_request()
 void NVM_DIMM::handleEvent( SST::Event* e )
 {
 
+    sync_clock();
 
 
     MessierEvent * temp_ptr =  dynamic_cast<MessierComponent::MessierEvent*> (e);
@@ -680,8 +734,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
         {
             NVM_Request * temp = req;
 
-            histogram_idle->addData((cycles - TIME_STAMP[temp])/1000);
-            TIME_STAMP.erase(temp);
+            histogram_idle->addData((cycles - temp->issue_cycle)/1000);
             if(SQUASHED.find(temp->req_ID)==SQUASHED.end())
             {
                 MemRespEvent *respEvent = new MemRespEvent(
@@ -725,7 +778,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
                             {
                                 last_write = cycles;
 
-                                NVM_Request * evicted = new NVM_Request();
+                                NVM_Request * evicted = alloc_request();
                                 evicted->req_ID = 0;
                                 evicted->Read = false;
                                 evicted->Address = evicted_address;
@@ -748,9 +801,8 @@ void NVM_DIMM::handleEvent( SST::Event* e )
                 }
 
             (getBank(req->Address))->setLocked(false, cycles);
-            ready_trans.erase(req);
             outstanding.remove(req);
-            delete req;
+            free_request(req);
 
         }
 
@@ -759,7 +811,12 @@ void NVM_DIMM::handleEvent( SST::Event* e )
     {
 
         NVM_Request * req = tmp.getReq();
-        ready_at_NVM[req] = cycles;
+        std::vector<NVM_Request *> & queue = ready_at_NVM[ReadyQueue(req->Address)];
+        std::vector<NVM_Request *>::iterator pos = queue.begin();
+        while(pos != queue.end() && (*pos)->req_ID < req->req_ID)
+            pos++;
+        queue.insert(pos, req);
+        ready_count++;
         delete e;
 
     }
@@ -773,6 +830,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
         if(NVM_EVENT_MAP.find(temp->req_ID)==NVM_EVENT_MAP.end())
         {
 
+            free_request(temp);
             delete e;
             return;
         }
@@ -790,7 +848,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
                 if(params->cache_persistent)
                     HOLD.erase(temp->req_ID);
 
-                SQUASHED[temp->req_ID] = 1;
+                SQUASHED.insert(temp->req_ID);
 
 
             }
@@ -817,7 +875,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
                     {
                         last_write = cycles;
 
-                        NVM_Request * evicted = new NVM_Request();
+                        NVM_Request * evicted = alloc_request();
                         evicted->req_ID = 0;
                         evicted->Read = false;
                         evicted->Address = evicted_address;
@@ -892,7 +950,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 
         }
 
-        delete temp;
+        free_request(temp);
         delete e;
 
 
@@ -901,10 +959,12 @@ void NVM_DIMM::handleEvent( SST::Event* e )
     {
         NVM_Request * req = tmp.getReq();
         cache->invalidate(req->Address);
-        delete req;
+        free_request(req);
         delete e;
     }
 
+    wake_clock();
+
 }
 
 
@@ -912,12 +972,20 @@ void NVM_DIMM::handleEvent( SST::Event* e )
 void NVM_DIMM::handleRequest(SST::Event* e)
 {
 
-    enabled = true;
+    if(!enabled)
+    {
+        // Cycles count from the first request on
+        clock_base = getCurrentSimTime(clock_tc);
+        cycles = 0;
+        enabled = true;
+    }
+    else
+        sync_clock();
 
 
     MessierComponent::MemReqEvent *event  = dynamic_cast<MessierComponent::MemReqEvent*>(e);
 
-    NVM_Request * tmp = new NVM_Request();
+    NVM_Request * tmp = alloc_request();
 
     //TODO: ADD a map for NVM_Request to MemReqEvent
 
@@ -949,7 +1017,7 @@ void NVM_DIMM::handleRequest(SST::Event* e)
     if(cache!=NULL)
     {
 
-        NVM_Request * tmp2 = new NVM_Request();
+        NVM_Request * tmp2 = alloc_request();
 
         if(!event->getIsWrite())
             tmp2->Read = true;
@@ -979,7 +1047,7 @@ void NVM_DIMM::handleRequest(SST::Event* e)
         {
             // Hold servicing the request till we check the cache!
             if(params->cache_persistent)
-                HOLD[tmp2->req_ID] = 1;
+                HOLD.insert(tmp2->req_ID);
 
             tmp2->meta_data = EventType::HIT_MISS;
             m_EventChan->send(params->cache_latency, new MessierEvent(tmp2, EventType::HIT_MISS));
@@ -992,6 +1060,8 @@ void NVM_DIMM::handleRequest(SST::Event* e)
     // If write and the cache is peristent, just put it directly in the cache
     if(!(params->cache_persistent && (cache!=NULL) && (!tmp->Read)))
         push_request(tmp); // Push the request
+
+    wake_clock();
 }
 
 #if ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
@@ -22,6 +22,9 @@
 
 #include <map>
 #include <list>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "rank.h"
 #include "writeBuffer.h"
@@ -54,24 +57,19 @@ namespace MessierComponent{
         // This tracks the currently outstanding requests
         std::list<NVM_Request *> outstanding;
 
-        // This is used to quickly track the number of writes complete at a specific cycle to remove them from the currently executed writes
-        std::map<long long int, int> WRITES_COMPLETE;
+        // Timing wheels tracking the number of writes/reads completing at a given cycle (indexed by cycle & completion_mask)
+        std::vector<int> WRITES_COMPLETE;
+        std::vector<int> READS_COMPLETE;
+        long long int completion_mask;
 
-        // This is used to quickly track the number of reads complete at a specific cycle to remove them from the currently executed reads
-        std::map<long long int, int> READS_COMPLETE;
+        // Requests whose data is ready at the NVM chips, one queue per (rank, bank), each kept sorted by req_ID
+        std::vector<std::vector<NVM_Request *> > ready_at_NVM;
 
-                // Deterministic sort function for NVM_Request pointers
-                struct NVMReqPtrCompare {
-                    bool operator()(const NVM_Request* ptrA, const NVM_Request* ptrB) const {
-                        return (ptrA->req_ID < ptrB->req_ID);
-                    }
-                };
+        // The number of requests across all ready_at_NVM queues
+        int ready_count;
 
-        // This is the queue of the ready requests
-        std::map<NVM_Request *, long long int, NVMReqPtrCompare> ready_trans;
-
-        // This tracks if a request is expected to be ready at the PCM
-        std::map<NVM_Request *, long long int, NVMReqPtrCompare> ready_at_NVM;
+        // Pool of recycled request slots
+        std::vector<NVM_Request *> free_requests;
 
         // This determines the completed requests and when they are completed
         std::list<NVM_Request *> completed_requests;
@@ -98,30 +96,64 @@ namespace MessierComponent{
 
         SST::Link * m_EventChan;
 
-        std::map<long long int, MemReqEvent *> NVM_EVENT_MAP;
-
-        std::map<NVM_Request *, long long int, NVMReqPtrCompare> TIME_STAMP;
+        std::unordered_map<long long int, MemReqEvent *> NVM_EVENT_MAP;
 
         // This keeps track of the squashed requests, as they hit in the cache
-        std::map<long long int, int> SQUASHED;
+        std::unordered_set<long long int> SQUASHED;
 
         // This structure prevents returning data before checking the cache, to avoid any inconsistency issues
-        std::map<long long int, int> HOLD;
+        std::unordered_set<long long int> HOLD;
 
         // This defines the internal cache of the NVM-based DIMM
         NVM_CACHE * cache;
 
-        std::map<int, int> bank_hist;
+        std::vector<int> bank_hist;
 
         int group_locked;
 
+        // Clock management: the controller stops its clock when nothing is pending and resyncs cycles on wakeup
+        TimeConverter * clock_tc;
+        Clock::HandlerBase * clock_handler;
+        bool clock_on;
+        SST::Cycle_t clock_base;
+
+        // Index of the ready_at_NVM queue for an address
+        int ReadyQueue(long long int add) { return WhichRank(add) * params->num_banks + WhichBank(add); }
+
+        NVM_Request * alloc_request() {
+            if(free_requests.empty())
+                return new NVM_Request();
+            NVM_Request * req = free_requests.back();
+            free_requests.pop_back();
+            return req;
+        }
+
+        void free_request(NVM_Request * req) { free_requests.push_back(req); }
+
+        // True if no request is buffered, executing or waiting on the NVM chips
+        bool idle() { return transactions.empty() && outstanding.empty() && (ready_count == 0) && WB->empty() && (curr_reads == 0) && (curr_writes == 0); }
+
+        // Bring cycles up to date after the clock was stopped
+        void sync_clock();
+
+        // Restart the clock if it was stopped and there is pending work
+        void wake_clock();
+
         public:
 
         // This is the constructor for the NVM-based DIMM
         NVM_DIMM(SST::ComponentId_t id, NVM_PARAMS par);
 
-        // This is the clock of the near memory controller
-        bool tick();
+        // Releases the recycled request slots
+        ~NVM_DIMM() {
+            for(auto req : free_requests)
+                delete req;
+        }
+
+        // This is the clock of the near memory controller, returns true when the clock can be stopped
+        bool tick(SST::Cycle_t x);
+
+        void setClock(TimeConverter * tc, Clock::HandlerBase * handler) { clock_tc = tc; clock_handler = handler; clock_on = true; }
 
         void finish(){}
 
@@ -139,7 +171,7 @@ namespace MessierComponent{
 
         //bool push_request(NVM_Request * req) { if(transactions.size() >= params->max_requests) return false; else {transactions.push_back(req); return true; }}
 
-        bool push_request(NVM_Request * req) { transactions.push_back(req);  if(req->Read) TIME_STAMP[req]= cycles; return true;}
+        bool push_request(NVM_Request * req) { transactions.push_back(req);  if(req->Read) req->issue_cycle = cycles; return true;}
 
         // This is the optimized version that basiclly tries to find out if there is any possibility to achieve a row buffer hit from the current transactions
         bool submit_request_opt();
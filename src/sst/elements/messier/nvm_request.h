@@ -43,6 +43,8 @@ class NVM_Request
         int Size;
         uint64_t Address;
         int meta_data;
+        // The controller cycle a read was queued at, used for the idle histogram
+        long long int issue_cycle;
 };
 
 }
@@ -92,7 +92,7 @@ public:
     void finish() { link_control->finish(); }
     void setup() { link_control->setup(); MemLinkBase::setup(); }
 
-    virtual std::string findTargetDestination(MemHierarchy::Addr addr);
+    virtual uint32_t findTargetDestination(MemHierarchy::Addr addr);
 
 protected:
     virtual MemHierarchy::MemNICBase::InitMemRtrEvent* createInitMemRtrEvent();
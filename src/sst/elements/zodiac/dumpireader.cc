@@ -68,6 +68,8 @@ void DUMPIReader::close() {
 
 uint32_t DUMPIReader::generateNextEvents() {
 	int finalized_reached = 0;
+	const size_t startQSize = eventQ->size();
+	throughput.start();
 
 /*	while((finalized_reached == 0) && (eventQ->size() < qLimit)) {
 		int active = undumpi_read_single_call(
@@ -84,6 +86,7 @@ uint32_t DUMPIReader::generateNextEvents() {
 	}*/
 	undumpi_read_stream(trace, callbacks, this);
 
+	throughput.stop(eventQ->size() - startQSize);
 	return (uint32_t) eventQ->size();
 }
 
@@ -28,6 +28,7 @@
 #include "sst/elements/hermes/msgapi.h"
 
 #include "zevent.h"
+#include "ztracebuffer.h"
 #include "zsendevent.h"
 #include "zrecvevent.h"
 
@@ -56,12 +57,14 @@ class DUMPIReader {
 	uint32_t getQueueLimit();
 	uint32_t getCurrentQueueSize();
 	void enqueueEvent(ZodiacEvent* ev);
+	const ZodiacReaderThroughput& getThroughput() const { return throughput; }
 
     private:
 	uint32_t rank;
 	uint32_t qLimit;
 	bool foundFinalize;
 	std::queue<ZodiacEvent*>* eventQ;
+	ZodiacReaderThroughput throughput;
 	dumpi_profile* trace;
 	libundumpi_callbacks* callbacks;
 };
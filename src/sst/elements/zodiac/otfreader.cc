@@ -159,6 +159,8 @@ void OTFReader::close() {
 
 uint32_t OTFReader::generateNextEvents() {
 	std::cout << "Generating next event set..." << std::endl;
+	const size_t startQSize = eventQ->size();
+	throughput.start();
 
 	while((eventQ->size() < qLimit) && (!foundFinalize)) {
 		std::cout << "Reading next event, queue size: " << eventQ->size() << std::endl;
@@ -168,6 +170,8 @@ uint32_t OTFReader::generateNextEvents() {
 		}
 	}
 
+	throughput.stop(eventQ->size() - startQSize);
+
 	// Return the size of the queue back to the caller, they
 	// may want to know that we consumed fewer events than
 	// the queue limit - this happens if we encounter an MPI
@@ -27,6 +27,7 @@
 
 #include "sst/elements/hermes/msgapi.h"
 #include "zevent.h"
+#include "ztracebuffer.h"
 #include "zsendevent.h"
 #include "zrecvevent.h"
 #include "otf.h"
@@ -61,6 +62,7 @@ class OTFReader {
 	uint32_t getQueueLimit();
 	uint32_t getCurrentQueueSize();
 	void enqueueEvent(ZodiacEvent* ev);
+	const ZodiacReaderThroughput& getThroughput() const { return throughput; }
 
     private:
 	OTF_Reader* reader;
@@ -70,6 +72,7 @@ class OTFReader {
 	uint32_t qLimit;
 	bool foundFinalize;
 	std::queue<ZodiacEvent*>* eventQ;
+	ZodiacReaderThroughput throughput;
 
 };
 
@@ -32,45 +32,49 @@ using namespace SST::Zodiac;
 #endif
 
 
-SiriusReader::SiriusReader(char* file, uint32_t focusOnRank, uint32_t maxQLen, std::queue<ZodiacEvent*>* evQ, int verbose)
+SiriusReader::SiriusReader(char* file, uint32_t focusOnRank, uint32_t maxQLen, std::queue<ZodiacEvent*>* evQ, int verbose,
+	size_t blockSize, bool useMmap, bool prefetch)
 {
 
 	rank = focusOnRank;
 	eventQ = evQ;
 	qLimit = maxQLen;
 	foundFinalize = false;
+	recordAvail = 0;
 
-	trace = fopen(file, "rb");
-	if(NULL == trace) {
-		std::cerr << "Error opening the Sirius trace file: " << file << std::endl;
-		exit(-1);
+	output = new Output("SiriusReader", verbose, 0, Output::STDOUT);
+
+	std::string error = trace.open(file, blockSize, useMmap, prefetch);
+	if("" != error) {
+		output->fatal(CALL_INFO, -1, "Error opening the Sirius trace file: %s\n", error.c_str());
 	}
 
 	prevEventTime = 0;
-	output = new Output("SiriusReader", verbose, 0, Output::STDOUT);
 	readInit();
 }
 
 void SiriusReader::close() {
-	if(NULL == trace) {
-		output->fatal(CALL_INFO, -1, "Error: trace file is NULL when being closed, has an error occured in SIRIUS?\n");
-	} else {
-		output->verbose(CALL_INFO, 4, 0, "Closing trace file.\n");
-	}
-
-	fclose(trace);
+	output->verbose(CALL_INFO, 4, 0, "Closing trace file, read %" PRIu64 " bytes.\n", trace.bytesRead());
+	trace.close();
 }
 
 uint32_t SiriusReader::generateNextEvents() {
-//	int finalized_reached = 0;
+	const size_t startQSize = eventQ->size();
+	throughput.start();
 
 	while((foundFinalize == false) && (eventQ->size() < qLimit)) {
 		generateNextEvent();
 	}
 
+	throughput.stop(eventQ->size() - startQSize);
 	return (uint32_t) eventQ->size();
 }
 
+void SiriusReader::traceTruncated() {
+	output->fatal(CALL_INFO, -1, "Sirius trace for rank %" PRIu32 " ended at byte %" PRIu64 " before MPI_Finalize\n",
+		rank, trace.position());
+}
+
 uint32_t SiriusReader::getQueueLimit() {
 	return qLimit;
 }
@@ -80,6 +84,8 @@ uint32_t SiriusReader::getCurrentQueueSize() {
 }
 
 void SiriusReader::generateNextEvent() {
+	recordAvail = trace.ensure(SIRIUS_MAX_RECORD_BYTES);
+
 	uint32_t call_type = readUINT32();
 	double callTime = readTime();
 	double evTimeDiff = callTime - prevEventTime;
@@ -128,9 +134,8 @@ void SiriusReader::generateNextEvent() {
 		break;
 
 	default:
-		std::cout << "Unknown MPI command in trace (" << call_type << ") position: " <<
-			ftell(trace) << std::endl;
-		exit(-1);
+		output->fatal(CALL_INFO, -1, "Unknown MPI command in trace (%" PRIu32 ") position: %" PRIu64 "\n",
+			call_type, trace.position());
 		break;
 	}
 
@@ -239,36 +244,6 @@ void SiriusReader::readBarrier() {
 	eventQ->push(ev);
 }
 
-uint32_t SiriusReader::readUINT32() {
-	uint32_t temp;
-	fread(&temp, 1, sizeof(uint32_t), trace);
-	return temp;
-}
-
-uint64_t SiriusReader::readUINT64() {
-	uint64_t temp;
-	fread(&temp, 1, sizeof(uint64_t), trace);
-	return temp;
-}
-
-double SiriusReader::readTime() {
-	double temp;
-	fread(&temp, 1, sizeof(double), trace);
-	return temp;
-}
-
-int32_t SiriusReader::readINT32() {
-	int32_t temp;
-	fread(&temp, 1, sizeof(int32_t), trace);
-	return temp;
-}
-
-int64_t SiriusReader::readINT64() {
-	int64_t temp;
-	fread(&temp, 1, sizeof(int64_t), trace);
-	return temp;
-}
-
 PayloadDataType SiriusReader::convertToHermesType(uint32_t dtype) {
 	PayloadDataType hType = CHAR;
 
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include <string>
 #include <iostream>
@@ -32,6 +33,7 @@
 #include "sirius/siriusconst.h"
 
 #include "zevent.h"
+#include "ztracebuffer.h"
 #include "zinitevent.h"
 #include "zsendevent.h"
 #include "zirecvevent.h"
@@ -51,13 +53,15 @@ namespace Zodiac {
 
 class SiriusReader {
     public:
-	SiriusReader(char* file, uint32_t rank, uint32_t qLimit, std::queue<ZodiacEvent*>* eventQueue, int verbose);
+	SiriusReader(char* file, uint32_t rank, uint32_t qLimit, std::queue<ZodiacEvent*>* eventQueue, int verbose,
+		size_t blockSize = 1024 * 1024, bool useMmap = true, bool prefetch = false);
         void close();
 	void setOutput(Output* oput);
 	uint32_t generateNextEvents();
 	uint32_t getQueueLimit();
 	uint32_t getCurrentQueueSize();
 	bool hasReachedFinalize();
+	const ZodiacReaderThroughput& getThroughput() const { return throughput; }
 
     private:
 	Output* output;
@@ -65,14 +69,19 @@ class SiriusReader {
 	uint32_t qLimit;
 	bool foundFinalize;
 	std::queue<ZodiacEvent*>* eventQ;
-	FILE* trace;
+	ZodiacTraceBuffer trace;
+	ZodiacReaderThroughput throughput;
+	// Bytes of the current record known to be in the trace buffer
+	size_t recordAvail;
 	double prevEventTime;
 	void generateNextEvent();
-	inline uint32_t readUINT32();
-	inline uint64_t readUINT64();
-	inline double readTime();
-	inline int32_t readINT32();
-	inline int64_t readINT64();
+	template<typename T> inline T readValue();
+	void traceTruncated();
+	inline uint32_t readUINT32() { return readValue<uint32_t>(); }
+	inline uint64_t readUINT64() { return readValue<uint64_t>(); }
+	inline double readTime() { return readValue<double>(); }
+	inline int32_t readINT32() { return readValue<int32_t>(); }
+	inline int64_t readINT64() { return readValue<int64_t>(); }
 	void readSend();
 	void readIrecv();
 	void readRecv();
@@ -86,6 +95,21 @@ class SiriusReader {
 	ReductionOperation convertToHermesOp(uint32_t op);
 };
 
+// Sirius records are small and fixed length, so a whole record is decoded
+// straight out of the trace buffer once this many bytes are available
+#define SIRIUS_MAX_RECORD_BYTES 128
+
+template<typename T>
+inline T SiriusReader::readValue() {
+	if(recordAvail < sizeof(T)) traceTruncated();
+
+	T temp;
+	memcpy(&temp, trace.data(), sizeof(T));
+	trace.consume(sizeof(T));
+	recordAvail -= sizeof(T);
+	return temp;
+}
+
 }
 }
 
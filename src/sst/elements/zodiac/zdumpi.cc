@@ -54,6 +54,12 @@ ZodiacDUMPITraceReader::~ZodiacDUMPITraceReader() {
 	trace->close();
 }
 
+void ZodiacDUMPITraceReader::finish() {
+    std::cout << "- Trace events decoded:       " << trace->getThroughput().getEvents()
+              << " (" << trace->getThroughput().getEventsPerSecond() << " events/s)" << std::endl;
+    trace->close();
+}
+
 ZodiacDUMPITraceReader::ZodiacDUMPITraceReader() :
     Component(-1)
 {
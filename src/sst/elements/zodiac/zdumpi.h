@@ -41,9 +41,7 @@ public:
 
   ZodiacDUMPITraceReader(SST::ComponentId_t id, SST::Params& params);
   void setup() { }
-  void finish() {
-	trace->close();
-  }
+  void finish();
 
 private:
   ~ZodiacDUMPITraceReader();
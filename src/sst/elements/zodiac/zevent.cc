@@ -17,9 +17,57 @@
 #include <sst_config.h>
 #include "zevent.h"
 
+#include <vector>
+
 using namespace SST;
 using namespace SST::Zodiac;
 
 ZodiacEvent::ZodiacEvent() {
 
 }
+
+// Events are bucketed by size in 16 byte steps.  Anything larger than
+// the last bucket goes to the heap.
+#define ZODIAC_EVENT_POOL_STEP    16
+#define ZODIAC_EVENT_POOL_BUCKETS 16
+
+namespace {
+struct ZodiacEventPool {
+	std::vector<void*> freeList[ZODIAC_EVENT_POOL_BUCKETS];
+
+	~ZodiacEventPool() {
+		for(int i = 0; i < ZODIAC_EVENT_POOL_BUCKETS; i++) {
+			for(void* ptr : freeList[i]) ::operator delete(ptr);
+		}
+	}
+};
+
+thread_local ZodiacEventPool eventPool;
+}
+
+void* ZodiacEvent::operator new(std::size_t size) {
+	const std::size_t bucket = (size - 1) / ZODIAC_EVENT_POOL_STEP;
+	if(bucket >= ZODIAC_EVENT_POOL_BUCKETS) {
+		return ::operator new(size);
+	}
+
+	std::vector<void*>& freeList = eventPool.freeList[bucket];
+	if(freeList.empty()) {
+		return ::operator new((bucket + 1) * ZODIAC_EVENT_POOL_STEP);
+	}
+
+	void* ptr = freeList.back();
+	freeList.pop_back();
+	return ptr;
+}
+
+void ZodiacEvent::operator delete(void* ptr, std::size_t size) {
+	if(NULL == ptr) return;
+
+	const std::size_t bucket = (size - 1) / ZODIAC_EVENT_POOL_STEP;
+	if(bucket >= ZODIAC_EVENT_POOL_BUCKETS) {
+		::operator delete(ptr);
+	} else {
+		eventPool.freeList[bucket].push_back(ptr);
+	}
+}
@@ -17,6 +17,8 @@
 #ifndef _H_ZODIAC_EVENT_BASE
 #define _H_ZODIAC_EVENT_BASE
 
+#include <cstddef>
+
 #include "sst/elements/hermes/msgapi.h"
 
 namespace SST {
@@ -42,6 +44,12 @@ class ZodiacEvent : public SST::Event {
 		ZodiacEvent();
 		virtual ZodiacEventType getEventType() = 0;
 
+		// Trace readers create and the replay components delete one
+		// event per trace record, so events are recycled through a
+		// per-thread free list for each size instead of the heap
+		static void* operator new(std::size_t size);
+		static void operator delete(void* ptr, std::size_t size);
+
 		NotSerializable(ZodiacEvent)
 };
 
@@ -69,6 +69,11 @@ ZodiacOTFTraceReader::~ZodiacOTFTraceReader() {
     //undumpi_close(trace);
 }
 
+void ZodiacOTFTraceReader::finish() {
+    std::cout << "- Trace events decoded:       " << reader->getThroughput().getEvents()
+              << " (" << reader->getThroughput().getEventsPerSecond() << " events/s)" << std::endl;
+}
+
 ZodiacOTFTraceReader::ZodiacOTFTraceReader() :
     Component(-1)
 {
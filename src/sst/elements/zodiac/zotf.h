@@ -40,8 +40,7 @@ public:
 
   ZodiacOTFTraceReader(SST::ComponentId_t id, SST::Params& params);
   void setup() { }
-  void finish() {
-  }
+  void finish();
 
 private:
   ~ZodiacOTFTraceReader();
@@ -80,6 +80,10 @@ ZodiacSiriusTraceReader::ZodiacSiriusTraceReader(ComponentId_t id, Params& param
     emptyBufferSize = (uint32_t) params.find("buffer", 4096);
     emptyBuffer = (char*) malloc(sizeof(char) * emptyBufferSize);
 
+    traceBlockSize = params.find<size_t>("trace_block_size", 1024 * 1024);
+    traceMmap = params.find<bool>("trace_mmap", true);
+    tracePrefetch = params.find<bool>("trace_prefetch", false);
+
     // Make sure we don't stop the simulation until we are ready
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
@@ -101,7 +105,8 @@ void ZodiacSiriusTraceReader::setup() {
     snprintf(trace_name, trace_file.length() + 20, "%s.%d", trace_file.c_str(), rank);
 
     printf("Opening trace file: %s\n", trace_name);
-    trace = new SiriusReader(trace_name, rank, 64, eventQ, verbosityLevel);
+    trace = new SiriusReader(trace_name, rank, 64, eventQ, verbosityLevel,
+	traceBlockSize, traceMmap, tracePrefetch);
     trace->setOutput(&zOut);
 
     int count = trace->generateNextEvents();
@@ -171,6 +176,8 @@ void ZodiacSiriusTraceReader::finish() {
         zOut.verbose(CALL_INFO, 1, 0, "- Time spend in barrier:      %" PRIu64 " ns\n", nanoBarrier);
         zOut.verbose(CALL_INFO, 1, 0, "- Time spend in init:         %" PRIu64 " ns\n", nanoInit);
         zOut.verbose(CALL_INFO, 1, 0, "- Time spend in finalize:     %" PRIu64 " ns\n", nanoFinalize);
+        zOut.verbose(CALL_INFO, 1, 0, "- Trace events decoded:       %" PRIu64 " (%f events/s)\n",
+		trace->getThroughput().getEvents(), trace->getThroughput().getEventsPerSecond());
 
 	zOut.output("Completed at %" PRIu64 " ns\n", getCurrentSimTimeNano());
 }
@@ -62,6 +62,9 @@ public:
 	{ "scalecompute", "Scale compute event times by a double precision value (allows dilation of times in traces), default is 1.0", "1.0" },
 	{ "verbose", "Sets the verbosity level for the component to output debug/information messages", "0" },
 	{ "buffer", "Sets the size of the buffer to use for message data backing, default is 4096 bytes", "4096" },
+	{ "trace_block_size", "Size in bytes of the blocks the trace file is read in when it is not memory mapped", "1048576" },
+	{ "trace_mmap", "Memory map the trace file rather than reading it in blocks", "1" },
+	{ "trace_prefetch", "When reading blocks, read the next block on a helper thread while the current one is decoded", "0" },
     	{ "name","used internally","" },
     	{ "module","used internally","" }
   )
@@ -114,6 +117,9 @@ private:
   SST::TimeConverter* tConv;
   char* emptyBuffer;
   uint32_t emptyBufferSize;
+  size_t traceBlockSize;
+  bool traceMmap;
+  bool tracePrefetch;
 
   DerivedFunctor allreduceFunctor;
   DerivedFunctor barrierFunctor;
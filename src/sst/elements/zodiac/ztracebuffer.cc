@@ -0,0 +1,163 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "ztracebuffer.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SST::Zodiac;
+
+ZodiacTraceBuffer::ZodiacTraceBuffer() :
+    file(NULL),
+    mapped(false),
+    map(NULL),
+    mapSize(0),
+    base(NULL),
+    pos(0),
+    end(0),
+    fileOffset(0),
+    blockSize(0),
+    prefetch(false),
+    nextSize(0),
+    nextReady(false),
+    stopHelper(false),
+    fileDone(false)
+{
+}
+
+ZodiacTraceBuffer::~ZodiacTraceBuffer() {
+    close();
+}
+
+std::string ZodiacTraceBuffer::open(const std::string& filename, size_t block, bool useMmap, bool usePrefetch) {
+    blockSize = block > 0 ? block : 4096;
+
+    if ( useMmap ) {
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if ( fd < 0 ) return "unable to open " + filename + ": " + strerror(errno);
+
+        struct stat info;
+        if ( fstat(fd, &info) == 0 && info.st_size > 0 ) {
+            void* ptr = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if ( ptr != MAP_FAILED ) {
+                madvise(ptr, info.st_size, MADV_SEQUENTIAL);
+                map = ptr;
+                mapSize = info.st_size;
+                mapped = true;
+                base = (const char*) map;
+                pos = 0;
+                end = mapSize;
+                ::close(fd);
+                return "";
+            }
+        }
+        // Empty files and files that can't be mapped are read instead
+        ::close(fd);
+    }
+
+    file = fopen(filename.c_str(), "rb");
+    if ( file == NULL ) return "unable to open " + filename + ": " + strerror(errno);
+
+    buffer.reserve(2 * blockSize);
+    base = buffer.data();
+
+    prefetch = usePrefetch;
+    if ( prefetch ) {
+        nextBlock.resize(blockSize);
+        helper = std::thread(&ZodiacTraceBuffer::prefetchLoop, this);
+    }
+    return "";
+}
+
+void ZodiacTraceBuffer::close() {
+    if ( prefetch ) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopHelper = true;
+        }
+        cond.notify_all();
+        if ( helper.joinable() ) helper.join();
+        prefetch = false;
+    }
+    if ( mapped ) {
+        munmap(map, mapSize);
+        mapped = false;
+        map = NULL;
+    }
+    if ( file != NULL ) {
+        fclose(file);
+        file = NULL;
+    }
+    base = NULL;
+    pos = end = 0;
+}
+
+void ZodiacTraceBuffer::prefetchLoop() {
+    std::unique_lock<std::mutex> guard(lock);
+    while ( true ) {
+        cond.wait(guard, [this] { return stopHelper || !nextReady; });
+        if ( stopHelper ) return;
+
+        // Read without holding the lock so the decoder isn't blocked
+        // on the file system
+        guard.unlock();
+        size_t got = fread(nextBlock.data(), 1, blockSize, file);
+        guard.lock();
+
+        nextSize = got;
+        nextReady = true;
+        cond.notify_all();
+        if ( got == 0 ) return;
+    }
+}
+
+// Slides the unread bytes to the front of the buffer and appends
+// blocks until n bytes are available or the file ends
+void ZodiacTraceBuffer::refill(size_t n) {
+    if ( mapped || file == NULL || fileDone ) return;
+
+    size_t left = end - pos;
+    if ( pos > 0 ) {
+        memmove(buffer.data(), buffer.data() + pos, left);
+        fileOffset += pos;
+    }
+    pos = 0;
+    end = left;
+
+    while ( end < n && !fileDone ) {
+        size_t got;
+        if ( prefetch ) {
+            std::unique_lock<std::mutex> guard(lock);
+            cond.wait(guard, [this] { return nextReady; });
+            got = nextSize;
+            if ( buffer.size() < end + got ) buffer.resize(end + got);
+            memcpy(buffer.data() + end, nextBlock.data(), got);
+            nextReady = false;
+            guard.unlock();
+            cond.notify_all();
+        } else {
+            if ( buffer.size() < end + blockSize ) buffer.resize(end + blockSize);
+            got = fread(buffer.data() + end, 1, blockSize, file);
+        }
+        end += got;
+        if ( got == 0 ) fileDone = true;
+    }
+    base = buffer.data();
+}
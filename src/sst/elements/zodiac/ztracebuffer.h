@@ -0,0 +1,125 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_ZODIAC_TRACE_BUFFER
+#define _H_ZODIAC_TRACE_BUFFER
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SST {
+namespace Zodiac {
+
+/*
+ * Gives a trace decoder a window of contiguous bytes from a trace file
+ * without a system call per field.  The file is either memory mapped,
+ * or read a block at a time; in block mode a helper thread can read
+ * the next block while the current one is decoded.
+ *
+ * Decoders call ensure() for the largest record they might read, parse
+ * from data(), then consume() the bytes they used.
+ */
+class ZodiacTraceBuffer {
+public:
+    ZodiacTraceBuffer();
+    ~ZodiacTraceBuffer();
+
+    // Returns an empty string on success, otherwise the error
+    std::string open(const std::string& file, size_t blockSize, bool useMmap, bool prefetch);
+    void close();
+
+    // Makes at least n bytes available at data() and returns the
+    // number available, which is only less than n at the end of the
+    // file
+    inline size_t ensure(size_t n) {
+        if ( end - pos < n ) refill(n);
+        return end - pos;
+    }
+
+    inline const char* data() const { return base + pos; }
+    inline void consume(size_t n) { pos += n; }
+
+    // Offset of data() in the file
+    uint64_t position() const { return fileOffset + pos; }
+    uint64_t bytesRead() const { return fileOffset + end; }
+
+private:
+    void refill(size_t n);
+    void prefetchLoop();
+
+    FILE* file;
+    bool mapped;
+    void* map;
+    size_t mapSize;
+
+    // Bytes [pos, end) of base are valid.  base is either the mapping
+    // or buffer.data().
+    const char* base;
+    size_t pos;
+    size_t end;
+    uint64_t fileOffset;
+    size_t blockSize;
+    std::vector<char> buffer;
+
+    // Block mode read ahead
+    bool prefetch;
+    std::thread helper;
+    std::mutex lock;
+    std::condition_variable cond;
+    std::vector<char> nextBlock;
+    size_t nextSize;
+    bool nextReady;
+    bool stopHelper;
+    bool fileDone;
+};
+
+
+/*
+ * Wall clock time spent turning trace records into events, so the
+ * readers can report decode throughput per rank
+ */
+class ZodiacReaderThroughput {
+public:
+    ZodiacReaderThroughput() : events(0), seconds(0) {}
+
+    inline void start() { startTime = std::chrono::steady_clock::now(); }
+    inline void stop(uint64_t decoded) {
+        events += decoded;
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    uint64_t getEvents() const { return events; }
+    double getSeconds() const { return seconds; }
+    double getEventsPerSecond() const { return seconds > 0 ? events / seconds : 0.0; }
+
+private:
+    uint64_t events;
+    double seconds;
+    std::chrono::steady_clock::time_point startTime;
+};
+
+}
+}
+
+#endif